@@ -106,6 +106,16 @@ int KIM_Collections_GetItemType(KIM_Collections * const collections,
                                 char const * const itemName,
                                 KIM_CollectionItemType * const itemType);
 
+/**
+ ** \brief \copybrief KIM::Collections::Prefetch
+ **
+ ** \sa KIM::Collections::Prefetch, kim_collections_module::kim_prefetch
+ **
+ ** \since 2.5
+ **/
+int KIM_Collections_Prefetch(KIM_Collections * const collections,
+                             char const * const itemName);
+
 /**
  ** \brief \copybrief KIM::Collections::GetItemLibraryFileNameAndCollection
  **
@@ -230,6 +230,144 @@ extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialVirial;
 extern KIM_ComputeArgumentName const
     KIM_COMPUTE_ARGUMENT_NAME_partialParticleVirial;
 
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_particle_cost
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_hessian_block_row_offsets
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_hessianBlockRowOffsets;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_hessian_block_column_indices
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_hessianBlockColumnIndices;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_hessian_blocks
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_partialHessianBlocks;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_coordinates_float
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_coordinatesFloat;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_forces_float
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_partialForcesFloat;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesX
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesX,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_coordinates_x
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesX;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesY
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesY,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_coordinates_y
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesY;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_coordinates_z
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesZ;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesX
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesX,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_forces_x
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesX;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesY
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesY,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_forces_y
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesY;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ
+ **
+ ** \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ,
+ ** kim_compute_argument_name_module::<!--
+ ** -->kim_compute_argument_name_partial_forces_z
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesZ;
+
 /**
  ** \brief \copybrief <!--
  ** --> KIM::COMPUTE_ARGUMENT_NAME::GetNumberOfComputeArgumentNames
@@ -152,6 +152,19 @@ int KIM_ComputeArguments_SetArgumentPointerDouble(
     KIM_ComputeArgumentName const computeArgumentName,
     double const * const ptr);
 
+/**
+ ** \brief \copybrief KIM::ComputeArguments::SetArgumentPointer
+ **
+ ** \sa KIM::ComputeArguments::SetArgumentPointer,
+ ** kim_compute_arguments_module::kim_set_argument_pointer
+ **
+ ** \since 2.5
+ **/
+int KIM_ComputeArguments_SetArgumentPointerFloat(
+    KIM_ComputeArguments * const computeArguments,
+    KIM_ComputeArgumentName const computeArgumentName,
+    float const * const ptr);
+
 /**
  ** \brief \copybrief KIM::ComputeArguments::SetCallbackPointer
  **
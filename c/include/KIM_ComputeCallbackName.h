@@ -152,6 +152,55 @@ extern KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTerm;
 extern KIM_ComputeCallbackName const
     KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2Term;
 
+/**
+ ** \brief \copybrief <!--
+ ** -->KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements
+ **
+ ** \sa KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+ ** kim_compute_callback_name_module::<!--
+ ** -->kim_compute_callback_name_get_neighbor_list_with_displacements
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeCallbackName const
+    KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists
+ **
+ ** \sa KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists,
+ ** kim_compute_callback_name_module::<!--
+ ** -->kim_compute_callback_name_get_nested_neighbor_lists
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeCallbackName const
+    KIM_COMPUTE_CALLBACK_NAME_GetNestedNeighborLists;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch
+ **
+ ** \sa KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch,
+ ** kim_compute_callback_name_module::<!--
+ ** -->kim_compute_callback_name_process_dedr_term_batch
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeCallbackName const
+    KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTermBatch;
+
+/**
+ ** \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch
+ **
+ ** \sa KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch,
+ ** kim_compute_callback_name_module::<!--
+ ** -->kim_compute_callback_name_process_d2edr2_term_batch
+ **
+ ** \since 2.5
+ **/
+extern KIM_ComputeCallbackName const
+    KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2TermBatch;
+
 /**
  ** \brief \copybrief <!--
  ** -> KIM::COMPUTE_CALLBACK_NAME::GetNumberOfComputeCallbackNames
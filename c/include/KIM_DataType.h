@@ -125,6 +125,15 @@ extern KIM_DataType const KIM_DATA_TYPE_Integer;
  **/
 extern KIM_DataType const KIM_DATA_TYPE_Double;
 
+/**
+ ** \brief \copybrief KIM::DATA_TYPE::Float
+ **
+ ** \sa KIM::DATA_TYPE::Float, kim_data_type_module::kim_data_type_float
+ **
+ ** \since 2.5
+ **/
+extern KIM_DataType const KIM_DATA_TYPE_Float;
+
 /**
  ** \brief \copybrief KIM::DATA_TYPE::GetNumberOfDataTypes
  **
@@ -263,6 +263,43 @@ typedef int KIM_GetNeighborListFunction(void * const dataObject,
                                         int * const numberOfNeighbors,
                                         int const ** const neighborsOfParticle);
 
+/**
+ ** \brief \copybrief KIM::GetNeighborListWithDisplacementsFunction
+ **
+ ** \sa KIM::GetNeighborListWithDisplacementsFunction,
+ ** kim_model_compute_arguments_module::<!--
+ ** -->kim_model_compute_arguments_get_neighbor_list_displacements
+ **
+ ** \since 2.5
+ **/
+typedef int KIM_GetNeighborListWithDisplacementsFunction(
+    void * const dataObject,
+    int const numberOfNeighborLists,
+    double const * const cutoffs,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors);
+
+/**
+ ** \brief \copybrief KIM::GetNestedNeighborListsFunction
+ **
+ ** \sa KIM::GetNestedNeighborListsFunction,
+ ** kim_model_compute_arguments_module::<!--
+ ** -->kim_model_compute_arguments_get_neighbor_lists
+ **
+ ** \since 2.5
+ **/
+typedef int
+KIM_GetNestedNeighborListsFunction(void * const dataObject,
+                                   int const numberOfNeighborLists,
+                                   double const * const cutoffs,
+                                   int const particleNumber,
+                                   int * const numberOfNeighbors,
+                                   int const ** const neighborsOfParticle);
+
 /**
  ** \brief \copybrief KIM::ProcessDEDrTermFunction
  **
@@ -294,6 +331,40 @@ typedef int KIM_ProcessD2EDr2TermFunction(void * const dataObject,
                                           int const * const i,
                                           int const * const j);
 
+/**
+ ** \brief \copybrief KIM::ProcessDEDrTermBatchFunction
+ **
+ ** \sa KIM::ProcessDEDrTermBatchFunction,
+ ** kim_model_compute_arguments_module::<!--
+ ** -->kim_model_compute_arguments_process_dedr_term_batch
+ **
+ ** \since 2.5
+ **/
+typedef int KIM_ProcessDEDrTermBatchFunction(void * const dataObject,
+                                             int const numberOfTerms,
+                                             double const * const de,
+                                             double const * const r,
+                                             double const * const dx,
+                                             int const * const i,
+                                             int const * const j);
+
+/**
+ ** \brief \copybrief KIM::ProcessD2EDr2TermBatchFunction
+ **
+ ** \sa KIM::ProcessD2EDr2TermBatchFunction,
+ ** kim_model_compute_arguments_module::<!--
+ ** -->kim_model_compute_arguments_process_d2edr2_term_batch
+ **
+ ** \since 2.5
+ **/
+typedef int KIM_ProcessD2EDr2TermBatchFunction(void * const dataObject,
+                                               int const numberOfTerms,
+                                               double const * const de,
+                                               double const * const r,
+                                               double const * const dx,
+                                               int const * const i,
+                                               int const * const j);
+
 /**
  ** \brief \copybrief KIM::ModelExtensionFunction
  **
@@ -142,6 +142,16 @@ typedef struct KIM_TimeUnit KIM_TimeUnit;
 typedef struct KIM_ComputeArguments KIM_ComputeArguments;
 #endif
 
+#ifndef KIM_PENDING_MODEL_DEFINED_
+#define KIM_PENDING_MODEL_DEFINED_
+/**
+ ** \brief Forward declaration.
+ **
+ ** \since 2.5
+ **/
+typedef struct KIM_PendingModel KIM_PendingModel;
+#endif
+
 
 #ifndef KIM_MODEL_DEFINED_
 #define KIM_MODEL_DEFINED_
@@ -172,6 +182,45 @@ int KIM_Model_Create(KIM_Numbering const numbering,
                      int * const requestedUnitsAccepted,
                      KIM_Model ** const model);
 
+/**
+ ** \brief \copybrief KIM::Model::CreateFromLibraryPath
+ **
+ ** A \c NULL \c driverLibraryPath is treated as an empty string.
+ **
+ ** \sa KIM::Model::CreateFromLibraryPath,
+ ** kim_model_module::kim_model_create_from_library_path
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_CreateFromLibraryPath(
+    KIM_Numbering const numbering,
+    KIM_LengthUnit const requestedLengthUnit,
+    KIM_EnergyUnit const requestedEnergyUnit,
+    KIM_ChargeUnit const requestedChargeUnit,
+    KIM_TemperatureUnit const requestedTemperatureUnit,
+    KIM_TimeUnit const requestedTimeUnit,
+    char const * const modelLibraryPath,
+    char const * const driverLibraryPath,
+    int * const requestedUnitsAccepted,
+    KIM_Model ** const model);
+
+/**
+ ** \brief \copybrief KIM::Model::CreateAsync
+ **
+ ** \sa KIM::Model::CreateAsync,
+ ** kim_pending_model_module::kim_model_create_async
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_CreateAsync(KIM_Numbering const numbering,
+                          KIM_LengthUnit const requestedLengthUnit,
+                          KIM_EnergyUnit const requestedEnergyUnit,
+                          KIM_ChargeUnit const requestedChargeUnit,
+                          KIM_TemperatureUnit const requestedTemperatureUnit,
+                          KIM_TimeUnit const requestedTimeUnit,
+                          char const * const modelName,
+                          KIM_PendingModel ** const pendingModel);
+
 /**
  ** \brief \copybrief KIM::Model::Destroy
  **
@@ -219,6 +268,20 @@ void KIM_Model_GetNeighborListPointers(
     double const ** const cutoffs,
     int const ** const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+/**
+ ** \brief \copybrief KIM::Model::GetSpeciesPairCutoffsPointer
+ **
+ ** \sa KIM::Model::GetSpeciesPairCutoffsPointer,
+ ** kim_model_module::kim_get_species_pair_cutoffs_extent,
+ ** kim_model_module::kim_get_species_pair_cutoffs_values
+ **
+ ** \since 2.5
+ **/
+void KIM_Model_GetSpeciesPairCutoffsPointer(
+    KIM_Model const * const model,
+    int * const numberOfSpeciesCodes,
+    double const ** const speciesPairCutoffs);
+
 /**
  ** \brief \copybrief KIM::Model::GetUnits
  **
@@ -267,6 +330,18 @@ int KIM_Model_ComputeArgumentsDestroy(
 int KIM_Model_Compute(KIM_Model const * const model,
                       KIM_ComputeArguments const * const computeArguments);
 
+/**
+ ** \brief \copybrief KIM::Model::ComputeEnsemble
+ **
+ ** \sa KIM::Model::ComputeEnsemble, kim_model_module::kim_compute_ensemble
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_ComputeEnsemble(
+    int const numberOfMembers,
+    KIM_Model * const * const models,
+    KIM_ComputeArguments const * const * const computeArguments);
+
 /**
  ** \brief \copybrief KIM::Model::Extension
  **
@@ -299,6 +374,42 @@ int KIM_Model_WriteParameterizedModel(KIM_Model const * const model,
                                       char const * const path,
                                       char const * const modelName);
 
+/**
+ ** \brief \copybrief KIM::Model::SetStatisticsEnabled
+ **
+ ** \sa KIM::Model::SetStatisticsEnabled,
+ ** kim_model_module::kim_set_statistics_enabled
+ **
+ ** \since 2.5
+ **/
+void KIM_Model_SetStatisticsEnabled(KIM_Model * const model,
+                                    int const enabled);
+
+/**
+ ** \brief \copybrief KIM::Model::GetStatistics
+ **
+ ** \sa KIM::Model::GetStatistics, kim_model_module::kim_get_statistics
+ **
+ ** \since 2.5
+ **/
+void KIM_Model_GetStatistics(KIM_Model const * const model,
+                             long * const computeCalls,
+                             double * const computeTime,
+                             long * const neighborListCalls,
+                             double * const neighborListTime,
+                             long * const neighborsServed,
+                             long * const processTermCalls,
+                             double * const processTermTime);
+
+/**
+ ** \brief \copybrief KIM::Model::ResetStatistics
+ **
+ ** \sa KIM::Model::ResetStatistics, kim_model_module::kim_reset_statistics
+ **
+ ** \since 2.5
+ **/
+void KIM_Model_ResetStatistics(KIM_Model * const model);
+
 /**
  ** \brief \copybrief KIM::Model::GetSpeciesSupportAndCode
  **
@@ -392,6 +503,105 @@ int KIM_Model_SetParameterDouble(KIM_Model * const model,
                                  int const arrayIndex,
                                  double const parameterValue);
 
+/**
+ ** \brief \copybrief KIM::Model::GetParameterArray(int const, int const,
+ **        int const, int * const) const
+ **
+ ** \sa KIM::Model::GetParameterArray(int const, int const, int const,
+ ** int * const) const,
+ ** kim_model_module::kim_get_parameter_array
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_GetParameterArrayInteger(KIM_Model const * const model,
+                                       int const parameterIndex,
+                                       int const offset,
+                                       int const count,
+                                       int * const parameterValues);
+
+/**
+ ** \brief \copybrief KIM::Model::GetParameterArray(int const, int const,
+ **        int const, int * const) const
+ **
+ ** \sa KIM::Model::GetParameterArray(int const, int const, int const,
+ ** double * const) const,
+ ** kim_model_module::kim_get_parameter_array
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_GetParameterArrayDouble(KIM_Model const * const model,
+                                      int const parameterIndex,
+                                      int const offset,
+                                      int const count,
+                                      double * const parameterValues);
+
+/**
+ ** \brief \copybrief KIM::Model::SetParameterArray(int const, int const,
+ **        int const, int const * const)
+ **
+ ** \sa KIM::Model::SetParameterArray(int const, int const, int const,
+ ** int const * const),
+ ** kim_model_module::kim_set_parameter_array
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_SetParameterArrayInteger(KIM_Model * const model,
+                                       int const parameterIndex,
+                                       int const offset,
+                                       int const count,
+                                       int const * const parameterValues);
+
+/**
+ ** \brief \copybrief KIM::Model::SetParameterArray(int const, int const,
+ **        int const, int const * const)
+ **
+ ** \sa KIM::Model::SetParameterArray(int const, int const, int const,
+ ** double const * const),
+ ** kim_model_module::kim_set_parameter_array
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_SetParameterArrayDouble(KIM_Model * const model,
+                                      int const parameterIndex,
+                                      int const offset,
+                                      int const count,
+                                      double const * const parameterValues);
+
+/**
+ ** \brief \copybrief KIM::Model::GetParameterVectorSize
+ **
+ ** \sa KIM::Model::GetParameterVectorSize,
+ ** kim_model_module::kim_get_parameter_vector_size
+ **
+ ** \since 2.5
+ **/
+void KIM_Model_GetParameterVectorSize(KIM_Model const * const model,
+                                      int * const parameterVectorSize);
+
+/**
+ ** \brief \copybrief KIM::Model::GetParameterVector
+ **
+ ** \sa KIM::Model::GetParameterVector,
+ ** kim_model_module::kim_get_parameter_vector
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_GetParameterVector(KIM_Model const * const model,
+                                 int const parameterVectorSize,
+                                 double * const parameterValues);
+
+/**
+ ** \brief \copybrief KIM::Model::SetParameterVector
+ **
+ ** \sa KIM::Model::SetParameterVector,
+ ** kim_model_module::kim_set_parameter_vector
+ **
+ ** \since 2.5
+ **/
+int KIM_Model_SetParameterVector(KIM_Model * const model,
+                                 int const parameterVectorSize,
+                                 double const * const parameterValues);
+
 /**
  ** \brief \copybrief KIM::Model::SetSimulatorBufferPointer
  **
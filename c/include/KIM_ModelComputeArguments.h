@@ -91,6 +91,51 @@ int KIM_ModelComputeArguments_GetNeighborList(
     int * const numberOfNeighbors,
     int const ** const neighborsOfParticle);
 
+/**
+ ** \brief \copybrief <!--
+ ** -->KIM::ModelComputeArguments::GetNeighborListWithDisplacements
+ **
+ ** \sa KIM::ModelComputeArguments::GetNeighborListWithDisplacements,
+ ** kim_model_compute_arguments_module::<!--
+ ** -->kim_get_neighbor_list_with_displacements
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelComputeArguments_GetNeighborListWithDisplacements(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors);
+
+/**
+ ** \brief \copybrief KIM::ModelComputeArguments::GetNeighborLists
+ **
+ ** \sa KIM::ModelComputeArguments::GetNeighborLists,
+ ** kim_model_compute_arguments_module::kim_get_neighbor_lists
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelComputeArguments_GetNeighborLists(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle);
+
+/**
+ ** \brief \copybrief KIM::ModelComputeArguments::GetNeighborNumberingOffset
+ **
+ ** \sa KIM::ModelComputeArguments::GetNeighborNumberingOffset,
+ ** kim_model_compute_arguments_module::kim_get_neighbor_numbering_offset
+ **
+ ** \since 2.5
+ **/
+void KIM_ModelComputeArguments_GetNeighborNumberingOffset(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int * const neighborNumberingOffset);
+
 /**
  ** \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTerm
  **
@@ -123,6 +168,40 @@ int KIM_ModelComputeArguments_ProcessD2EDr2Term(
     int const * const i,
     int const * const j);
 
+/**
+ ** \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTermBatch
+ **
+ ** \sa KIM::ModelComputeArguments::ProcessDEDrTermBatch,
+ ** kim_model_compute_arguments_module::kim_process_dedr_term_batch
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelComputeArguments_ProcessDEDrTermBatch(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j);
+
+/**
+ ** \brief \copybrief KIM::ModelComputeArguments::ProcessD2EDr2TermBatch
+ **
+ ** \sa KIM::ModelComputeArguments::ProcessD2EDr2TermBatch,
+ ** kim_model_compute_arguments_module::kim_process_d2edr2_term_batch
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelComputeArguments_ProcessD2EDr2TermBatch(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j);
+
 /**
  ** \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
  **
@@ -149,6 +228,19 @@ int KIM_ModelComputeArguments_GetArgumentPointerDouble(
     KIM_ComputeArgumentName const computeArgumentName,
     double ** const ptr);
 
+/**
+ ** \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
+ **
+ ** \sa KIM::ModelComputeArguments::GetArgumentPointer,
+ ** kim_model_compute_arguments_module::kim_get_argument_pointer
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelComputeArguments_GetArgumentPointerFloat(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    KIM_ComputeArgumentName const computeArgumentName,
+    float ** const ptr);
+
 /**
  ** \brief \copybrief KIM::ModelComputeArguments::IsCallbackPresent
  **
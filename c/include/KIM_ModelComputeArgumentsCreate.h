@@ -114,6 +114,20 @@ int KIM_ModelComputeArgumentsCreate_SetCallbackSupportStatus(
     KIM_ComputeCallbackName const computeCallbackName,
     KIM_SupportStatus const supportStatus);
 
+/**
+ ** \brief \copybrief <!--
+ ** -->KIM::ModelComputeArgumentsCreate::SetNeighborNumberingTranslation
+ **
+ ** \sa KIM::ModelComputeArgumentsCreate::SetNeighborNumberingTranslation,
+ ** kim_model_compute_arguments_create_module::<!--
+ ** -->kim_set_neighbor_numbering_translation
+ **
+ ** \since 2.5
+ **/
+void KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation(
+    KIM_ModelComputeArgumentsCreate * const modelComputeArgumentsCreate,
+    int const translateNeighborNumbering);
+
 /**
  ** \brief \copybrief KIM::ModelComputeArgumentsCreate::SetModelBufferPointer
  **
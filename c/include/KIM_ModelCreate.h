@@ -187,6 +187,19 @@ void KIM_ModelCreate_SetNeighborListPointers(
     double const * const cutoffs,
     int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+/**
+ ** \brief \copybrief KIM::ModelCreate::SetSpeciesPairCutoffsPointer
+ **
+ ** \sa KIM::ModelCreate::SetSpeciesPairCutoffsPointer,
+ ** kim_model_create_module::kim_set_species_pair_cutoffs_pointer
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelCreate_SetSpeciesPairCutoffsPointer(
+    KIM_ModelCreate * const modelCreate,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs);
+
 /**
  ** \brief \copybrief KIM::ModelCreate::SetRoutinePointer
  **
@@ -242,6 +242,19 @@ void KIM_ModelDriverCreate_SetNeighborListPointers(
     double const * const cutoffs,
     int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+/**
+ ** \brief \copybrief KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer
+ **
+ ** \sa KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer,
+ ** kim_model_driver_create_module::kim_set_species_pair_cutoffs_pointer
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer(
+    KIM_ModelDriverCreate * const modelDriverCreate,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs);
+
 /**
  ** \brief \copybrief KIM::ModelDriverCreate::SetRoutinePointer
  **
@@ -311,6 +324,32 @@ int KIM_ModelDriverCreate_SetParameterPointerDouble(
 void KIM_ModelDriverCreate_SetModelBufferPointer(
     KIM_ModelDriverCreate * const modelDriverCreate, void * const ptr);
 
+/**
+ ** \brief \copybrief KIM::ModelDriverCreate::DeclareSharedBuffer
+ **
+ ** \sa KIM::ModelDriverCreate::DeclareSharedBuffer,
+ ** kim_model_driver_create_module::kim_declare_shared_buffer
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelDriverCreate_DeclareSharedBuffer(
+    KIM_ModelDriverCreate * const modelDriverCreate,
+    char const * const bufferName,
+    long const numberOfBytes,
+    void ** const buffer,
+    int * const mustInitialize);
+
+/**
+ ** \brief \copybrief KIM::ModelDriverCreate::SetSharedBufferInitialized
+ **
+ ** \sa KIM::ModelDriverCreate::SetSharedBufferInitialized,
+ ** kim_model_driver_create_module::kim_set_shared_buffer_initialized
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelDriverCreate_SetSharedBufferInitialized(
+    KIM_ModelDriverCreate * const modelDriverCreate, void * const buffer);
+
 /**
  ** \brief \copybrief KIM::ModelDriverCreate::SetUnits
  **
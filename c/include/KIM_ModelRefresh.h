@@ -82,6 +82,46 @@ void KIM_ModelRefresh_SetNeighborListPointers(
     double const * const cutoffs,
     int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+/**
+ ** \brief \copybrief KIM::ModelRefresh::SetSpeciesPairCutoffsPointer
+ **
+ ** \sa KIM::ModelRefresh::SetSpeciesPairCutoffsPointer,
+ ** kim_model_refresh_module::kim_set_species_pair_cutoffs_pointer
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelRefresh_SetSpeciesPairCutoffsPointer(
+    KIM_ModelRefresh * const modelRefresh,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs);
+
+/**
+ ** \brief \copybrief KIM::ModelRefresh::GetNumberOfChangedParameterElements
+ **
+ ** \sa KIM::ModelRefresh::GetNumberOfChangedParameterElements,
+ ** kim_model_refresh_module::kim_get_number_of_changed_parameter_elements
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelRefresh_GetNumberOfChangedParameterElements(
+    KIM_ModelRefresh const * const modelRefresh,
+    int const parameterIndex,
+    int * const numberOfChangedElements);
+
+/**
+ ** \brief \copybrief KIM::ModelRefresh::GetChangedParameterElement
+ **
+ ** \sa KIM::ModelRefresh::GetChangedParameterElement,
+ ** kim_model_refresh_module::kim_get_changed_parameter_element
+ **
+ ** \since 2.5
+ **/
+int KIM_ModelRefresh_GetChangedParameterElement(
+    KIM_ModelRefresh const * const modelRefresh,
+    int const parameterIndex,
+    int const index,
+    int * const arrayIndex);
+
 /**
  ** \brief \copybrief KIM::ModelRefresh::GetModelBufferPointer
  **
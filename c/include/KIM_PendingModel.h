@@ -0,0 +1,89 @@
+/*                                                                            */
+/* KIM-API: An API for interatomic models                                     */
+/* Copyright (c) 2013--2022, Regents of the University of Minnesota.          */
+/* All rights reserved.                                                       */
+/*                                                                            */
+/* Contributors:                                                              */
+/*    Ryan S. Elliott                                                         */
+/*                                                                            */
+/* SPDX-License-Identifier: LGPL-2.1-or-later                                 */
+/*                                                                            */
+/* This library is free software; you can redistribute it and/or              */
+/* modify it under the terms of the GNU Lesser General Public                 */
+/* License as published by the Free Software Foundation; either               */
+/* version 2.1 of the License, or (at your option) any later version.         */
+/*                                                                            */
+/* This library is distributed in the hope that it will be useful,            */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of             */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU          */
+/* Lesser General Public License for more details.                            */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with this library; if not, write to the Free Software Foundation,    */
+/* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA         */
+/*                                                                            */
+
+/*                                                                            */
+/* Release: This file is part of the kim-api-2.4.1 package.                   */
+/*                                                                            */
+
+
+#ifndef KIM_PENDING_MODEL_H_
+#define KIM_PENDING_MODEL_H_
+
+/* Forward declarations */
+#ifndef KIM_MODEL_DEFINED_
+#define KIM_MODEL_DEFINED_
+/**
+ ** \brief Forward declaration.
+ **
+ ** \since 2.5
+ **/
+typedef struct KIM_Model KIM_Model;
+#endif
+
+#ifndef KIM_PENDING_MODEL_DEFINED_
+#define KIM_PENDING_MODEL_DEFINED_
+/**
+ ** \brief \copybrief KIM::PendingModel
+ **
+ ** \copydetails KIM::PendingModel
+ **
+ ** <!-- see also and since not needed here due to use of copydetails -->
+ **/
+typedef struct KIM_PendingModel KIM_PendingModel;
+#endif
+
+/**
+ ** \brief \copybrief KIM::PendingModel::Destroy
+ **
+ ** \sa KIM::PendingModel::Destroy,
+ ** kim_pending_model_module::kim_pending_model_destroy
+ **
+ ** \since 2.5
+ **/
+void KIM_PendingModel_Destroy(KIM_PendingModel ** const pendingModel);
+
+/**
+ ** \brief \copybrief KIM::PendingModel::IsComplete
+ **
+ ** \sa KIM::PendingModel::IsComplete,
+ ** kim_pending_model_module::kim_is_complete
+ **
+ ** \since 2.5
+ **/
+void KIM_PendingModel_IsComplete(KIM_PendingModel const * const pendingModel,
+                                 int * const isComplete);
+
+/**
+ ** \brief \copybrief KIM::PendingModel::Wait
+ **
+ ** \sa KIM::PendingModel::Wait, kim_pending_model_module::kim_wait
+ **
+ ** \since 2.5
+ **/
+int KIM_PendingModel_Wait(KIM_PendingModel * const pendingModel,
+                          int * const requestedUnitsAccepted,
+                          KIM_Model ** const model);
+
+#endif /* KIM_PENDING_MODEL_H_ */
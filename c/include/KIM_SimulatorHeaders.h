@@ -48,6 +48,10 @@
 #include "KIM_Model.h"
 #endif
 
+#ifndef KIM_PENDING_MODEL_H_
+#include "KIM_PendingModel.h"
+#endif
+
 #ifndef KIM_SIMULATOR_MODEL_H_
 #include "KIM_SimulatorModel.h"
 #endif
@@ -138,6 +138,14 @@ int KIM_Collections_GetItemType(KIM_Collections * const collections,
       itemName, reinterpret_cast<KIM::CollectionItemType *>(itemType));
 }
 
+int KIM_Collections_Prefetch(KIM_Collections * const collections,
+                             char const * const itemName)
+{
+  CONVERT_POINTER;
+
+  return pCollections->Prefetch(itemName);
+}
+
 int KIM_Collections_GetItemLibraryFileNameAndCollection(
     KIM_Collections * const collections,
     KIM_CollectionItemType const itemType,
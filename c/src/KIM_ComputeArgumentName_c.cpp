@@ -127,6 +127,31 @@ KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialVirial
     = {ID_partialVirial};
 KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialParticleVirial
     = {ID_partialParticleVirial};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost
+    = {ID_partialParticleCost};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_hessianBlockRowOffsets
+    = {ID_hessianBlockRowOffsets};
+KIM_ComputeArgumentName const
+    KIM_COMPUTE_ARGUMENT_NAME_hessianBlockColumnIndices
+    = {ID_hessianBlockColumnIndices};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialHessianBlocks
+    = {ID_partialHessianBlocks};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesFloat
+    = {ID_coordinatesFloat};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesFloat
+    = {ID_partialForcesFloat};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesX
+    = {ID_coordinatesX};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesY
+    = {ID_coordinatesY};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_coordinatesZ
+    = {ID_coordinatesZ};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesX
+    = {ID_partialForcesX};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesY
+    = {ID_partialForcesY};
+KIM_ComputeArgumentName const KIM_COMPUTE_ARGUMENT_NAME_partialForcesZ
+    = {ID_partialForcesZ};
 
 void KIM_COMPUTE_ARGUMENT_NAME_GetNumberOfComputeArgumentNames(
     int * const numberOfComputeArgumentNames)
@@ -189,6 +189,18 @@ int KIM_ComputeArguments_SetArgumentPointerDouble(
   return pComputeArguments->SetArgumentPointer(argN, ptr);
 }
 
+int KIM_ComputeArguments_SetArgumentPointerFloat(
+    KIM_ComputeArguments * const computeArguments,
+    KIM_ComputeArgumentName const computeArgumentName,
+    float const * const ptr)
+{
+  CONVERT_POINTER;
+  KIM::ComputeArgumentName argN
+      = makeComputeArgumentNameCpp(computeArgumentName);
+
+  return pComputeArguments->SetArgumentPointer(argN, ptr);
+}
+
 int KIM_ComputeArguments_SetCallbackPointer(
     KIM_ComputeArguments * const computeArguments,
     KIM_ComputeCallbackName const computeCallbackName,
@@ -99,6 +99,15 @@ KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTerm
     = {ID_ProcessDEDrTerm};
 KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2Term
     = {ID_ProcessD2EDr2Term};
+KIM_ComputeCallbackName const
+    KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements
+    = {ID_GetNeighborListWithDisplacements};
+KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_GetNestedNeighborLists
+    = {ID_GetNestedNeighborLists};
+KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTermBatch
+    = {ID_ProcessDEDrTermBatch};
+KIM_ComputeCallbackName const KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2TermBatch
+    = {ID_ProcessD2EDr2TermBatch};
 
 void KIM_COMPUTE_CALLBACK_NAME_GetNumberOfComputeCallbackNames(
     int * const numberOfComputeCallbackNames)
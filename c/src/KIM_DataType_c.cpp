@@ -86,6 +86,7 @@ char const * KIM_DataType_ToString(KIM_DataType const dataType)
 #include "KIM_DataType.inc"
 KIM_DataType const KIM_DATA_TYPE_Integer = {ID_Integer};
 KIM_DataType const KIM_DATA_TYPE_Double = {ID_Double};
+KIM_DataType const KIM_DATA_TYPE_Float = {ID_Float};
 
 void KIM_DATA_TYPE_GetNumberOfDataTypes(int * const numberOfDataTypes)
 {
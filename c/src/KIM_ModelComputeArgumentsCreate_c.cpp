@@ -136,6 +136,16 @@ int KIM_ModelComputeArgumentsCreate_SetCallbackSupportStatus(
       makeSupportStatusCpp(supportStatus));
 }
 
+void KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation(
+    KIM_ModelComputeArgumentsCreate * const modelComputeArgumentsCreate,
+    int const translateNeighborNumbering)
+{
+  CONVERT_POINTER;
+
+  pModelComputeArgumentsCreate->SetNeighborNumberingTranslation(
+      translateNeighborNumbering);
+}
+
 void KIM_ModelComputeArgumentsCreate_SetModelBufferPointer(
     KIM_ModelComputeArgumentsCreate * const modelComputeArgumentsCreate,
     void * const ptr)
@@ -114,6 +114,47 @@ int KIM_ModelComputeArguments_GetNeighborList(
                                                  neighborsOfParticle);
 }
 
+int KIM_ModelComputeArguments_GetNeighborListWithDisplacements(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors)
+{
+  CONVERT_POINTER;
+
+  return pModelComputeArguments->GetNeighborListWithDisplacements(
+      neighborListIndex,
+      particleNumber,
+      numberOfNeighbors,
+      neighborsOfParticle,
+      displacementsOfNeighbors,
+      squaredDistancesOfNeighbors);
+}
+
+int KIM_ModelComputeArguments_GetNeighborLists(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle)
+{
+  CONVERT_POINTER;
+
+  return pModelComputeArguments->GetNeighborLists(
+      particleNumber, numberOfNeighbors, neighborsOfParticle);
+}
+
+void KIM_ModelComputeArguments_GetNeighborNumberingOffset(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int * const neighborNumberingOffset)
+{
+  CONVERT_POINTER;
+
+  pModelComputeArguments->GetNeighborNumberingOffset(neighborNumberingOffset);
+}
+
 int KIM_ModelComputeArguments_ProcessDEDrTerm(
     KIM_ModelComputeArguments const * const modelComputeArguments,
     double const de,
@@ -140,6 +181,36 @@ int KIM_ModelComputeArguments_ProcessD2EDr2Term(
   return pModelComputeArguments->ProcessD2EDr2Term(de, r, dx, i, j);
 }
 
+int KIM_ModelComputeArguments_ProcessDEDrTermBatch(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j)
+{
+  CONVERT_POINTER;
+
+  return pModelComputeArguments->ProcessDEDrTermBatch(
+      numberOfTerms, de, r, dx, i, j);
+}
+
+int KIM_ModelComputeArguments_ProcessD2EDr2TermBatch(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j)
+{
+  CONVERT_POINTER;
+
+  return pModelComputeArguments->ProcessD2EDr2TermBatch(
+      numberOfTerms, de, r, dx, i, j);
+}
+
 int KIM_ModelComputeArguments_GetArgumentPointerInteger(
     KIM_ModelComputeArguments const * const modelComputeArguments,
     KIM_ComputeArgumentName const computeArgumentName,
@@ -162,6 +233,17 @@ int KIM_ModelComputeArguments_GetArgumentPointerDouble(
       makeComputeArgumentNameCpp(computeArgumentName), ptr);
 }
 
+int KIM_ModelComputeArguments_GetArgumentPointerFloat(
+    KIM_ModelComputeArguments const * const modelComputeArguments,
+    KIM_ComputeArgumentName const computeArgumentName,
+    float ** const ptr)
+{
+  CONVERT_POINTER;
+
+  return pModelComputeArguments->GetArgumentPointer(
+      makeComputeArgumentNameCpp(computeArgumentName), ptr);
+}
+
 int KIM_ModelComputeArguments_IsCallbackPresent(
     KIM_ModelComputeArguments const * const modelComputeArguments,
     KIM_ComputeCallbackName const computeCallbackName,
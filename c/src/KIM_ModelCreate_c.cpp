@@ -189,6 +189,17 @@ void KIM_ModelCreate_SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int KIM_ModelCreate_SetSpeciesPairCutoffsPointer(
+    KIM_ModelCreate * const modelCreate,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pModelCreate->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                                    speciesPairCutoffs);
+}
+
 int KIM_ModelCreate_SetRoutinePointer(
     KIM_ModelCreate * const modelCreate,
     KIM_ModelRoutineName const modelRoutineName,
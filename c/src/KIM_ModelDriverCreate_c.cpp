@@ -262,6 +262,17 @@ void KIM_ModelDriverCreate_SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer(
+    KIM_ModelDriverCreate * const modelDriverCreate,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pModelDriverCreate->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                                          speciesPairCutoffs);
+}
+
 int KIM_ModelDriverCreate_SetRoutinePointer(
     KIM_ModelDriverCreate * const modelDriverCreate,
     KIM_ModelRoutineName const modelRoutineName,
@@ -322,6 +333,27 @@ void KIM_ModelDriverCreate_SetModelBufferPointer(
   pModelDriverCreate->SetModelBufferPointer(ptr);
 }
 
+int KIM_ModelDriverCreate_DeclareSharedBuffer(
+    KIM_ModelDriverCreate * const modelDriverCreate,
+    char const * const bufferName,
+    long const numberOfBytes,
+    void ** const buffer,
+    int * const mustInitialize)
+{
+  CONVERT_POINTER;
+
+  return pModelDriverCreate->DeclareSharedBuffer(
+      bufferName, numberOfBytes, buffer, mustInitialize);
+}
+
+int KIM_ModelDriverCreate_SetSharedBufferInitialized(
+    KIM_ModelDriverCreate * const modelDriverCreate, void * const buffer)
+{
+  CONVERT_POINTER;
+
+  return pModelDriverCreate->SetSharedBufferInitialized(buffer);
+}
+
 int KIM_ModelDriverCreate_SetUnits(
     KIM_ModelDriverCreate * const modelDriverCreate,
     KIM_LengthUnit const lengthUnit,
@@ -90,6 +90,40 @@ void KIM_ModelRefresh_SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int KIM_ModelRefresh_SetSpeciesPairCutoffsPointer(
+    KIM_ModelRefresh * const modelRefresh,
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pModelRefresh->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                                     speciesPairCutoffs);
+}
+
+int KIM_ModelRefresh_GetNumberOfChangedParameterElements(
+    KIM_ModelRefresh const * const modelRefresh,
+    int const parameterIndex,
+    int * const numberOfChangedElements)
+{
+  CONVERT_POINTER;
+
+  return pModelRefresh->GetNumberOfChangedParameterElements(
+      parameterIndex, numberOfChangedElements);
+}
+
+int KIM_ModelRefresh_GetChangedParameterElement(
+    KIM_ModelRefresh const * const modelRefresh,
+    int const parameterIndex,
+    int const index,
+    int * const arrayIndex)
+{
+  CONVERT_POINTER;
+
+  return pModelRefresh->GetChangedParameterElement(
+      parameterIndex, index, arrayIndex);
+}
+
 void KIM_ModelRefresh_GetModelBufferPointer(
     KIM_ModelRefresh const * const modelRefresh, void ** const ptr)
 {
@@ -30,6 +30,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #ifndef KIM_LOG_VERBOSITY_HPP_
 #include "KIM_LogVerbosity.hpp"
@@ -88,6 +89,10 @@ extern "C" {
 #ifndef KIM_MODEL_HPP_
 #include "KIM_Model.hpp"
 #endif
+
+#ifndef KIM_PENDING_MODEL_HPP_
+#include "KIM_PendingModel.hpp"
+#endif
 extern "C" {
 #ifndef KIM_MODEL_H_
 #include "KIM_Model.h"
@@ -112,6 +117,11 @@ struct KIM_Model
   void * p;
 };
 
+struct KIM_PendingModel
+{
+  void * p;
+};
+
 #define CONVERT_POINTER \
   KIM::Model * pModel = reinterpret_cast<KIM::Model *>(model->p)
 
@@ -209,6 +219,79 @@ int KIM_Model_Create(KIM_Numbering const numbering,
   }
 }
 
+int KIM_Model_CreateFromLibraryPath(
+    KIM_Numbering const numbering,
+    KIM_LengthUnit const requestedLengthUnit,
+    KIM_EnergyUnit const requestedEnergyUnit,
+    KIM_ChargeUnit const requestedChargeUnit,
+    KIM_TemperatureUnit const requestedTemperatureUnit,
+    KIM_TimeUnit const requestedTimeUnit,
+    char const * const modelLibraryPath,
+    char const * const driverLibraryPath,
+    int * const requestedUnitsAccepted,
+    KIM_Model ** const model)
+{
+  std::string modelLibraryPathC(modelLibraryPath);
+  std::string driverLibraryPathC(
+      (driverLibraryPath == NULL) ? "" : driverLibraryPath);
+  KIM::Model * pModel;
+  int error = KIM::Model::CreateFromLibraryPath(
+      makeNumberingCpp(numbering),
+      makeLengthUnitCpp(requestedLengthUnit),
+      makeEnergyUnitCpp(requestedEnergyUnit),
+      makeChargeUnitCpp(requestedChargeUnit),
+      makeTemperatureUnitCpp(requestedTemperatureUnit),
+      makeTimeUnitCpp(requestedTimeUnit),
+      modelLibraryPathC,
+      driverLibraryPathC,
+      requestedUnitsAccepted,
+      &pModel);
+  if (error)
+  {
+    *model = NULL;
+    return true;
+  }
+  else
+  {
+    (*model) = new KIM_Model;
+    (*model)->p = (void *) pModel;
+    return false;
+  }
+}
+
+int KIM_Model_CreateAsync(KIM_Numbering const numbering,
+                          KIM_LengthUnit const requestedLengthUnit,
+                          KIM_EnergyUnit const requestedEnergyUnit,
+                          KIM_ChargeUnit const requestedChargeUnit,
+                          KIM_TemperatureUnit const requestedTemperatureUnit,
+                          KIM_TimeUnit const requestedTimeUnit,
+                          char const * const modelName,
+                          KIM_PendingModel ** const pendingModel)
+{
+  std::string modelNameC(modelName);
+  KIM::PendingModel * pPendingModel;
+  int error = KIM::Model::CreateAsync(
+      makeNumberingCpp(numbering),
+      makeLengthUnitCpp(requestedLengthUnit),
+      makeEnergyUnitCpp(requestedEnergyUnit),
+      makeChargeUnitCpp(requestedChargeUnit),
+      makeTemperatureUnitCpp(requestedTemperatureUnit),
+      makeTimeUnitCpp(requestedTimeUnit),
+      modelNameC,
+      &pPendingModel);
+  if (error)
+  {
+    *pendingModel = NULL;
+    return true;
+  }
+  else
+  {
+    (*pendingModel) = new KIM_PendingModel;
+    (*pendingModel)->p = (void *) pPendingModel;
+    return false;
+  }
+}
+
 void KIM_Model_Destroy(KIM_Model ** const model)
 {
   if (*model != NULL)
@@ -254,6 +337,17 @@ void KIM_Model_GetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+void KIM_Model_GetSpeciesPairCutoffsPointer(
+    KIM_Model const * const model,
+    int * const numberOfSpeciesCodes,
+    double const ** const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  pModel->GetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                       speciesPairCutoffs);
+}
+
 void KIM_Model_GetUnits(KIM_Model const * const model,
                         KIM_LengthUnit * const lengthUnit,
                         KIM_EnergyUnit * const energyUnit,
@@ -322,6 +416,27 @@ int KIM_Model_Compute(KIM_Model const * const model,
   return pModel->Compute(pComputeArguments);
 }
 
+int KIM_Model_ComputeEnsemble(
+    int const numberOfMembers,
+    KIM_Model * const * const models,
+    KIM_ComputeArguments const * const * const computeArguments)
+{
+  if (numberOfMembers < 1) return true;
+
+  std::vector<KIM::Model *> pModels(numberOfMembers);
+  std::vector<KIM::ComputeArguments const *> pComputeArguments(
+      numberOfMembers);
+  for (int i = 0; i < numberOfMembers; ++i)
+  {
+    pModels[i] = reinterpret_cast<KIM::Model *>(models[i]->p);
+    pComputeArguments[i] = reinterpret_cast<KIM::ComputeArguments const *>(
+        computeArguments[i]->p);
+  }
+
+  return KIM::Model::ComputeEnsemble(
+      numberOfMembers, &(pModels[0]), &(pComputeArguments[0]));
+}
+
 int KIM_Model_Extension(KIM_Model * const model,
                         char const * const extensionID,
                         void * const extensionStructure)
@@ -348,6 +463,41 @@ int KIM_Model_WriteParameterizedModel(KIM_Model const * const model,
   return pModel->WriteParameterizedModel(path, modelName);
 }
 
+void KIM_Model_SetStatisticsEnabled(KIM_Model * const model,
+                                    int const enabled)
+{
+  CONVERT_POINTER;
+
+  pModel->SetStatisticsEnabled(enabled);
+}
+
+void KIM_Model_GetStatistics(KIM_Model const * const model,
+                             long * const computeCalls,
+                             double * const computeTime,
+                             long * const neighborListCalls,
+                             double * const neighborListTime,
+                             long * const neighborsServed,
+                             long * const processTermCalls,
+                             double * const processTermTime)
+{
+  CONVERT_POINTER;
+
+  pModel->GetStatistics(computeCalls,
+                        computeTime,
+                        neighborListCalls,
+                        neighborListTime,
+                        neighborsServed,
+                        processTermCalls,
+                        processTermTime);
+}
+
+void KIM_Model_ResetStatistics(KIM_Model * const model)
+{
+  CONVERT_POINTER;
+
+  pModel->ResetStatistics();
+}
+
 int KIM_Model_GetSpeciesSupportAndCode(KIM_Model const * const model,
                                        KIM_SpeciesName const speciesName,
                                        int * const speciesIsSupported,
@@ -451,6 +601,80 @@ int KIM_Model_SetParameterDouble(KIM_Model * const model,
   return pModel->SetParameter(parameterIndex, arrayIndex, parameterValue);
 }
 
+int KIM_Model_GetParameterArrayInteger(KIM_Model const * const model,
+                                       int const parameterIndex,
+                                       int const offset,
+                                       int const count,
+                                       int * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->GetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int KIM_Model_GetParameterArrayDouble(KIM_Model const * const model,
+                                      int const parameterIndex,
+                                      int const offset,
+                                      int const count,
+                                      double * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->GetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int KIM_Model_SetParameterArrayInteger(KIM_Model * const model,
+                                       int const parameterIndex,
+                                       int const offset,
+                                       int const count,
+                                       int const * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->SetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int KIM_Model_SetParameterArrayDouble(KIM_Model * const model,
+                                      int const parameterIndex,
+                                      int const offset,
+                                      int const count,
+                                      double const * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->SetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+void KIM_Model_GetParameterVectorSize(KIM_Model const * const model,
+                                      int * const parameterVectorSize)
+{
+  CONVERT_POINTER;
+
+  pModel->GetParameterVectorSize(parameterVectorSize);
+}
+
+int KIM_Model_GetParameterVector(KIM_Model const * const model,
+                                 int const parameterVectorSize,
+                                 double * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->GetParameterVector(parameterVectorSize, parameterValues);
+}
+
+int KIM_Model_SetParameterVector(KIM_Model * const model,
+                                 int const parameterVectorSize,
+                                 double const * const parameterValues)
+{
+  CONVERT_POINTER;
+
+  return pModel->SetParameterVector(parameterVectorSize, parameterValues);
+}
+
 void KIM_Model_SetSimulatorBufferPointer(KIM_Model * const model,
                                          void * const ptr)
 {
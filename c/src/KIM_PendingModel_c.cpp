@@ -0,0 +1,104 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include <cstddef>
+
+#ifndef KIM_MODEL_HPP_
+#include "KIM_Model.hpp"
+#endif
+
+#ifndef KIM_PENDING_MODEL_HPP_
+#include "KIM_PendingModel.hpp"
+#endif
+extern "C" {
+#ifndef KIM_PENDING_MODEL_H_
+#include "KIM_PendingModel.h"
+#endif
+}  // extern "C"
+
+
+struct KIM_Model
+{
+  void * p;
+};
+
+struct KIM_PendingModel
+{
+  void * p;
+};
+
+#define CONVERT_POINTER             \
+  KIM::PendingModel * pPendingModel \
+      = reinterpret_cast<KIM::PendingModel *>(pendingModel->p)
+
+extern "C" {
+void KIM_PendingModel_Destroy(KIM_PendingModel ** const pendingModel)
+{
+  if (*pendingModel != NULL)
+  {
+    KIM::PendingModel * pPendingModel
+        = reinterpret_cast<KIM::PendingModel *>((*pendingModel)->p);
+
+    KIM::PendingModel::Destroy(&pPendingModel);
+  }
+  delete (*pendingModel);
+  *pendingModel = NULL;
+}
+
+void KIM_PendingModel_IsComplete(KIM_PendingModel const * const pendingModel,
+                                 int * const isComplete)
+{
+  CONVERT_POINTER;
+
+  pPendingModel->IsComplete(isComplete);
+}
+
+int KIM_PendingModel_Wait(KIM_PendingModel * const pendingModel,
+                          int * const requestedUnitsAccepted,
+                          KIM_Model ** const model)
+{
+  CONVERT_POINTER;
+
+  KIM::Model * pModel;
+  int error = pPendingModel->Wait(requestedUnitsAccepted, &pModel);
+  if (error)
+  {
+    *model = NULL;
+    return true;
+  }
+  else
+  {
+    (*model) = new KIM_Model;
+    (*model)->p = (void *) pModel;
+    return false;
+  }
+}
+
+}  // extern "C"
@@ -97,6 +97,12 @@ struct SharedLibrarySchemaV1
   EmbeddedFile const * const parameterFiles;
   EmbeddedFile const * const metadataFile;
 };  // struct SharedLibrarySchemaV1
+
+// Adds an item that is linked statically into the executable to the registry
+// that is searched before the KIM API Collections.  Called during static
+// initialization by the code that kim_api_link_static_items() generates.
+// Returns true if an item of the same type and name is already registered.
+int RegisterStaticItem(SharedLibrarySchemaV2 const * const schema);
 }  // namespace SHARED_LIBRARY_SCHEMA
 }  // namespace KIM
 
@@ -65,6 +65,16 @@ string(TOUPPER ${_KIM_API_ENVIRONMENT_CONFIGURATION_FILE} _KIM_API_ENVIRONMENT_C
 set(KIM_API_ENVIRONMENT_CONFIGURATION_FILE "${_KIM_API_ENVIRONMENT_CONFIGURATION_FILE}" CACHE INTERNAL "Configuration file environment variable name")
 unset(_KIM_API_ENVIRONMENT_CONFIGURATION_FILE)
 #
+string(MAKE_C_IDENTIFIER "${PROJECT_NAME}_TRACE_FILE" _KIM_API_ENVIRONMENT_TRACE_FILE)
+string(TOUPPER ${_KIM_API_ENVIRONMENT_TRACE_FILE} _KIM_API_ENVIRONMENT_TRACE_FILE)
+set(KIM_API_ENVIRONMENT_TRACE_FILE "${_KIM_API_ENVIRONMENT_TRACE_FILE}" CACHE INTERNAL "Trace file environment variable name")
+unset(_KIM_API_ENVIRONMENT_TRACE_FILE)
+#
+string(MAKE_C_IDENTIFIER "${PROJECT_NAME}_SHARED_MEMORY" _KIM_API_ENVIRONMENT_SHARED_MEMORY)
+string(TOUPPER ${_KIM_API_ENVIRONMENT_SHARED_MEMORY} _KIM_API_ENVIRONMENT_SHARED_MEMORY)
+set(KIM_API_ENVIRONMENT_SHARED_MEMORY "${_KIM_API_ENVIRONMENT_SHARED_MEMORY}" CACHE INTERNAL "Shared model buffers environment variable name")
+unset(_KIM_API_ENVIRONMENT_SHARED_MEMORY)
+#
 string(MAKE_C_IDENTIFIER "KIM_API_CMAKE_PREFIX_DIR" _KIM_API_ENVIRONMENT_CMAKE_PREFIX_DIR)  # should _not_ use PROJECT_NAME here
 string(TOUPPER ${_KIM_API_ENVIRONMENT_CMAKE_PREFIX_DIR} _KIM_API_ENVIRONMENT_CMAKE_PREFIX_DIR)
 set(KIM_API_ENVIRONMENT_CMAKE_PREFIX_DIR "${_KIM_API_ENVIRONMENT_CMAKE_PREFIX_DIR}" CACHE INTERNAL "CMake prefix dir environment variable name")
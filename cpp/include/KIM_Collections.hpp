@@ -162,8 +162,35 @@ class Collections
   int GetItemType(std::string const & itemName,
                   CollectionItemType * const itemType) const;
 
+  /// \brief Warm the %KIM API's process-wide registry of items for an item
+  /// that will be needed later.
+  ///
+  /// Finds the item, opens its library, and pages in its embedded parameter
+  /// files.  If the item is a parameterized Portable Model, its %Model Driver
+  /// is prefetched as well.  The library remains loaded until the process
+  /// exits, and later searches for the item, including those performed by
+  /// Model::Create and Model::CreateAsync, return the prefetched library
+  /// without searching the collections.  Call once for each item of a
+  /// workflow.
+  ///
+  /// \param[in]  itemName The name of the item to be prefetched.
+  ///
+  /// \return \c true if an item with the specified name cannot be found.
+  /// \return \c true if the item's library cannot be opened.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Collections_Prefetch, kim_collections_module::kim_prefetch
+  ///
+  /// \since 2.5
+  int Prefetch(std::string const & itemName);
+
   /// \brief Get the item's library file name and its KIM::Collection.
   ///
+  /// Items linked statically into the executable (see the
+  /// kim_api_link_static_items() CMake function) are found first.  They are
+  /// reported as part of the system collection, with a file name of the form
+  /// \c static:<itemType>/<itemName> that does not refer to a file.
+  ///
   /// \param[in]  itemType The KIM::CollectionItemType of the item.
   /// \param[in]  itemName The name of the item.
   /// \param[out] fileName The absolute file and path name of the item's
@@ -230,6 +230,175 @@ extern ComputeArgumentName const partialVirial;
 /// \since 2.0
 extern ComputeArgumentName const partialParticleVirial;
 
+/// \brief The standard \c partialParticleCost argument.
+///
+/// A relative estimate of the computational work associated with each
+/// contributing particle (for example, the number of neighbor pairs evaluated
+/// within the cutoff), intended for dynamic load balancing.  Values are
+/// dimensionless and only meaningful relative to one another.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_particle_cost
+///
+/// \since 2.5
+extern ComputeArgumentName const partialParticleCost;
+
+/// \brief The standard \c hessianBlockRowOffsets argument.
+///
+/// Row offsets of the compressed sparse row (CSR) pattern of the blocks
+/// stored in the \c partialHessianBlocks argument.  The blocks of row \c i
+/// are stored at positions `hessianBlockRowOffsets[i]` to
+/// `hessianBlockRowOffsets[i+1] - 1`.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_hessianBlockRowOffsets,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_hessian_block_row_offsets
+///
+/// \since 2.5
+extern ComputeArgumentName const hessianBlockRowOffsets;
+
+/// \brief The standard \c hessianBlockColumnIndices argument.
+///
+/// Column (particle) indices of the CSR pattern of the blocks stored in the
+/// \c partialHessianBlocks argument.  Only the upper blocks are stored, so
+/// each column index is greater than or equal to its row index, and the
+/// column indices of each row must be in increasing order.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_hessianBlockColumnIndices,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_hessian_block_column_indices
+///
+/// \since 2.5
+extern ComputeArgumentName const hessianBlockColumnIndices;
+
+/// \brief The standard \c partialHessianBlocks argument.
+///
+/// The 3x3 blocks of the Hessian of the partial energy, in the CSR pattern
+/// given by the \c hessianBlockRowOffsets and \c hessianBlockColumnIndices
+/// arguments.  The Hessian is symmetric, so only the blocks on and above the
+/// block diagonal are stored.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialHessianBlocks,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_hessian_blocks
+///
+/// \since 2.5
+extern ComputeArgumentName const partialHessianBlocks;
+
+/// \brief The single-precision variant of the \c coordinates argument.
+///
+/// A simulator may provide this argument instead of \c coordinates when the
+/// Model's support status for it is not SUPPORT_STATUS::notSupported.  It
+/// then satisfies the requirement for \c coordinates.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_coordinatesFloat,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_coordinates_float
+///
+/// \since 2.5
+extern ComputeArgumentName const coordinatesFloat;
+
+/// \brief The single-precision variant of the \c partialForces argument.
+///
+/// A simulator may provide this argument instead of \c partialForces when
+/// the Model's support status for it is not SUPPORT_STATUS::notSupported.  It
+/// then satisfies a requirement for \c partialForces.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialForcesFloat,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_forces_float
+///
+/// \since 2.5
+extern ComputeArgumentName const partialForcesFloat;
+
+/// \brief The standard \c coordinatesX argument.
+///
+/// The x components of the particles' coordinates, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of \c coordinatesX,
+/// \c coordinatesY, and \c coordinatesZ is not SUPPORT_STATUS::notSupported,
+/// a simulator may provide the three arrays instead of \c coordinates.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_coordinatesX,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_coordinates_x
+///
+/// \since 2.5
+extern ComputeArgumentName const coordinatesX;
+
+/// \brief The standard \c coordinatesY argument.
+///
+/// The y components of the particles' coordinates, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of \c coordinatesX,
+/// \c coordinatesY, and \c coordinatesZ is not SUPPORT_STATUS::notSupported,
+/// a simulator may provide the three arrays instead of \c coordinates.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_coordinatesY,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_coordinates_y
+///
+/// \since 2.5
+extern ComputeArgumentName const coordinatesY;
+
+/// \brief The standard \c coordinatesZ argument.
+///
+/// The z components of the particles' coordinates, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of \c coordinatesX,
+/// \c coordinatesY, and \c coordinatesZ is not SUPPORT_STATUS::notSupported,
+/// a simulator may provide the three arrays instead of \c coordinates.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_coordinatesZ,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_coordinates_z
+///
+/// \since 2.5
+extern ComputeArgumentName const coordinatesZ;
+
+/// \brief The standard \c partialForcesX argument.
+///
+/// The x components of the partial forces, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of
+/// \c partialForcesX, \c partialForcesY, and \c partialForcesZ is not
+/// SUPPORT_STATUS::notSupported, a simulator may provide the three arrays
+/// instead of \c partialForces.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialForcesX,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_forces_x
+///
+/// \since 2.5
+extern ComputeArgumentName const partialForcesX;
+
+/// \brief The standard \c partialForcesY argument.
+///
+/// The y components of the partial forces, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of
+/// \c partialForcesX, \c partialForcesY, and \c partialForcesZ is not
+/// SUPPORT_STATUS::notSupported, a simulator may provide the three arrays
+/// instead of \c partialForces.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialForcesY,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_forces_y
+///
+/// \since 2.5
+extern ComputeArgumentName const partialForcesY;
+
+/// \brief The standard \c partialForcesZ argument.
+///
+/// The z components of the partial forces, in a structure-of-arrays
+/// layout.  When the Model's support status for all three of
+/// \c partialForcesX, \c partialForcesY, and \c partialForcesZ is not
+/// SUPPORT_STATUS::notSupported, a simulator may provide the three arrays
+/// instead of \c partialForces.
+///
+/// \sa KIM_COMPUTE_ARGUMENT_NAME_partialForcesZ,
+/// kim_compute_argument_name_module::<!--
+/// -->kim_compute_argument_name_partial_forces_z
+///
+/// \since 2.5
+extern ComputeArgumentName const partialForcesZ;
+
 
 /// \brief Get the number of standard ComputeArgumentName's defined by the %KIM
 /// API.
@@ -103,6 +103,7 @@ class ComputeArguments
   ///
   /// \sa KIM_ComputeArguments_SetArgumentPointerInteger,
   ///     KIM_ComputeArguments_SetArgumentPointerDouble,
+  ///     KIM_ComputeArguments_SetArgumentPointerFloat,
   ///     kim_compute_arguments_module::kim_set_argument_pointer
   ///
   /// \since 2.0
@@ -121,6 +122,18 @@ class ComputeArguments
   int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
                          double * const ptr);
 
+  /// \overload
+  ///
+  /// \since 2.5
+  int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float const * const ptr);
+
+  /// \overload
+  ///
+  /// \since 2.5
+  int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float * const ptr);
+
   /// \brief Set the function pointer for a ComputeCallbackName.
   ///
   /// \todo Add more detailed description what it means to provide a NULL or
@@ -174,6 +174,81 @@ extern ComputeCallbackName const ProcessDEDrTerm;
 /// \since 2.0
 extern ComputeCallbackName const ProcessD2EDr2Term;
 
+/// \brief The optional \c GetNeighborListWithDisplacements callback.
+///
+/// An extended form of the \c GetNeighborList callback that, in addition to
+/// the neighbors of a particle, provides the relative position vector of each
+/// neighbor and, optionally, its squared distance.  Simulators that already
+/// compute these quantities while building their neighbor lists may provide
+/// this callback so that Models can avoid recomputing them.  The \c
+/// GetNeighborList callback must still be provided.
+///
+/// The C++ prototype for this routine is
+/// GetNeighborListWithDisplacementsFunction().  The C prototype for this
+/// routine is KIM_GetNeighborListWithDisplacementsFunction().
+///
+/// \sa KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements,
+/// kim_compute_callback_name_module::<!--
+/// -->kim_compute_callback_name_get_neighbor_list_with_displacements
+///
+/// \since 2.5
+extern ComputeCallbackName const GetNeighborListWithDisplacements;
+
+/// \brief The optional \c GetNestedNeighborLists callback.
+///
+/// Provides all neighbor lists of a particle at once, as a single master list
+/// sorted by increasing distance together with the number of its leading
+/// entries that make up the list for each cutoff.  When this callback is
+/// provided, ModelComputeArguments::GetNeighborList returns a prefix of the
+/// master list without calling the \c GetNeighborList callback.  Requests
+/// for the other lists of the same particle reuse the master list, so the
+/// callback is called once per particle within a Model::Compute call.  The
+/// \c GetNeighborList callback must still be provided.
+///
+/// The C++ prototype for this routine is GetNestedNeighborListsFunction().
+/// The C prototype for this routine is KIM_GetNestedNeighborListsFunction().
+///
+/// \sa KIM_COMPUTE_CALLBACK_NAME_GetNestedNeighborLists,
+/// kim_compute_callback_name_module::<!--
+/// -->kim_compute_callback_name_get_nested_neighbor_lists
+///
+/// \since 2.5
+extern ComputeCallbackName const GetNestedNeighborLists;
+
+/// \brief The optional \c ProcessDEDrTermBatch callback.
+///
+/// A batched form of the \c ProcessDEDrTerm callback that receives an array
+/// of terms in a single call.  When a Simulator provides this callback,
+/// ModelComputeArguments::ProcessDEDrTermBatch passes a Model's terms to it
+/// directly, and ModelComputeArguments::ProcessDEDrTerm uses it (with a single
+/// term) if the \c ProcessDEDrTerm callback is not provided.
+///
+/// The C++ prototype for this routine is ProcessDEDrTermBatchFunction().  The
+/// C prototype for this routine is KIM_ProcessDEDrTermBatchFunction().
+///
+/// \sa KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTermBatch,
+/// kim_compute_callback_name_module::<!--
+/// -->kim_compute_callback_name_process_dedr_term_batch
+///
+/// \since 2.5
+extern ComputeCallbackName const ProcessDEDrTermBatch;
+
+/// \brief The optional \c ProcessD2EDr2TermBatch callback.
+///
+/// A batched form of the \c ProcessD2EDr2Term callback that receives an array
+/// of terms in a single call.  It relates to \c ProcessD2EDr2Term as \c
+/// ProcessDEDrTermBatch relates to \c ProcessDEDrTerm.
+///
+/// The C++ prototype for this routine is ProcessD2EDr2TermBatchFunction().
+/// The C prototype for this routine is KIM_ProcessD2EDr2TermBatchFunction().
+///
+/// \sa KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2TermBatch,
+/// kim_compute_callback_name_module::<!--
+/// -->kim_compute_callback_name_process_d2edr2_term_batch
+///
+/// \since 2.5
+extern ComputeCallbackName const ProcessD2EDr2TermBatch;
+
 
 /// \brief Get the number of standard ComputeCallbackName's defined by the %KIM
 /// API.
@@ -0,0 +1,70 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_COMPUTE_ENSEMBLE_HPP_
+#define KIM_COMPUTE_ENSEMBLE_HPP_
+
+#define KIM_COMPUTE_ENSEMBLE_ID "KIM_ComputeEnsemble"
+
+namespace KIM
+{
+// Forward declarations
+class ModelCompute;
+class ModelComputeArguments;
+
+/// \brief The extension used by Model::ComputeEnsemble to evaluate several
+/// Model objects that share a model driver in a single pass.
+///
+/// A C++ model driver that lists \c KIM_COMPUTE_ENSEMBLE_ID among its
+/// SupportedExtensions receives this structure in its
+/// MODEL_ROUTINE_NAME::Extension routine.  The routine is called through the
+/// first member.  Every member's ComputeArguments has the same input
+/// arguments and callbacks as the first member's, so the driver may traverse
+/// the neighbor lists of the first member once and accumulate the results of
+/// each member into that member's own output arguments.
+///
+/// \sa Model::ComputeEnsemble
+///
+/// \since 2.5
+struct ComputeEnsemble
+{
+  /// The number of members in the ensemble.
+  int numberOfMembers;
+
+  /// The ModelCompute interface of each member, providing access to its
+  /// model buffer.
+  ModelCompute const * const * modelCompute;
+
+  /// The ModelComputeArguments interface of each member.
+  ModelComputeArguments const * const * modelComputeArguments;
+};  // struct ComputeEnsemble
+}  // namespace KIM
+
+#endif  // KIM_COMPUTE_ENSEMBLE_HPP_
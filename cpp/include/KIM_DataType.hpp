@@ -140,6 +140,16 @@ extern DataType const Integer;
 /// \since 2.0
 extern DataType const Double;
 
+/// \brief The single-precision \c Float data type.
+///
+/// Used by the single-precision variants of compute arguments, such as
+/// COMPUTE_ARGUMENT_NAME::coordinatesFloat.
+///
+/// \sa KIM_DATA_TYPE_Float, kim_data_type_module::kim_data_type_float
+///
+/// \since 2.5
+extern DataType const Float;
+
 
 /// \brief Get the number of standard DataType's defined by the %KIM
 /// API.
@@ -118,6 +118,54 @@ typedef int GetNeighborListFunction(void * const dataObject,
                                     int * const numberOfNeighbors,
                                     int const ** const neighborsOfParticle);
 
+/// \brief Prototype for COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements
+/// routine.
+///
+/// In addition to the arguments of GetNeighborListFunction, the routine
+/// returns a pointer to the relative position vectors, `x_j - x_i`, of the
+/// neighbors (stored as `numberOfNeighbors` consecutive triplets in the same
+/// order as `neighborsOfParticle`) and a pointer to their squared distances.
+/// The routine may set `*squaredDistancesOfNeighbors` to \c NULL if it does
+/// not provide them.
+///
+/// \sa KIM_GetNeighborListWithDisplacementsFunction,
+/// kim_model_compute_arguments_module::<!--
+/// -->kim_model_compute_arguments_get_neighbor_list_displacements
+///
+/// \since 2.5
+typedef int GetNeighborListWithDisplacementsFunction(
+    void * const dataObject,
+    int const numberOfNeighborLists,
+    double const * const cutoffs,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors);
+
+/// \brief Prototype for COMPUTE_CALLBACK_NAME::GetNestedNeighborLists
+/// routine.
+///
+/// The routine returns, for the particle of interest, a single master list of
+/// neighbors sorted by increasing distance.  On return, `numberOfNeighbors`,
+/// an array of length `numberOfNeighborLists`, holds for each cutoff the
+/// number of leading entries of the master list that form the corresponding
+/// neighbor list.
+///
+/// \sa KIM_GetNestedNeighborListsFunction,
+/// kim_model_compute_arguments_module::<!--
+/// -->kim_model_compute_arguments_get_neighbor_lists
+///
+/// \since 2.5
+typedef int GetNestedNeighborListsFunction(
+    void * const dataObject,
+    int const numberOfNeighborLists,
+    double const * const cutoffs,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle);
+
 /// \brief Prototype for COMPUTE_CALLBACK_NAME::ProcessDEDrTerm
 /// routine.
 ///
@@ -147,6 +195,49 @@ typedef int ProcessD2EDr2TermFunction(void * const dataObject,
                                       int const * const i,
                                       int const * const j);
 
+/// \brief Prototype for COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch
+/// routine.
+///
+/// The routine receives `numberOfTerms` terms, each with the meaning of the
+/// arguments of ProcessDEDrTermFunction.  The `de`, `r`, `i`, and `j` arrays
+/// have length `numberOfTerms` and `dx` holds `numberOfTerms` consecutive
+/// triplets.
+///
+/// \sa KIM_ProcessDEDrTermBatchFunction,
+/// kim_model_compute_arguments_module::<!--
+/// -->kim_model_compute_arguments_process_dedr_term_batch
+///
+/// \since 2.5
+typedef int ProcessDEDrTermBatchFunction(void * const dataObject,
+                                         int const numberOfTerms,
+                                         double const * const de,
+                                         double const * const r,
+                                         double const * const dx,
+                                         int const * const i,
+                                         int const * const j);
+
+/// \brief Prototype for COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch
+/// routine.
+///
+/// The routine receives `numberOfTerms` terms, each with the meaning of the
+/// arguments of ProcessD2EDr2TermFunction.  The `de` array has length
+/// `numberOfTerms`; the `r`, `i`, and `j` arrays hold `numberOfTerms`
+/// consecutive pairs and `dx` holds `numberOfTerms` consecutive blocks of six
+/// values.
+///
+/// \sa KIM_ProcessD2EDr2TermBatchFunction,
+/// kim_model_compute_arguments_module::<!--
+/// -->kim_model_compute_arguments_process_d2edr2_term_batch
+///
+/// \since 2.5
+typedef int ProcessD2EDr2TermBatchFunction(void * const dataObject,
+                                           int const numberOfTerms,
+                                           double const * const de,
+                                           double const * const r,
+                                           double const * const dx,
+                                           int const * const i,
+                                           int const * const j);
+
 /// \brief Prototype for MODEL_ROUTINE_NAME::Extension routine.
 ///
 /// \sa KIM_ModelExtensionFunction, kim_model_module::kim_model_extension
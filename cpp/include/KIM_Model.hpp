@@ -47,6 +47,7 @@ class ChargeUnit;
 class TemperatureUnit;
 class TimeUnit;
 class ComputeArguments;
+class PendingModel;
 class ModelImplementation;
 
 /// \brief Provides the primary interface to a %KIM API Model object and is
@@ -126,6 +127,103 @@ class Model
                     int * const requestedUnitsAccepted,
                     Model ** const model);
 
+  /// \brief Create a new %KIM API Model object from the Model's shared
+  /// library file, without searching the %KIM API collections.
+  ///
+  /// Behaves as Model::Create, except that the Model's shared library is
+  /// opened directly from \c modelLibraryPath.  If the Model is a
+  /// parameterized model and \c driverLibraryPath is not empty, its Model
+  /// Driver's shared library is likewise opened directly.  In that case
+  /// neither the collections' environment variables, configuration file, nor
+  /// directories are accessed.
+  ///
+  /// \param[in]  numbering The Numbering value used by the Simulator.
+  /// \param[in]  requestedLengthUnit The base LengthUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedEnergyUnit The base EnergyUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedChargeUnit The base ChargeUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedTemperatureUnit The base TemperatureUnit requested
+  ///             by the Simulator.
+  /// \param[in]  requestedTimeUnit The base TimeUnit requested by the
+  ///             Simulator.
+  /// \param[in]  modelLibraryPath Path of the Model's shared library file.
+  /// \param[in]  driverLibraryPath Path of the Model Driver's shared library
+  ///             file, or an empty string to find the Model Driver in the
+  ///             collections.
+  /// \param[out] requestedUnitsAccepted An integer that is set to \c true if
+  ///             the Model accepts the Simulator's requested base units, \c
+  ///             false if the Model will use base units other than those
+  ///             requested by the Simulator.
+  /// \param[out] model Pointer to the newly created Model object.
+  ///
+  /// \return \c true if the library at \c driverLibraryPath is not the
+  ///         Model Driver named by the Model.
+  /// \return \c true under the same conditions as Model::Create.
+  /// \return \c false otherwise.
+  ///
+  /// \post \c requestedUnitsAccepted is unchanged and `model == NULL` if an
+  ///       error occurs.
+  ///
+  /// \sa KIM_Model_CreateFromLibraryPath,
+  /// kim_model_module::kim_model_create_from_library_path
+  ///
+  /// \since 2.5
+  static int
+  CreateFromLibraryPath(Numbering const numbering,
+                        LengthUnit const requestedLengthUnit,
+                        EnergyUnit const requestedEnergyUnit,
+                        ChargeUnit const requestedChargeUnit,
+                        TemperatureUnit const requestedTemperatureUnit,
+                        TimeUnit const requestedTimeUnit,
+                        std::string const & modelLibraryPath,
+                        std::string const & driverLibraryPath,
+                        int * const requestedUnitsAccepted,
+                        Model ** const model);
+
+  /// \brief Start the creation of a new %KIM API Model object on a
+  /// background thread.
+  ///
+  /// Returns immediately.  The Model is created, as by Model::Create, while
+  /// the Simulator continues with its own setup.  The created Model is
+  /// retrieved with PendingModel::Wait.
+  ///
+  /// \param[in]  numbering The Numbering value used by the Simulator.
+  /// \param[in]  requestedLengthUnit The base LengthUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedEnergyUnit The base EnergyUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedChargeUnit The base ChargeUnit requested by the
+  ///             Simulator.
+  /// \param[in]  requestedTemperatureUnit The base TemperatureUnit requested
+  ///             by the Simulator.
+  /// \param[in]  requestedTimeUnit The base TimeUnit requested by the
+  ///             Simulator.
+  /// \param[in]  modelName The name of the Model to be created.
+  /// \param[out] pendingModel Pointer to the newly created PendingModel
+  ///             object.
+  ///
+  /// \return \c true if the %KIM API is unable to allocate a new
+  ///         PendingModel object.
+  /// \return \c false otherwise.  Errors of the Model creation itself are
+  ///         reported by PendingModel::Wait.
+  ///
+  /// \post `pendingModel == NULL` if an error occurs.
+  ///
+  /// \sa KIM_Model_CreateAsync,
+  /// kim_pending_model_module::kim_model_create_async
+  ///
+  /// \since 2.5
+  static int CreateAsync(Numbering const numbering,
+                         LengthUnit const requestedLengthUnit,
+                         EnergyUnit const requestedEnergyUnit,
+                         ChargeUnit const requestedChargeUnit,
+                         TemperatureUnit const requestedTemperatureUnit,
+                         TimeUnit const requestedTimeUnit,
+                         std::string const & modelName,
+                         PendingModel ** const pendingModel);
+
   /// \brief Destroy a previously Model::Create'd object.
   ///
   /// Call the Model's MODEL_ROUTINE_NAME::Destroy routine and deallocate
@@ -210,6 +308,38 @@ class Model
       int const ** const modelWillNotRequestNeighborsOfNoncontributingParticles)
       const;
 
+  /// \brief Get the Model's species pair cutoffs, if provided.
+  ///
+  /// For each neighbor list, the Model may provide a square matrix, indexed
+  /// by the Model's species codes, of cutoff distances beyond which a pair of
+  /// particles with those species does not interact.  A simulator may omit
+  /// such pairs from the corresponding neighbor list.
+  ///
+  /// \note Output pointers obtained from this routine are valid until the next
+  /// call to Model::ClearThenRefresh of the KIM::Model object is
+  /// Model::Destroy'd.
+  ///
+  /// \param[out] numberOfSpeciesCodes The number of species codes used to
+  ///             index the matrices, or zero if the Model does not provide
+  ///             species pair cutoffs.
+  /// \param[out] speciesPairCutoffs The species pair cutoff values, or \c NULL
+  ///             if the Model does not provide species pair cutoffs.  The
+  ///             cutoff for neighbor list \c i and species codes \c j and \c
+  ///             k is stored at index `(i * numberOfSpeciesCodes + j) *
+  ///             numberOfSpeciesCodes + k`.
+  ///
+  /// \pre \c numberOfSpeciesCodes or \c speciesPairCutoffs may be \c NULL if
+  ///      the corresponding value is not needed.
+  ///
+  /// \sa KIM_Model_GetSpeciesPairCutoffsPointer,
+  /// kim_model_module::kim_get_species_pair_cutoffs_extent,
+  /// kim_model_module::kim_get_species_pair_cutoffs_values
+  ///
+  /// \since 2.5
+  void
+  GetSpeciesPairCutoffsPointer(int * const numberOfSpeciesCodes,
+                               double const ** const speciesPairCutoffs) const;
+
   /// \brief Get the Model's base unit values.
   ///
   /// \param[out] lengthUnit The Model's base LengthUnit.
@@ -300,6 +430,40 @@ class Model
   /// \since 2.0
   int Compute(ComputeArguments const * const computeArguments) const;
 
+  /// \brief Call MODEL_ROUTINE_NAME::Compute for each member of an ensemble
+  /// of Model objects that share a model driver.
+  ///
+  /// Each member's output arguments (energy, forces, etc.) are written to its
+  /// own ComputeArguments object.  If the members use the same model driver,
+  /// the driver lists the \c KIM_COMPUTE_ENSEMBLE_ID extension among its
+  /// SupportedExtensions, the members have the same influence distance,
+  /// neighbor list cutoffs, and \c
+  /// modelWillNotRequestNeighborsOfNoncontributingParticles values, and all
+  /// the ComputeArguments objects have the same input arguments and
+  /// callbacks, then the members are evaluated together by a single call to
+  /// the driver's MODEL_ROUTINE_NAME::Extension routine.  Otherwise,
+  /// Model::Compute is called for each member in turn.
+  ///
+  /// \param[in] numberOfMembers The number of members in the ensemble.
+  /// \param[in] models The Model object of each member.
+  /// \param[in] computeArguments The ComputeArguments object of each member,
+  ///            created by the corresponding Model object.
+  ///
+  /// \return \c true if \c numberOfMembers < 1.
+  /// \return \c true if any member's ComputeArguments object was created by a
+  ///         different Model or is not ready (see Model::Compute).
+  /// \return \c true if the model driver's MODEL_ROUTINE_NAME::Extension or
+  ///         MODEL_ROUTINE_NAME::Compute routine returns \c true.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Model_ComputeEnsemble, kim_model_module::kim_compute_ensemble
+  ///
+  /// \since 2.5
+  static int
+  ComputeEnsemble(int const numberOfMembers,
+                  Model * const * const models,
+                  ComputeArguments const * const * const computeArguments);
+
   /// \brief Call the Model's MODEL_ROUTINE_NAME::Extension routine.
   ///
   /// \param[in]    extensionID A string uniquely identifying the extension to
@@ -364,6 +528,61 @@ class Model
   int WriteParameterizedModel(std::string const & path,
                               std::string const & modelName) const;
 
+  /// \brief Enable or disable collection of Model::Compute statistics.
+  ///
+  /// While enabled, each Model::Compute call records its wall time and the
+  /// number and wall time of the simulator's neighbor list and
+  /// ProcessDEDrTerm/ProcessD2EDr2Term callback invocations, as well as the
+  /// total number of neighbors served.  Collection is disabled by default
+  /// and costs a single branch per callback when disabled.
+  ///
+  /// \param[in] enabled Collect statistics if \c true, otherwise stop.
+  ///
+  /// \sa KIM_Model_SetStatisticsEnabled,
+  /// kim_model_module::kim_set_statistics_enabled
+  ///
+  /// \since 2.5
+  void SetStatisticsEnabled(int const enabled);
+
+  /// \brief Get the statistics accumulated since the Model was created or
+  /// Model::ResetStatistics was last called.
+  ///
+  /// Times are wall-clock seconds.  Callback times are included in the
+  /// compute time.
+  ///
+  /// \param[out] computeCalls Number of Model::Compute calls.
+  /// \param[out] computeTime Total time spent in Model::Compute.
+  /// \param[out] neighborListCalls Number of neighbor list callback calls.
+  /// \param[out] neighborListTime Total time spent in the simulator's
+  ///             neighbor list callbacks.
+  /// \param[out] neighborsServed Total number of neighbors returned to the
+  ///             Model by its neighbor list requests.  A request for all
+  ///             nested lists of a particle counts the longest list.
+  /// \param[out] processTermCalls Number of ProcessDEDrTerm and
+  ///             ProcessD2EDr2Term callback calls (batched or not).
+  /// \param[out] processTermTime Total time spent in the simulator's
+  ///             process term callbacks.
+  ///
+  /// \note Any of the output pointers may be \c NULL.
+  ///
+  /// \sa KIM_Model_GetStatistics, kim_model_module::kim_get_statistics
+  ///
+  /// \since 2.5
+  void GetStatistics(long * const computeCalls,
+                     double * const computeTime,
+                     long * const neighborListCalls,
+                     double * const neighborListTime,
+                     long * const neighborsServed,
+                     long * const processTermCalls,
+                     double * const processTermTime) const;
+
+  /// \brief Zero all statistics counters.
+  ///
+  /// \sa KIM_Model_ResetStatistics, kim_model_module::kim_reset_statistics
+  ///
+  /// \since 2.5
+  void ResetStatistics();
+
   /// \brief Get the Model's support and code for the requested SpeciesName.
   ///
   /// \param[in]  speciesName The SpeciesName of interest.
@@ -483,6 +702,130 @@ class Model
                    int const arrayIndex,
                    double const parameterValue);
 
+  /// \brief Get a contiguous range of values of a parameter array from the
+  /// Model.
+  ///
+  /// \param[in]  parameterIndex Zero-based index for the parameter array of
+  ///             interest.
+  /// \param[in]  offset Zero-based index within the parameter array of the
+  ///             first value of interest.
+  /// \param[in]  count The number of values of interest.
+  /// \param[out] parameterValues Array of \c count values to receive the
+  ///             parameter values.
+  ///
+  /// \return \c true if \c parameterIndex is invalid.
+  /// \return \c true if the specified parameter and \c parameterValues are of
+  ///         different data types.
+  /// \return \c true if \c offset or \c count specify a range outside the
+  ///         parameter array.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Model_GetParameterArrayInteger,
+  /// KIM_Model_GetParameterArrayDouble,
+  /// kim_model_module::kim_get_parameter_array
+  ///
+  /// \since 2.5
+  int GetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        int * const parameterValues) const;
+
+  /// \overload
+  int GetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        double * const parameterValues) const;
+
+  /// \brief Set a contiguous range of values of a parameter array for the
+  /// Model.
+  ///
+  /// This is equivalent to, but much faster than, calling SetParameter for
+  /// each of the values.
+  ///
+  /// \param[in] parameterIndex Zero-based index for the parameter array of
+  ///            interest.
+  /// \param[in] offset Zero-based index within the parameter array of the
+  ///            first value of interest.
+  /// \param[in] count The number of values of interest.
+  /// \param[in] parameterValues Array of the \c count new parameter values.
+  ///
+  /// \return \c true if \c parameterIndex is invalid.
+  /// \return \c true if the specified parameter and \c parameterValues are of
+  ///         different data types.
+  /// \return \c true if \c offset or \c count specify a range outside the
+  ///         parameter array.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Model_SetParameterArrayInteger,
+  /// KIM_Model_SetParameterArrayDouble,
+  /// kim_model_module::kim_set_parameter_array
+  ///
+  /// \since 2.5
+  int SetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        int const * const parameterValues);
+
+  /// \overload
+  int SetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        double const * const parameterValues);
+
+  /// \brief Get the length of the Model's parameter vector.
+  ///
+  /// The parameter vector is the concatenation, in order of increasing
+  /// parameter index, of all parameter arrays of data type DATA_TYPE::Double.
+  /// It is meant for optimizers that treat the Model's parameters as a single
+  /// vector of unknowns.  Parameters of data type DATA_TYPE::Integer are not
+  /// part of the vector: GetParameterVector does not report them and
+  /// SetParameterVector leaves them unchanged.  Use GetParameter and
+  /// SetParameter for those.
+  ///
+  /// \param[out] parameterVectorSize The number of values in the parameter
+  ///             vector.
+  ///
+  /// \sa KIM_Model_GetParameterVectorSize,
+  /// kim_model_module::kim_get_parameter_vector_size
+  ///
+  /// \since 2.5
+  void GetParameterVectorSize(int * const parameterVectorSize) const;
+
+  /// \brief Get the Model's parameter vector.
+  ///
+  /// \param[in] parameterVectorSize The number of values in \c
+  ///            parameterValues, as given by GetParameterVectorSize.
+  /// \param[out] parameterValues Array to receive the parameter vector.
+  ///
+  /// \return \c true if \c parameterVectorSize is not the length of the
+  ///         parameter vector.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Model_GetParameterVector,
+  /// kim_model_module::kim_get_parameter_vector
+  ///
+  /// \since 2.5
+  int GetParameterVector(int const parameterVectorSize,
+                         double * const parameterValues) const;
+
+  /// \brief Set the Model's parameter vector.
+  ///
+  /// \param[in] parameterVectorSize The number of values in \c
+  ///            parameterValues, as given by GetParameterVectorSize.
+  /// \param[in] parameterValues Array of the new values for the parameter
+  ///            vector.
+  ///
+  /// \return \c true if \c parameterVectorSize is not the length of the
+  ///         parameter vector.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_Model_SetParameterVector,
+  /// kim_model_module::kim_set_parameter_vector
+  ///
+  /// \since 2.5
+  int SetParameterVector(int const parameterVectorSize,
+                         double const * const parameterValues);
+
   /// \brief Set the \ref cache_buffer_pointers "Simulator's buffer pointer"
   /// within the Model object.
   ///
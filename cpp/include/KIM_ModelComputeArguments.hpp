@@ -82,6 +82,103 @@ class ModelComputeArguments
                       int * const numberOfNeighbors,
                       int const ** const neighborsOfParticle) const;
 
+  /// \brief Get the neighbor list for a particle of interest together with
+  /// the relative position vectors of its neighbors.
+  ///
+  /// This routine calls the Simulator's
+  /// COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements routine, which is
+  /// optional.  Models must first check that it has been provided by calling
+  /// ModelComputeArguments::IsCallbackPresent.  Using the displacements
+  /// supplied by the Simulator avoids gathering the coordinates of each
+  /// neighbor.
+  ///
+  /// \param[in]  neighborListIndex Zero-based index corresponding to the
+  ///             desired neighbor list cutoff distance.
+  /// \param[in]  particleNumber Particle number (using the Model's Numbering)
+  ///             for the particle of interest.
+  /// \param[out] numberOfNeighbors Number of neighbor particles in the list.
+  /// \param[out] neighborsOfParticle Pointer to array of particle neighbor
+  ///             numbers (using the Model's Numbering).
+  /// \param[out] displacementsOfNeighbors Pointer to array of \c
+  ///             numberOfNeighbors relative position vectors, \f$\mathbf{x}_j
+  ///             - \mathbf{x}_i\f$, stored as consecutive triplets in the
+  ///             order of \c neighborsOfParticle.
+  /// \param[out] squaredDistancesOfNeighbors Pointer to array of \c
+  ///             numberOfNeighbors squared distances, or \c NULL if the
+  ///             Simulator does not provide them.
+  ///
+  /// \pre \c squaredDistancesOfNeighbors may be \c NULL if the value is not
+  ///      needed.
+  ///
+  /// \return \c true if the callback has not been provided by the Simulator.
+  /// \return \c true if \c neighborListIndex is invalid.
+  /// \return \c true if \c particleNumber is invalid.
+  /// \return \c true if the Simulator's
+  ///         COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements routine
+  ///         returns \c true.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelComputeArguments_GetNeighborListWithDisplacements,
+  /// kim_model_compute_arguments_module::<!--
+  /// -->kim_get_neighbor_list_with_displacements
+  ///
+  /// \since 2.5
+  int GetNeighborListWithDisplacements(
+      int const neighborListIndex,
+      int const particleNumber,
+      int * const numberOfNeighbors,
+      int const ** const neighborsOfParticle,
+      double const ** const displacementsOfNeighbors,
+      double const ** const squaredDistancesOfNeighbors) const;
+
+  /// \brief Get all neighbor lists for a particle of interest.
+  ///
+  /// If the Simulator provides the optional
+  /// COMPUTE_CALLBACK_NAME::GetNestedNeighborLists routine, it is called once
+  /// and every entry of \c neighborsOfParticle points to the same master list,
+  /// sorted by increasing distance, with \c numberOfNeighbors giving the
+  /// length of the prefix that forms each list.  Otherwise, the Simulator's
+  /// COMPUTE_CALLBACK_NAME::GetNeighborList routine is called once for each
+  /// neighbor list.
+  ///
+  /// \param[in]  particleNumber Particle number (using the Model's Numbering)
+  ///             for the particle of interest.
+  /// \param[out] numberOfNeighbors Array, of length equal to the number of
+  ///             neighbor lists, of the number of neighbor particles in each
+  ///             list.
+  /// \param[out] neighborsOfParticle Array, of length equal to the number of
+  ///             neighbor lists, of pointers to arrays of particle neighbor
+  ///             numbers (using the Model's Numbering).
+  ///
+  /// \return \c true if \c particleNumber is invalid.
+  /// \return \c true if the Simulator's
+  ///         COMPUTE_CALLBACK_NAME::GetNestedNeighborLists or
+  ///         COMPUTE_CALLBACK_NAME::GetNeighborList routine returns \c true.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelComputeArguments_GetNeighborLists,
+  /// kim_model_compute_arguments_module::kim_get_neighbor_lists
+  ///
+  /// \since 2.5
+  int GetNeighborLists(int const particleNumber,
+                       int * const numberOfNeighbors,
+                       int const ** const neighborsOfParticle) const;
+
+  /// \brief Get the offset to add to each neighbor particle number to obtain
+  /// the corresponding particle number in the Model's Numbering.
+  ///
+  /// The offset is zero unless the Simulator's and the Model's Numbering
+  /// differ and the Model has disabled translation by calling
+  /// ModelComputeArgumentsCreate::SetNeighborNumberingTranslation.
+  ///
+  /// \param[out] neighborNumberingOffset The offset.
+  ///
+  /// \sa KIM_ModelComputeArguments_GetNeighborNumberingOffset,
+  /// kim_model_compute_arguments_module::kim_get_neighbor_numbering_offset
+  ///
+  /// \since 2.5
+  void GetNeighborNumberingOffset(int * const neighborNumberingOffset) const;
+
   /// \brief Call the Simulator's COMPUTE_CALLBACK_NAME::ProcessDEDrTerm
   /// routine.
   ///
@@ -145,6 +242,70 @@ class ModelComputeArguments
                         int const * const i,
                         int const * const j) const;
 
+  /// \brief Process a batch of \c ProcessDEDrTerm terms with a single call.
+  ///
+  /// If the Simulator provides a COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch
+  /// routine, it is called once with all terms.  Otherwise, the Simulator's
+  /// COMPUTE_CALLBACK_NAME::ProcessDEDrTerm routine is called once for each
+  /// term, in order.
+  ///
+  /// \param[in] numberOfTerms Number of terms in the batch.
+  /// \param[in] de Array of DEDr values, one per term.
+  /// \param[in] r Array of particle pair distances, one per term.
+  /// \param[in] dx Array of particle pair relative position vectors, stored
+  ///            as \c numberOfTerms consecutive triplets.
+  /// \param[in] i Array of first particle numbers (using the Model's
+  ///            Numbering), one per term.
+  /// \param[in] j Array of second particle numbers (using the Model's
+  ///            Numbering), one per term.
+  ///
+  /// \returns \c true if a Simulator routine returns \c true.
+  /// \returns \c false otherwise.
+  ///
+  /// \sa KIM_ModelComputeArguments_ProcessDEDrTermBatch,
+  /// kim_model_compute_arguments_module::kim_process_dedr_term_batch
+  ///
+  /// \since 2.5
+  int ProcessDEDrTermBatch(int const numberOfTerms,
+                           double const * const de,
+                           double const * const r,
+                           double const * const dx,
+                           int const * const i,
+                           int const * const j) const;
+
+  /// \brief Process a batch of \c ProcessD2EDr2Term terms with a single
+  /// call.
+  ///
+  /// If the Simulator provides a COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch
+  /// routine, it is called once with all terms.  Otherwise, the Simulator's
+  /// COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term routine is called once for each
+  /// term, in order.
+  ///
+  /// \param[in] numberOfTerms Number of terms in the batch.
+  /// \param[in] de Array of D2EDr2 values, one per term.
+  /// \param[in] r Array of particle pair distances, stored as \c
+  ///            numberOfTerms consecutive pairs.
+  /// \param[in] dx Array of particle pair relative position vectors, stored
+  ///            as \c numberOfTerms consecutive blocks of two triplets.
+  /// \param[in] i Array of first particle numbers (using the Model's
+  ///            Numbering), stored as \c numberOfTerms consecutive pairs.
+  /// \param[in] j Array of second particle numbers (using the Model's
+  ///            Numbering), stored as \c numberOfTerms consecutive pairs.
+  ///
+  /// \returns \c true if a Simulator routine returns \c true.
+  /// \returns \c false otherwise.
+  ///
+  /// \sa KIM_ModelComputeArguments_ProcessD2EDr2TermBatch,
+  /// kim_model_compute_arguments_module::kim_process_d2edr2_term_batch
+  ///
+  /// \since 2.5
+  int ProcessD2EDr2TermBatch(int const numberOfTerms,
+                             double const * const de,
+                             double const * const r,
+                             double const * const dx,
+                             int const * const i,
+                             int const * const j) const;
+
   /// \brief Get the data pointer for a ComputeArgumentName.
   ///
   /// \param[in] computeArgumentName The ComputeArgumentName of interest.
@@ -156,6 +317,7 @@ class ModelComputeArguments
   ///
   /// \sa KIM_ModelComputeArguments_GetArgumentPointerInteger,
   ///     KIM_ModelComputeArguments_GetArgumentPointerDouble,
+  ///     KIM_ModelComputeArguments_GetArgumentPointerFloat,
   ///     kim_model_compute_arguments_module::kim_get_argument_pointer
   ///
   /// \since 2.0
@@ -174,6 +336,18 @@ class ModelComputeArguments
   int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
                          double ** const ptr) const;
 
+  /// \overload
+  ///
+  /// \since 2.5
+  int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float const ** const ptr) const;
+
+  /// \overload
+  ///
+  /// \since 2.5
+  int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float ** const ptr) const;
+
   /// \brief Determine if the Simulator has provided a non-NULL function
   /// pointer for a ComputeCallbackName of interest.
   ///
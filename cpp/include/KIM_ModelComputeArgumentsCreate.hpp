@@ -89,6 +89,28 @@ class ModelComputeArgumentsCreate
   int SetCallbackSupportStatus(ComputeCallbackName const computeCallbackName,
                                SupportStatus const supportStatus);
 
+  /// \brief Set whether neighbor particle numbers are translated to the
+  /// Model's Numbering.
+  ///
+  /// By default, when the Simulator's Numbering differs from the Model's,
+  /// ModelComputeArguments::GetNeighborList copies each neighbor list and adds
+  /// the numbering offset to every entry.  A Model that sets this to \c false
+  /// receives the Simulator's lists directly, without a copy, and must itself
+  /// add the offset returned by
+  /// ModelComputeArguments::GetNeighborNumberingOffset to each neighbor
+  /// particle number.  Particle numbers passed to the API are always in the
+  /// Model's Numbering.
+  ///
+  /// \param[in] translateNeighborNumbering \c false to receive neighbor
+  ///            particle numbers in the Simulator's Numbering.
+  ///
+  /// \sa KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation,
+  /// kim_model_compute_arguments_create_module::<!--
+  /// -->kim_set_neighbor_numbering_translation
+  ///
+  /// \since 2.5
+  void SetNeighborNumberingTranslation(int const translateNeighborNumbering);
+
   /// \brief Set the \ref cache_buffer_pointers "Model's buffer pointer"
   /// within the ComputeArguments object.
   ///
@@ -128,6 +128,48 @@ class ModelCreate
       double const * const cutoffs,
       int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+  /// \brief Set the Model's species pair cutoffs data pointer.
+  ///
+  /// This is an optional refinement of the neighbor list cutoffs set by
+  /// SetNeighborListPointers.  For each neighbor list, the Model provides a
+  /// square matrix, indexed by the Model's species codes, giving the cutoff
+  /// distance beyond which a pair of particles with those species does not
+  /// interact.  Simulators may use these values to omit such pairs from the
+  /// neighbor lists they provide to the Model.
+  ///
+  /// \param[in] numberOfSpeciesCodes The number of species codes used to
+  ///            index the matrices.  All species codes set by the Model must
+  ///            be less than this value.
+  /// \param[in] speciesPairCutoffs Array of `numberOfNeighborLists *
+  ///            numberOfSpeciesCodes * numberOfSpeciesCodes` cutoff values.
+  ///            The cutoff for neighbor list \c i and species codes \c j and
+  ///            \c k is stored at index `(i * numberOfSpeciesCodes + j) *
+  ///            numberOfSpeciesCodes + k`.  Each value must be nonnegative and
+  ///            no larger than the corresponding neighbor list cutoff.
+  ///
+  /// \return \c true if SetNeighborListPointers has not yet been called.
+  /// \return \c true if \c numberOfSpeciesCodes < 1 or \c
+  ///         speciesPairCutoffs is \c NULL.
+  /// \return \c true if any value is negative or larger than the
+  ///         corresponding neighbor list cutoff.
+  /// \return \c false otherwise.
+  ///
+  /// \post The species pair cutoffs pointer is unchanged if an error occurs.
+  ///
+  /// \note The model is responsible for allocating the memory associated with
+  /// the species pair cutoffs data.  The model must use the \ref
+  /// cache_buffer_pointers "Model's buffer pointer" to retain access to this
+  /// memory location and avoid a memory leak.
+  ///
+  /// \sa ModelDriverCreate::SetSpeciesPairCutoffsPointer,
+  /// KIM_ModelCreate_SetSpeciesPairCutoffsPointer,
+  /// KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer,
+  /// kim_model_create_module::kim_set_species_pair_cutoffs_pointer
+  ///
+  /// \since 2.5
+  int SetSpeciesPairCutoffsPointer(int const numberOfSpeciesCodes,
+                                   double const * const speciesPairCutoffs);
+
   /// \brief Set the function pointer for the ModelRoutineName of interest.
   ///
   /// \param[in] modelRoutineName The ModelRoutineName of interest.
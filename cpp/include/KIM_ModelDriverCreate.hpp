@@ -192,6 +192,48 @@ class ModelDriverCreate
       double const * const cutoffs,
       int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+  /// \brief Set the Model's species pair cutoffs data pointer.
+  ///
+  /// This is an optional refinement of the neighbor list cutoffs set by
+  /// SetNeighborListPointers.  For each neighbor list, the Model provides a
+  /// square matrix, indexed by the Model's species codes, giving the cutoff
+  /// distance beyond which a pair of particles with those species does not
+  /// interact.  Simulators may use these values to omit such pairs from the
+  /// neighbor lists they provide to the Model.
+  ///
+  /// \param[in] numberOfSpeciesCodes The number of species codes used to
+  ///            index the matrices.  All species codes set by the Model must
+  ///            be less than this value.
+  /// \param[in] speciesPairCutoffs Array of `numberOfNeighborLists *
+  ///            numberOfSpeciesCodes * numberOfSpeciesCodes` cutoff values.
+  ///            The cutoff for neighbor list \c i and species codes \c j and
+  ///            \c k is stored at index `(i * numberOfSpeciesCodes + j) *
+  ///            numberOfSpeciesCodes + k`.  Each value must be nonnegative and
+  ///            no larger than the corresponding neighbor list cutoff.
+  ///
+  /// \return \c true if SetNeighborListPointers has not yet been called.
+  /// \return \c true if \c numberOfSpeciesCodes < 1 or \c
+  ///         speciesPairCutoffs is \c NULL.
+  /// \return \c true if any value is negative or larger than the
+  ///         corresponding neighbor list cutoff.
+  /// \return \c false otherwise.
+  ///
+  /// \post The species pair cutoffs pointer is unchanged if an error occurs.
+  ///
+  /// \note The model is responsible for allocating the memory associated with
+  /// the species pair cutoffs data.  The model must use the \ref
+  /// cache_buffer_pointers "Model's buffer pointer" to retain access to this
+  /// memory location and avoid a memory leak.
+  ///
+  /// \sa ModelCreate::SetSpeciesPairCutoffsPointer,
+  /// KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer,
+  /// KIM_ModelCreate_SetSpeciesPairCutoffsPointer,
+  /// kim_model_driver_create_module::kim_set_species_pair_cutoffs_pointer
+  ///
+  /// \since 2.5
+  int SetSpeciesPairCutoffsPointer(int const numberOfSpeciesCodes,
+                                   double const * const speciesPairCutoffs);
+
   /// \brief Set the function pointer for the ModelRoutineName of interest.
   ///
   /// \param[in] modelRoutineName The ModelRoutineName of interest.
@@ -294,6 +336,63 @@ class ModelDriverCreate
   /// \since 2.0
   void SetModelBufferPointer(void * const ptr);
 
+  /// \brief Declare a read-only buffer that may be shared by all Model
+  /// objects on the node that are created with the same model name,
+  /// requested units and parameter file contents.
+  ///
+  /// Use this for large parameter tables and data derived from them that
+  /// the Model never modifies after its Create routine.  When the \c
+  /// KIM_API_SHARED_MEMORY environment variable is set (to a value other
+  /// than \c 0), the buffer is placed in a POSIX shared-memory segment and
+  /// only the first Model object on the node must fill it; every other one
+  /// maps the same memory read-only.  Otherwise, the buffer is private and
+  /// \c mustInitialize is always \c true.
+  ///
+  /// When \c mustInitialize is \c true, the Model must fill the buffer and
+  /// then call SetSharedBufferInitialized() before its Create routine
+  /// returns; otherwise the buffer is not shared.  In either case, the Model
+  /// must not write to the buffer after that, including from its Refresh
+  /// routine.  The buffer is released when the Model object is destroyed.
+  ///
+  /// \param[in] bufferName A name, unique within the Model, that is a valid
+  ///            C identifier.
+  /// \param[in] numberOfBytes The size of the buffer.  It must be the same
+  ///            for all Model objects that share the buffer.
+  /// \param[out] buffer The buffer.
+  /// \param[out] mustInitialize \c true if the Model must fill the buffer.
+  ///
+  /// \return \c true if \c numberOfBytes is not positive.
+  /// \return \c true if \c bufferName is not a valid C identifier or has
+  ///         already been declared.
+  /// \return \c true if the parameter files could not be read.
+  /// \return \c true if the memory could not be allocated.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelDriverCreate_DeclareSharedBuffer,
+  /// kim_model_driver_create_module::kim_declare_shared_buffer
+  ///
+  /// \since 2.5
+  int DeclareSharedBuffer(std::string const & bufferName,
+                          long const numberOfBytes,
+                          void ** const buffer,
+                          int * const mustInitialize);
+
+  /// \brief Make the contents of a buffer obtained from DeclareSharedBuffer()
+  /// available to the other Model objects that share it.
+  ///
+  /// \param[in] buffer The buffer.
+  ///
+  /// \return \c true if \c buffer was not obtained from
+  ///         DeclareSharedBuffer() with \c mustInitialize equal to \c true.
+  /// \return \c true if the buffer has already been initialized.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelDriverCreate_SetSharedBufferInitialized,
+  /// kim_model_driver_create_module::kim_set_shared_buffer_initialized
+  ///
+  /// \since 2.5
+  int SetSharedBufferInitialized(void * const buffer);
+
   /// \brief Set the Model's base unit values.
   ///
   /// \param[in] lengthUnit The Model's base LengthUnit.
@@ -96,6 +96,90 @@ class ModelRefresh
       double const * const cutoffs,
       int const * const modelWillNotRequestNeighborsOfNoncontributingParticles);
 
+  /// \brief Set the Model's species pair cutoffs data pointer.
+  ///
+  /// This is an optional refinement of the neighbor list cutoffs set by
+  /// SetNeighborListPointers.  For each neighbor list, the Model provides a
+  /// square matrix, indexed by the Model's species codes, giving the cutoff
+  /// distance beyond which a pair of particles with those species does not
+  /// interact.  Simulators may use these values to omit such pairs from the
+  /// neighbor lists they provide to the Model.
+  ///
+  /// \param[in] numberOfSpeciesCodes The number of species codes used to
+  ///            index the matrices.  All species codes set by the Model must
+  ///            be less than this value.
+  /// \param[in] speciesPairCutoffs Array of `numberOfNeighborLists *
+  ///            numberOfSpeciesCodes * numberOfSpeciesCodes` cutoff values.
+  ///            The cutoff for neighbor list \c i and species codes \c j and
+  ///            \c k is stored at index `(i * numberOfSpeciesCodes + j) *
+  ///            numberOfSpeciesCodes + k`.  Each value must be nonnegative and
+  ///            no larger than the corresponding neighbor list cutoff.
+  ///
+  /// \return \c true if SetNeighborListPointers has not yet been called.
+  /// \return \c true if \c numberOfSpeciesCodes < 1 or \c
+  ///         speciesPairCutoffs is \c NULL.
+  /// \return \c true if any value is negative or larger than the
+  ///         corresponding neighbor list cutoff.
+  /// \return \c false otherwise.
+  ///
+  /// \post The species pair cutoffs pointer is unchanged if an error occurs.
+  ///
+  /// \note The model is responsible for allocating the memory associated with
+  /// the species pair cutoffs data.  The model must use the \ref
+  /// cache_buffer_pointers "Model's buffer pointer" to retain access to this
+  /// memory location and avoid a memory leak.
+  ///
+  /// \sa KIM_ModelRefresh_SetSpeciesPairCutoffsPointer,
+  /// kim_model_refresh_module::kim_set_species_pair_cutoffs_pointer
+  ///
+  /// \since 2.5
+  int SetSpeciesPairCutoffsPointer(int const numberOfSpeciesCodes,
+                                   double const * const speciesPairCutoffs);
+
+  /// \brief Get the number of elements of a parameter array that have been
+  /// changed since the last successful refresh.
+  ///
+  /// Each array element set by Model::SetParameter since the Model's Refresh
+  /// routine last returned successfully is counted once, even if it was set
+  /// several times or set to its previous value.  A Model may use this, with
+  /// GetChangedParameterElement, to update only the derived quantities that
+  /// depend on the changed elements.
+  ///
+  /// \param[in] parameterIndex Zero-based index of the parameter.
+  /// \param[out] numberOfChangedElements The number of changed elements of
+  ///             the parameter array.
+  ///
+  /// \return \c true if \c parameterIndex is invalid.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelRefresh_GetNumberOfChangedParameterElements,
+  /// kim_model_refresh_module::kim_get_number_of_changed_parameter_elements
+  ///
+  /// \since 2.5
+  int GetNumberOfChangedParameterElements(
+      int const parameterIndex, int * const numberOfChangedElements) const;
+
+  /// \brief Get the array index of a changed element of a parameter array.
+  ///
+  /// The changed elements are listed in increasing order of their array
+  /// index.
+  ///
+  /// \param[in] parameterIndex Zero-based index of the parameter.
+  /// \param[in] index Zero-based index of the changed element.
+  /// \param[out] arrayIndex Zero-based index, within the parameter array, of
+  ///             the changed element.
+  ///
+  /// \return \c true if \c parameterIndex or \c index are invalid.
+  /// \return \c false otherwise.
+  ///
+  /// \sa KIM_ModelRefresh_GetChangedParameterElement,
+  /// kim_model_refresh_module::kim_get_changed_parameter_element
+  ///
+  /// \since 2.5
+  int GetChangedParameterElement(int const parameterIndex,
+                                 int const index,
+                                 int * const arrayIndex) const;
+
   /// \brief Get the \ref cache_buffer_pointers "Model's buffer pointer"
   /// within the Model object.
   ///
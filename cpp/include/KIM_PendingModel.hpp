@@ -0,0 +1,127 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_PENDING_MODEL_HPP_
+#define KIM_PENDING_MODEL_HPP_
+
+namespace KIM
+{
+// Forward declarations
+class Model;
+class PendingModelImplementation;
+
+/// \brief Provides the interface to a %KIM API Model object whose creation
+/// was started by Model::CreateAsync and is meant to be used by simulators.
+///
+/// The Model is created on a background thread while the Simulator continues
+/// with its own setup.  The Simulator polls the PendingModel with
+/// PendingModel::IsComplete or blocks with PendingModel::Wait, which hands
+/// over ownership of the created Model.
+///
+/// The %KIM API default Log settings (see Log::PushDefaultVerbosity and
+/// Log::PushDefaultPrintFunction) are read by the background thread and must
+/// not be changed until the PendingModel is complete.
+///
+/// \sa KIM_PendingModel,
+/// kim_pending_model_module::kim_pending_model_handle_type
+///
+/// \since 2.5
+class PendingModel
+{
+ public:
+  /// \brief Destroy a previously Model::CreateAsync'd object.
+  ///
+  /// Waits for the Model creation to complete.  If the created Model was not
+  /// retrieved by PendingModel::Wait, it is destroyed by Model::Destroy.
+  ///
+  /// \param[inout] pendingModel Pointer to the PendingModel object.
+  ///
+  /// \pre \c *pendingModel points to a previously created %KIM API
+  ///      PendingModel object.
+  ///
+  /// \post `*pendingModel == NULL`.
+  ///
+  /// \sa KIM_PendingModel_Destroy,
+  /// kim_pending_model_module::kim_pending_model_destroy
+  ///
+  /// \since 2.5
+  static void Destroy(PendingModel ** const pendingModel);
+
+  /// \brief Determine whether the Model creation has completed, without
+  /// blocking.
+  ///
+  /// \param[out] isComplete An integer that is set to \c true if the Model
+  ///             creation has completed (successfully or not), \c false
+  ///             otherwise.
+  ///
+  /// \sa KIM_PendingModel_IsComplete,
+  /// kim_pending_model_module::kim_is_complete
+  ///
+  /// \since 2.5
+  void IsComplete(int * const isComplete) const;
+
+  /// \brief Block until the Model creation has completed and retrieve the
+  /// created Model.
+  ///
+  /// Ownership of the Model is transferred to the Simulator, which must
+  /// destroy it with Model::Destroy.
+  ///
+  /// \param[out] requestedUnitsAccepted An integer that is set to \c true if
+  ///             the Model accepts the Simulator's requested base units, \c
+  ///             false otherwise.
+  /// \param[out] model Pointer to the newly created Model object.
+  ///
+  /// \return \c true if the Model was already retrieved by a previous call.
+  /// \return \c true under the same conditions as Model::Create.
+  /// \return \c false otherwise.
+  ///
+  /// \post \c requestedUnitsAccepted is unchanged and `model == NULL` if an
+  ///       error occurs.
+  ///
+  /// \sa KIM_PendingModel_Wait, kim_pending_model_module::kim_wait
+  ///
+  /// \since 2.5
+  int Wait(int * const requestedUnitsAccepted, Model ** const model);
+
+ private:
+  // do not allow copy constructor or operator=
+  PendingModel(PendingModel const &);
+  void operator=(PendingModel const &);
+
+  PendingModel();
+  ~PendingModel();
+
+  friend class Model;
+
+  PendingModelImplementation * pimpl;
+};  // class PendingModel
+}  // namespace KIM
+
+#endif  // KIM_PENDING_MODEL_HPP_
@@ -48,6 +48,10 @@
 #include "KIM_Model.hpp"
 #endif
 
+#ifndef KIM_PENDING_MODEL_HPP_
+#include "KIM_PendingModel.hpp"
+#endif
+
 #ifndef KIM_SIMULATOR_MODEL_HPP_
 #include "KIM_SimulatorModel.hpp"
 #endif
@@ -82,6 +82,11 @@ int Collections::GetItemType(std::string const & itemName,
   return pimpl->GetItemType(itemName, itemType);
 }
 
+int Collections::Prefetch(std::string const & itemName)
+{
+  return pimpl->Prefetch(itemName);
+}
+
 int Collections::GetItemLibraryFileNameAndCollection(
     CollectionItemType const itemType,
     std::string const & itemName,
@@ -57,6 +57,14 @@
 #include "KIM_SharedLibrary.hpp"
 #endif
 
+#ifndef KIM_THREADS_HPP_
+#include "KIM_Threads.hpp"
+#endif
+
+#ifndef KIM_TRACE_HPP_
+#include "KIM_Trace.hpp"
+#endif
+
 // log helpers
 #define SNUM(x)                                                \
   static_cast<std::ostringstream const &>(std::ostringstream() \
@@ -429,6 +437,12 @@ int PrivateGetItemLibraryFileNameByCollectionAndType(
 {
   namespace KC = KIM::COLLECTION;
 
+  // Items linked statically into the executable belong to the system
+  // collection and take precedence over its directories
+  if ((collection == KC::system)
+      && !KIM::SharedLibrary::GetStaticItemPath(itemType, itemName, fileName))
+    return false;
+
   ItemTypeToPathListMap dirsMap;
   if (collection == KC::system)
     PrivateGetSystemDirs(dirsMap);
@@ -510,6 +524,41 @@ int PrivateGetListOfItemMetadataFilesByCollectionAndType(
   return false;
 }
 
+// Process-wide registry of the items warmed by Collections::Prefetch.  Each
+// entry keeps the item's shared library open for the life of the process, so
+// that later opens are satisfied by the dynamic loader without searching the
+// collections or reading from disk.
+struct PrefetchedItem
+{
+  KIM::CollectionItemType itemType;
+  KIM::FILESYSTEM::Path fileName;
+  KIM::Collection collection;
+  KIM::Log * log;
+  KIM::SharedLibrary * sharedLibrary;
+};
+typedef std::map<std::string, PrefetchedItem> PrefetchRegistry;
+
+KIM::Mutex prefetchRegistryMutex;
+PrefetchRegistry prefetchRegistry;
+unsigned char volatile pageSink;
+
+int PrivateGetPrefetchedItem(KIM::CollectionItemType const itemType,
+                             std::string const & itemName,
+                             KIM::FILESYSTEM::Path * const fileName,
+                             KIM::Collection * const collection)
+{
+  KIM::MutexLock lock(prefetchRegistryMutex);
+
+  PrefetchRegistry::const_iterator const itr = prefetchRegistry.find(itemName);
+  if ((itr == prefetchRegistry.end()) || (itr->second.itemType != itemType))
+    return true;
+
+  if (fileName) *fileName = itr->second.fileName;
+  if (collection) *collection = itr->second.collection;
+
+  return false;
+}
+
 int PrivateGetItemLibraryFileNameAndCollection(
     KIM::CollectionItemType const itemType,
     std::string const & itemName,
@@ -519,6 +568,17 @@ int PrivateGetItemLibraryFileNameAndCollection(
 {
   namespace KC = KIM::COLLECTION;
 
+  // Items linked statically into the executable are used in preference to
+  // any shared library of the same name
+  if (!KIM::SharedLibrary::GetStaticItemPath(itemType, itemName, fileName))
+  {
+    if (collection) *collection = KC::system;
+    return false;
+  }
+
+  if (!PrivateGetPrefetchedItem(itemType, itemName, fileName, collection))
+    return false;
+
   KIM::FILESYSTEM::Path itemPath;
   KIM::Collection col;
   if (!PrivateGetItemLibraryFileNameByCollectionAndType(
@@ -604,6 +664,69 @@ int PrivateGetItemType(std::string const & itemName,
 
   return false;
 }
+
+int PrivatePrefetchItem(std::string const & itemName, KIM::Log * const log)
+{
+  using namespace KIM::COLLECTION_ITEM_TYPE;
+
+  {
+    KIM::MutexLock lock(prefetchRegistryMutex);
+    if (prefetchRegistry.find(itemName) != prefetchRegistry.end())
+      return false;
+  }
+
+  PrefetchedItem item;
+  if (PrivateGetItemType(itemName, log, &item.itemType)) return true;
+  if (PrivateGetItemLibraryFileNameAndCollection(
+          item.itemType, itemName, log, &item.fileName, &item.collection))
+    return true;
+
+  if (KIM::Log::Create(&item.log)) return true;
+  item.sharedLibrary = new KIM::SharedLibrary(item.log);
+  if (item.sharedLibrary->Open(item.fileName))
+  {
+    delete item.sharedLibrary;
+    KIM::Log::Destroy(&item.log);
+    return true;
+  }
+
+  std::string driverName;
+  if (item.itemType == portableModel)
+    item.sharedLibrary->GetDriverName(&driverName);
+
+  if ((item.itemType == simulatorModel) || (driverName != ""))
+  {
+    // Page in the embedded parameter files, one byte per page, so that
+    // extracting them at Model creation does not wait on the disk.
+    int numberOfParameterFiles = 0;
+    item.sharedLibrary->GetNumberOfParameterFiles(&numberOfParameterFiles);
+    for (int i = 0; i < numberOfParameterFiles; ++i)
+    {
+      unsigned int length;
+      unsigned char const * data;
+      if (item.sharedLibrary->GetParameterFile(i, NULL, &length, &data))
+        continue;
+      for (unsigned int j = 0; j < length; j += 4096) pageSink = data[j];
+    }
+  }
+
+  int alreadyRegistered;
+  {
+    KIM::MutexLock lock(prefetchRegistryMutex);
+    alreadyRegistered = !prefetchRegistry.insert(std::make_pair(itemName, item))
+                             .second;
+  }
+  if (alreadyRegistered)  // by another thread in the meantime
+  {
+    item.sharedLibrary->Close();
+    delete item.sharedLibrary;
+    KIM::Log::Destroy(&item.log);
+  }
+
+  if (driverName != "") return PrivatePrefetchItem(driverName, log);
+
+  return false;
+}
 }  // namespace
 
 
@@ -614,6 +737,8 @@ namespace KIM
 int CollectionsImplementation::Create(
     CollectionsImplementation ** const collectionsImplementation)
 {
+  TraceSpan const span("Collections::Create");
+
   // error checking of arguments performed as part of CollectionsCreate()
 
   Log * pLog;
@@ -718,6 +843,7 @@ int CollectionsImplementation::GetItemType(
       = "GetItemType(\"" + itemName + "\", " + SPTR(itemType) + ").";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Collections::GetItemType", itemName.c_str());
 
   CollectionItemType it;
   if (PrivateGetItemType(itemName, log_, &it))
@@ -733,6 +859,25 @@ int CollectionsImplementation::GetItemType(
   return false;
 }
 
+int CollectionsImplementation::Prefetch(std::string const & itemName)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "Prefetch(\"" + itemName + "\").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Collections::Prefetch", itemName.c_str());
+
+  if (PrivatePrefetchItem(itemName, log_))
+  {
+    LOG_ERROR("Unable to prefetch item.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
 int CollectionsImplementation::GetItemLibraryFileNameAndCollection(
     CollectionItemType const itemType,
     std::string const & itemName,
@@ -745,6 +890,8 @@ int CollectionsImplementation::GetItemLibraryFileNameAndCollection(
         + itemName + "\", " + SPTR(fileName) + ", " + SPTR(collection) + ").";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Collections::GetItemLibraryFileNameAndCollection",
+                       itemName.c_str());
 
 #if ERROR_VERBOSITY
   if (!itemType.Known())
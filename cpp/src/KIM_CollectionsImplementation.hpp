@@ -76,6 +76,8 @@ class CollectionsImplementation
   int GetItemType(std::string const & itemName,
                   CollectionItemType * const itemType) const;
 
+  int Prefetch(std::string const & itemName);
+
   int GetItemLibraryFileNameAndCollection(CollectionItemType const itemType,
                                           std::string const & itemName,
                                           std::string const ** const fileName,
@@ -53,6 +53,19 @@ ComputeArgumentName const partialForces(ID_partialForces);
 ComputeArgumentName const partialParticleEnergy(ID_partialParticleEnergy);
 ComputeArgumentName const partialVirial(ID_partialVirial);
 ComputeArgumentName const partialParticleVirial(ID_partialParticleVirial);
+ComputeArgumentName const partialParticleCost(ID_partialParticleCost);
+ComputeArgumentName const hessianBlockRowOffsets(ID_hessianBlockRowOffsets);
+ComputeArgumentName const
+    hessianBlockColumnIndices(ID_hessianBlockColumnIndices);
+ComputeArgumentName const partialHessianBlocks(ID_partialHessianBlocks);
+ComputeArgumentName const coordinatesFloat(ID_coordinatesFloat);
+ComputeArgumentName const partialForcesFloat(ID_partialForcesFloat);
+ComputeArgumentName const coordinatesX(ID_coordinatesX);
+ComputeArgumentName const coordinatesY(ID_coordinatesY);
+ComputeArgumentName const coordinatesZ(ID_coordinatesZ);
+ComputeArgumentName const partialForcesX(ID_partialForcesX);
+ComputeArgumentName const partialForcesY(ID_partialForcesY);
+ComputeArgumentName const partialForcesZ(ID_partialForcesZ);
 
 namespace
 {
@@ -73,6 +86,18 @@ StringMap const GetStringMap()
   m[partialParticleEnergy] = "partialParticleEnergy";
   m[partialVirial] = "partialVirial";
   m[partialParticleVirial] = "partialParticleVirial";
+  m[partialParticleCost] = "partialParticleCost";
+  m[hessianBlockRowOffsets] = "hessianBlockRowOffsets";
+  m[hessianBlockColumnIndices] = "hessianBlockColumnIndices";
+  m[partialHessianBlocks] = "partialHessianBlocks";
+  m[coordinatesFloat] = "coordinatesFloat";
+  m[partialForcesFloat] = "partialForcesFloat";
+  m[coordinatesX] = "coordinatesX";
+  m[coordinatesY] = "coordinatesY";
+  m[coordinatesZ] = "coordinatesZ";
+  m[partialForcesX] = "partialForcesX";
+  m[partialForcesY] = "partialForcesY";
+  m[partialForcesZ] = "partialForcesZ";
   return m;
 }
 
@@ -91,6 +116,7 @@ DataTypeMap const GetDataTypeMap()
 {  // Here we must assume that the DATA_TYPE:: constants are not initialized.
   int const Integer = 0;
   int const Double = 1;
+  int const Float = 2;
 
   DataTypeMap m;
   m[numberOfParticles] = DataType(Integer);
@@ -102,6 +128,18 @@ DataTypeMap const GetDataTypeMap()
   m[partialParticleEnergy] = DataType(Double);
   m[partialVirial] = DataType(Double);
   m[partialParticleVirial] = DataType(Double);
+  m[partialParticleCost] = DataType(Double);
+  m[hessianBlockRowOffsets] = DataType(Integer);
+  m[hessianBlockColumnIndices] = DataType(Integer);
+  m[partialHessianBlocks] = DataType(Double);
+  m[coordinatesFloat] = DataType(Float);
+  m[partialForcesFloat] = DataType(Float);
+  m[coordinatesX] = DataType(Double);
+  m[coordinatesY] = DataType(Double);
+  m[coordinatesZ] = DataType(Double);
+  m[partialForcesX] = DataType(Double);
+  m[partialForcesY] = DataType(Double);
+  m[partialForcesZ] = DataType(Double);
 
   return m;
 }
@@ -94,6 +94,18 @@ int ComputeArguments::SetArgumentPointer(
   return pimpl->SetArgumentPointer(computeArgumentName, ptr);
 }
 
+int ComputeArguments::SetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float const * const ptr)
+{
+  return pimpl->SetArgumentPointer(computeArgumentName, ptr);
+}
+
+int ComputeArguments::SetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float * const ptr)
+{
+  return pimpl->SetArgumentPointer(computeArgumentName, ptr);
+}
+
 int ComputeArguments::SetCallbackPointer(
     ComputeCallbackName const computeCallbackName,
     LanguageName const languageName,
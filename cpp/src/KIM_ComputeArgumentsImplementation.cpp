@@ -40,6 +40,10 @@
 #include "KIM_ComputeArgumentsImplementation.hpp"
 #endif
 
+#ifndef KIM_MODEL_STATISTICS_HPP_
+#include "KIM_ModelStatistics.hpp"
+#endif
+
 #ifndef KIM_FUNCTION_TYPES_H_
 extern "C" {
 #include "KIM_FunctionTypes.h"
@@ -60,6 +64,55 @@ extern std::vector<ComputeCallbackName> const requiredByAPI_ComputeCallbacks;
 }  // namespace COMPUTE_CALLBACK_NAME
 }  // namespace KIM
 
+namespace
+{
+// The variants of the coordinates and partialForces compute arguments: the
+// single-precision array and the three structure-of-arrays component arrays.
+// Variants, when supported and provided, stand in for their argument.
+int const numberOfVariants = 4;
+
+int GetVariants(KIM::ComputeArgumentName const computeArgumentName,
+                KIM::ComputeArgumentName variants[numberOfVariants])
+{
+  namespace CAN = KIM::COMPUTE_ARGUMENT_NAME;
+  if (computeArgumentName == CAN::coordinates)
+  {
+    variants[0] = CAN::coordinatesFloat;
+    variants[1] = CAN::coordinatesX;
+    variants[2] = CAN::coordinatesY;
+    variants[3] = CAN::coordinatesZ;
+    return true;
+  }
+  if (computeArgumentName == CAN::partialForces)
+  {
+    variants[0] = CAN::partialForcesFloat;
+    variants[1] = CAN::partialForcesX;
+    variants[2] = CAN::partialForcesY;
+    variants[3] = CAN::partialForcesZ;
+    return true;
+  }
+  return false;
+}
+
+// the argument that a variant stands in for, or the argument itself
+KIM::ComputeArgumentName
+GetVariantOf(KIM::ComputeArgumentName const computeArgumentName)
+{
+  namespace CAN = KIM::COMPUTE_ARGUMENT_NAME;
+  if ((computeArgumentName == CAN::coordinatesFloat)
+      || (computeArgumentName == CAN::coordinatesX)
+      || (computeArgumentName == CAN::coordinatesY)
+      || (computeArgumentName == CAN::coordinatesZ))
+    return CAN::coordinates;
+  if ((computeArgumentName == CAN::partialForcesFloat)
+      || (computeArgumentName == CAN::partialForcesX)
+      || (computeArgumentName == CAN::partialForcesY)
+      || (computeArgumentName == CAN::partialForcesZ))
+    return CAN::partialForces;
+  return computeArgumentName;
+}
+}  // namespace
+
 
 // log helpers
 #define SNUM(x)                                                \
@@ -173,22 +226,10 @@ int ComputeArgumentsImplementation::SetArgumentSupportStatus(
   }
 #endif
 
+  // pointer was initialized to NULL by the constructor
+  numberOfMissingRequired_ -= NumberOfMissing(computeArgumentName);
   computeArgumentSupportStatus_[computeArgumentName] = supportStatus;
-
-  // initialize pointer if not already done
-  if (supportStatus != SUPPORT_STATUS::notSupported)
-  {
-    std::map<ComputeArgumentName const,
-             void *,
-             COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-        = computeArgumentPointer_.find(computeArgumentName);
-
-    if (result == computeArgumentPointer_.end())
-    {
-      LOG_DEBUG("Initialize ComputeArgument pointer.");
-      computeArgumentPointer_[computeArgumentName] = NULL;
-    }
-  }
+  numberOfMissingRequired_ += NumberOfMissing(computeArgumentName);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -215,11 +256,9 @@ int ComputeArgumentsImplementation::GetArgumentSupportStatus(
   }
 #endif
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  *supportStatus = result->second;
+  SupportStatus const result
+      = computeArgumentSupportStatus_[computeArgumentName];
+  *supportStatus = result;
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -257,24 +296,10 @@ int ComputeArgumentsImplementation::SetCallbackSupportStatus(
   }
 #endif
 
+  // pointers were initialized to NULL by the constructor
+  numberOfMissingRequired_ -= IsMissing(computeCallbackName);
   computeCallbackSupportStatus_[computeCallbackName] = supportStatus;
-
-  // initialize pointer if not already done
-  if (supportStatus != SUPPORT_STATUS::notSupported)
-  {
-    std::map<ComputeCallbackName const,
-             Function *,
-             COMPUTE_CALLBACK_NAME::Comparator>::const_iterator result
-        = computeCallbackFunctionPointer_.find(computeCallbackName);
-
-    if (result == computeCallbackFunctionPointer_.end())
-    {
-      LOG_DEBUG("Initialize ComputeCallback pointer.");
-      computeCallbackLanguage_[computeCallbackName] = LANGUAGE_NAME::cpp;
-      computeCallbackFunctionPointer_[computeCallbackName] = NULL;
-      computeCallbackDataObjectPointer_[computeCallbackName] = NULL;
-    }
-  }
+  numberOfMissingRequired_ += IsMissing(computeCallbackName);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -301,11 +326,9 @@ int ComputeArgumentsImplementation::GetCallbackSupportStatus(
   }
 #endif
 
-  std::map<ComputeCallbackName const,
-           SupportStatus,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator result
-      = computeCallbackSupportStatus_.find(computeCallbackName);
-  *supportStatus = result->second;
+  SupportStatus const result
+      = computeCallbackSupportStatus_[computeCallbackName];
+  *supportStatus = result;
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -330,11 +353,9 @@ int ComputeArgumentsImplementation::SetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (result->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const result
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (result == SUPPORT_STATUS::notSupported)
   {
     if (ptr == NULL)
     {
@@ -356,8 +377,10 @@ int ComputeArgumentsImplementation::SetArgumentPointer(
   }
 #endif
 
+  numberOfMissingRequired_ -= NumberOfMissing(computeArgumentName);
   computeArgumentPointer_[computeArgumentName]
       = reinterpret_cast<void *>(const_cast<int *>(ptr));
+  numberOfMissingRequired_ += NumberOfMissing(computeArgumentName);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -388,11 +411,9 @@ int ComputeArgumentsImplementation::SetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (result->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const result
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (result == SUPPORT_STATUS::notSupported)
   {
     if (ptr == NULL)
     {
@@ -414,8 +435,10 @@ int ComputeArgumentsImplementation::SetArgumentPointer(
   }
 #endif
 
+  numberOfMissingRequired_ -= NumberOfMissing(computeArgumentName);
   computeArgumentPointer_[computeArgumentName]
       = reinterpret_cast<void *>(const_cast<double *>(ptr));
+  numberOfMissingRequired_ += NumberOfMissing(computeArgumentName);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -428,6 +451,65 @@ int ComputeArgumentsImplementation::SetArgumentPointer(
                             const_cast<double const *>(ptr));
 }
 
+int ComputeArgumentsImplementation::SetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float const * const ptr)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "SetArgumentPointer("
+                                 + computeArgumentName.ToString() + ", "
+                                 + SPTR(ptr) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  int error = (!computeArgumentName.Known());
+  if (error)
+  {
+    LOG_ERROR("Invalid arguments.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  SupportStatus const result
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (result == SUPPORT_STATUS::notSupported)
+  {
+    if (ptr == NULL)
+    {
+      LOG_WARNING("Setting 'notSupported' ComputeArgument '"
+                  + computeArgumentName.ToString()
+                  + "' pointer to NULL.  This action, although innocuous, "
+                    "is considered an error and should be avoided.");
+      LOG_DEBUG("Exit 0=" + callString);
+      return false;  // allow innocuous behavior
+    }
+    else
+    {
+      LOG_ERROR("Pointer value cannot be set for ComputeArgument '"
+                + computeArgumentName.ToString()
+                + "' which is 'notSupported'.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+  }
+#endif
+
+  numberOfMissingRequired_ -= NumberOfMissing(computeArgumentName);
+  computeArgumentPointer_[computeArgumentName]
+      = reinterpret_cast<void *>(const_cast<float *>(ptr));
+  numberOfMissingRequired_ += NumberOfMissing(computeArgumentName);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ComputeArgumentsImplementation::SetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float * const ptr)
+{
+  return SetArgumentPointer(computeArgumentName,
+                            const_cast<float const *>(ptr));
+}
+
 int ComputeArgumentsImplementation::GetArgumentPointer(
     ComputeArgumentName const computeArgumentName, int const ** const ptr) const
 {
@@ -447,25 +529,20 @@ int ComputeArgumentsImplementation::GetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator statusResult
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (statusResult->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
   {
     LOG_ERROR("Pointer value does not exist for ComputeArgument '"
-              + (statusResult->first).ToString()
+              + computeArgumentName.ToString()
               + "' which is 'notSupported'.");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
 
-  std::map<ComputeArgumentName const,
-           void *,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentPointer_.find(computeArgumentName);
-  *ptr = reinterpret_cast<int const *>(result->second);
+  void * const result = computeArgumentPointer_[computeArgumentName];
+  *ptr = reinterpret_cast<int const *>(result);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -490,26 +567,21 @@ int ComputeArgumentsImplementation::GetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator statusResult
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (statusResult->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
   {
     LOG_ERROR("Pointer value does not exist for ComputeArgument '"
-              + (statusResult->first).ToString()
+              + computeArgumentName.ToString()
               + "' which is 'notSupported'.");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
 
-  std::map<ComputeArgumentName const,
-           void *,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentPointer_.find(computeArgumentName);
+  void * const result = computeArgumentPointer_[computeArgumentName];
 
-  *ptr = reinterpret_cast<int *>(result->second);
+  *ptr = reinterpret_cast<int *>(result);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -535,26 +607,21 @@ int ComputeArgumentsImplementation::GetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator statusResult
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (statusResult->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
   {
     LOG_ERROR("Pointer value does not exist for ComputeArgument '"
-              + (statusResult->first).ToString()
+              + computeArgumentName.ToString()
               + "' which is 'notSupported'.");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
 
-  std::map<ComputeArgumentName const,
-           void *,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentPointer_.find(computeArgumentName);
+  void * const result = computeArgumentPointer_[computeArgumentName];
 
-  *ptr = reinterpret_cast<double const *>(result->second);
+  *ptr = reinterpret_cast<double const *>(result);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -579,26 +646,100 @@ int ComputeArgumentsImplementation::GetArgumentPointer(
     return true;
   }
 
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator statusResult
-      = computeArgumentSupportStatus_.find(computeArgumentName);
-  if (statusResult->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
+  {
+    LOG_ERROR("Pointer value does not exist for ComputeArgument '"
+              + computeArgumentName.ToString()
+              + "' which is 'notSupported'.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  void * const result = computeArgumentPointer_[computeArgumentName];
+
+  *ptr = reinterpret_cast<double *>(result);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ComputeArgumentsImplementation::GetArgumentPointer(
+    ComputeArgumentName const computeArgumentName,
+    float const ** const ptr) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetArgumentPointer("
+                                 + computeArgumentName.ToString() + ", "
+                                 + SPTR(ptr) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  int error = (!computeArgumentName.Known());
+  if (error)
+  {
+    LOG_ERROR("Invalid arguments.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
   {
     LOG_ERROR("Pointer value does not exist for ComputeArgument '"
-              + (statusResult->first).ToString()
+              + computeArgumentName.ToString()
               + "' which is 'notSupported'.");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
 
-  std::map<ComputeArgumentName const,
-           void *,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator result
-      = computeArgumentPointer_.find(computeArgumentName);
+  void * const result = computeArgumentPointer_[computeArgumentName];
 
-  *ptr = reinterpret_cast<double *>(result->second);
+  *ptr = reinterpret_cast<float const *>(result);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ComputeArgumentsImplementation::GetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float ** const ptr) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetArgumentPointer("
+                                 + computeArgumentName.ToString() + ", "
+                                 + SPTR(ptr) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  int error = (!computeArgumentName.Known());
+  if (error)
+  {
+    LOG_ERROR("Invalid arguments.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  SupportStatus const statusResult
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
+  {
+    LOG_ERROR("Pointer value does not exist for ComputeArgument '"
+              + computeArgumentName.ToString()
+              + "' which is 'notSupported'.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  void * const result = computeArgumentPointer_[computeArgumentName];
+
+  *ptr = reinterpret_cast<float *>(result);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -627,12 +768,10 @@ int ComputeArgumentsImplementation::SetCallbackPointer(
     return true;
   }
 
-  std::map<ComputeCallbackName const,
-           SupportStatus,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator result
-      = computeCallbackSupportStatus_.find(computeCallbackName);
+  SupportStatus const result
+      = computeCallbackSupportStatus_[computeCallbackName];
 
-  if (result->second == SUPPORT_STATUS::notSupported)
+  if (result == SUPPORT_STATUS::notSupported)
   {
     if (fptr == NULL)
     {
@@ -653,8 +792,10 @@ int ComputeArgumentsImplementation::SetCallbackPointer(
   }
 #endif
 
+  numberOfMissingRequired_ -= IsMissing(computeCallbackName);
   computeCallbackLanguage_[computeCallbackName] = languageName;
   computeCallbackFunctionPointer_[computeCallbackName] = fptr;
+  numberOfMissingRequired_ += IsMissing(computeCallbackName);
   computeCallbackDataObjectPointer_[computeCallbackName] = dataObject;
 
   LOG_DEBUG("Exit 0=" + callString);
@@ -680,26 +821,22 @@ int ComputeArgumentsImplementation::IsCallbackPresent(
     return true;
   }
 
-  std::map<ComputeCallbackName const,
-           SupportStatus,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator statusResult
-      = computeCallbackSupportStatus_.find(computeCallbackName);
-  if (statusResult->second == SUPPORT_STATUS::notSupported)
+  SupportStatus const statusResult
+      = computeCallbackSupportStatus_[computeCallbackName];
+  if (statusResult == SUPPORT_STATUS::notSupported)
   {
     LOG_ERROR("Pointer value does not exist for ComputeCallback '"
-              + (statusResult->first).ToString()
+              + computeCallbackName.ToString()
               + "' which is 'notSupported'.");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
 
-  std::map<ComputeCallbackName const,
-           Function *,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator result
-      = computeCallbackFunctionPointer_.find(computeCallbackName);
+  Function * const result
+      = computeCallbackFunctionPointer_[computeCallbackName];
 
-  if (result->second == NULL) { *present = false; }
+  if (result == NULL) { *present = false; }
   else { *present = true; }
 
   LOG_DEBUG("Exit 0=" + callString);
@@ -715,20 +852,27 @@ void ComputeArgumentsImplementation::AreAllRequiredArgumentsAndCallbacksPresent(
 #endif
   LOG_DEBUG("Enter  " + callString);
 
+  if (numberOfMissingRequired_ == 0)
+  {
+    *result = true;
+    LOG_DEBUG("Exit   " + callString);
+    return;
+  }
+
+  // Find the first missing one so that it can be reported
+
   // Check that all required compute arguments are present
-  for (std::map<ComputeArgumentName const,
-                SupportStatus,
-                COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator itr
-       = computeArgumentSupportStatus_.begin();
-       itr != computeArgumentSupportStatus_.end();
-       ++itr)
-  {
-    if ((itr->second == SUPPORT_STATUS::requiredByAPI)
-        || (itr->second == SUPPORT_STATUS::required))
+  for (int i = 0; i < computeArgumentSupportStatus_.Size(); ++i)
+  {
+    ComputeArgumentName const computeArgumentName(i);
+    SupportStatus const supportStatus
+        = computeArgumentSupportStatus_[computeArgumentName];
+    if ((supportStatus == SUPPORT_STATUS::requiredByAPI)
+        || (supportStatus == SUPPORT_STATUS::required))
     {
-      if (computeArgumentPointer_.find(itr->first)->second == NULL)
+      if (IsMissing(computeArgumentName))
       {
-        LOG_ERROR("Required ComputeArgument '" + (itr->first).ToString()
+        LOG_ERROR("Required ComputeArgument '" + computeArgumentName.ToString()
                   + "' is not present.");
 
         *result = false;
@@ -739,19 +883,17 @@ void ComputeArgumentsImplementation::AreAllRequiredArgumentsAndCallbacksPresent(
   }
 
   // Check that all required callbacks are present
-  for (std::map<ComputeCallbackName const,
-                SupportStatus,
-                COMPUTE_CALLBACK_NAME::Comparator>::const_iterator itr
-       = computeCallbackSupportStatus_.begin();
-       itr != computeCallbackSupportStatus_.end();
-       ++itr)
-  {
-    if ((itr->second == SUPPORT_STATUS::requiredByAPI)
-        || (itr->second == SUPPORT_STATUS::required))
+  for (int i = 0; i < computeCallbackSupportStatus_.Size(); ++i)
+  {
+    ComputeCallbackName const computeCallbackName(i);
+    SupportStatus const supportStatus
+        = computeCallbackSupportStatus_[computeCallbackName];
+    if ((supportStatus == SUPPORT_STATUS::requiredByAPI)
+        || (supportStatus == SUPPORT_STATUS::required))
     {
-      if (computeCallbackFunctionPointer_.find(itr->first)->second == NULL)
+      if (computeCallbackFunctionPointer_[computeCallbackName] == NULL)
       {
-        LOG_ERROR("Required ComputeCallback '" + (itr->first).ToString()
+        LOG_ERROR("Required ComputeCallback '" + computeCallbackName.ToString()
                   + "' is not present.");
 
         *result = false;
@@ -766,6 +908,44 @@ void ComputeArgumentsImplementation::AreAllRequiredArgumentsAndCallbacksPresent(
   return;
 }
 
+int ComputeArgumentsImplementation::HasSameInputs(
+    ComputeArgumentsImplementation const & other) const
+{
+  // the input arguments; all other arguments are outputs
+  ComputeArgumentName const inputs[] = {
+      COMPUTE_ARGUMENT_NAME::numberOfParticles,
+      COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+      COMPUTE_ARGUMENT_NAME::particleContributing,
+      COMPUTE_ARGUMENT_NAME::coordinates,
+      COMPUTE_ARGUMENT_NAME::coordinatesFloat,
+      COMPUTE_ARGUMENT_NAME::coordinatesX,
+      COMPUTE_ARGUMENT_NAME::coordinatesY,
+      COMPUTE_ARGUMENT_NAME::coordinatesZ};
+  int const numberOfInputs = sizeof(inputs) / sizeof(inputs[0]);
+
+  for (int i = 0; i < numberOfInputs; ++i)
+  {
+    if (computeArgumentPointer_[inputs[i]]
+        != other.computeArgumentPointer_[inputs[i]])
+      return false;
+  }
+
+  for (int i = 0; i < computeCallbackSupportStatus_.Size(); ++i)
+  {
+    ComputeCallbackName const cbName(i);
+    if ((computeCallbackFunctionPointer_[cbName]
+         != other.computeCallbackFunctionPointer_[cbName])
+        || (computeCallbackDataObjectPointer_[cbName]
+            != other.computeCallbackDataObjectPointer_[cbName])
+        || (computeCallbackLanguage_[cbName]
+            != other.computeCallbackLanguage_[cbName]))
+      return false;
+  }
+
+  return (numberingOffset_ == other.numberingOffset_)
+         && (translateNeighborNumbering_ == other.translateNeighborNumbering_);
+}
+
 int ComputeArgumentsImplementation::GetNeighborList(
     int const neighborListIndex,
     int const particleNumber,
@@ -791,12 +971,8 @@ int ComputeArgumentsImplementation::GetNeighborList(
 
   int zeroBasedParticleNumber
       = particleNumber + ((NUMBERING::zeroBased == modelNumbering_) ? 0 : -1);
-  std::map<ComputeArgumentName const,
-           void *,
-           COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator pointerResult
-      = computeArgumentPointer_.find(COMPUTE_ARGUMENT_NAME::numberOfParticles);
-  int const * numberOfParticles
-      = reinterpret_cast<int const *>(pointerResult->second);
+  int const * numberOfParticles = reinterpret_cast<int const *>(
+      computeArgumentPointer_[COMPUTE_ARGUMENT_NAME::numberOfParticles]);
   if ((zeroBasedParticleNumber < 0)
       || (zeroBasedParticleNumber >= *(numberOfParticles)))
   {
@@ -806,19 +982,45 @@ int ComputeArgumentsImplementation::GetNeighborList(
   }
 #endif
 
-  std::map<ComputeCallbackName const,
-           LanguageName,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator languageResult
-      = computeCallbackLanguage_.find(COMPUTE_CALLBACK_NAME::GetNeighborList);
+  // the list is a prefix of the master list, if the simulator provides one
+  if (IsNestedNeighborListsCallbackPresent())
+  {
+    int const * simulatorNeighborsOfParticle;
+    if (GetNestedMasterList(particleNumber, &simulatorNeighborsOfParticle))
+    {
+      // LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+    *numberOfNeighbors
+        = getNestedNeighborListsNumberOfNeighbors_[neighborListIndex];
+    if (statistics_ != NULL) statistics_->neighborsServed += *numberOfNeighbors;
+
+    // account for numbering differences if needed
+    if ((simulatorNumbering_ != modelNumbering_) && translateNeighborNumbering_)
+    {
+      std::vector<int> & list = getNeighborListStorage_[neighborListIndex];
+      list.resize(*numberOfNeighbors);
+      for (int i = 0; i < *numberOfNeighbors; ++i)
+        list[i] = simulatorNeighborsOfParticle[i] + numberingOffset_;
+
+      *neighborsOfParticle = list.data();
+    }
+    else
+    {
+      *neighborsOfParticle = simulatorNeighborsOfParticle;
+    }
+
+    // LOG_DEBUG("Exit 0=" + callString);
+    return false;
+  }
 
-  LanguageName const languageName = languageResult->second;
-  void const * dataObject = (computeCallbackDataObjectPointer_.find(
-                                 COMPUTE_CALLBACK_NAME::GetNeighborList))
-                                ->second;
+  LanguageName const languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::GetNeighborList];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::GetNeighborList];
 
-  Function * functionPointer = (computeCallbackFunctionPointer_.find(
-                                    COMPUTE_CALLBACK_NAME::GetNeighborList))
-                                   ->second;
+  Function * functionPointer
+      = computeCallbackFunctionPointer_[COMPUTE_CALLBACK_NAME::GetNeighborList];
   GetNeighborListFunction * CppGetNeighborList
       = reinterpret_cast<GetNeighborListFunction *>(functionPointer);
   KIM_GetNeighborListFunction * CGetNeighborList
@@ -840,6 +1042,8 @@ int ComputeArgumentsImplementation::GetNeighborList(
         + ((simulatorNumbering_ == modelNumbering_) ? 0 : -numberingOffset_);
   int const * simulatorNeighborsOfParticle;
   int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
   if (languageName == LANGUAGE_NAME::cpp)
   {
     error = CppGetNeighborList(const_cast<void *>(dataObject),
@@ -878,6 +1082,13 @@ int ComputeArgumentsImplementation::GetNeighborList(
     return true;
   }
 
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->neighborListCalls);
+    statistics_->neighborListTime += ModelStatistics::WallTime() - startTime;
+    if (!error) statistics_->neighborsServed += *numberOfNeighbors;
+  }
+
   if (error)
   {
     LOG_ERROR("Simulator supplied GetNeighborList() routine returned error.");
@@ -886,7 +1097,7 @@ int ComputeArgumentsImplementation::GetNeighborList(
   }
 
   // account for numbering differences if needed
-  if (simulatorNumbering_ != modelNumbering_)
+  if ((simulatorNumbering_ != modelNumbering_) && translateNeighborNumbering_)
   {
     // LOG_DEBUG("Numbering conversion is required.");
 
@@ -908,6 +1119,389 @@ int ComputeArgumentsImplementation::GetNeighborList(
   return false;
 }
 
+int ComputeArgumentsImplementation::GetNeighborListWithDisplacements(
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors) const
+{
+  // No debug logging for callbacks: too expensive
+
+#if ERROR_VERBOSITY
+  if ((neighborListIndex < 0) || (neighborListIndex >= numberOfNeighborLists_))
+  {
+    LOG_ERROR("Invalid neighborListIndex, " + SNUM(neighborListIndex) + ".");
+    return true;
+  }
+
+  int zeroBasedParticleNumber
+      = particleNumber + ((NUMBERING::zeroBased == modelNumbering_) ? 0 : -1);
+  int const * numberOfParticles = reinterpret_cast<int const *>(
+      computeArgumentPointer_[COMPUTE_ARGUMENT_NAME::numberOfParticles]);
+  if ((zeroBasedParticleNumber < 0)
+      || (zeroBasedParticleNumber >= *(numberOfParticles)))
+  {
+    LOG_ERROR("Invalid particleNumber, " + SNUM(zeroBasedParticleNumber) + ".");
+    return true;
+  }
+#endif
+
+  Function * functionPointer = computeCallbackFunctionPointer_
+      [COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements];
+  if (functionPointer == NULL)
+  {
+    LOG_ERROR("Simulator did not provide the GetNeighborListWithDisplacements "
+              "callback.");
+    return true;
+  }
+
+  LanguageName const languageName = computeCallbackLanguage_
+      [COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements];
+  GetNeighborListWithDisplacementsFunction * CppGetNeighborList
+      = reinterpret_cast<GetNeighborListWithDisplacementsFunction *>(
+          functionPointer);
+  KIM_GetNeighborListWithDisplacementsFunction * CGetNeighborList
+      = reinterpret_cast<KIM_GetNeighborListWithDisplacementsFunction *>(
+          functionPointer);
+  typedef void GetNeighborListWithDisplacementsF(
+      void * const dataObject,
+      int const numberOfNeighborLists,
+      double const * const cutoffs,
+      int const neighborListIndex,
+      int const particleNumber,
+      int * const numberOfNeighbors,
+      int const ** const neighborsOfParticle,
+      double const ** const displacementsOfNeighbors,
+      double const ** const squaredDistancesOfNeighbors,
+      int * const ierr);
+  GetNeighborListWithDisplacementsF * FGetNeighborList
+      = reinterpret_cast<GetNeighborListWithDisplacementsF *>(functionPointer);
+
+
+  int simulatorParticleNumber
+      = particleNumber
+        + ((simulatorNumbering_ == modelNumbering_) ? 0 : -numberingOffset_);
+  int const * simulatorNeighborsOfParticle;
+  double const * squaredDistances = NULL;
+  int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
+  if (languageName == LANGUAGE_NAME::cpp)
+  {
+    error = CppGetNeighborList(const_cast<void *>(dataObject),
+                               numberOfNeighborLists_,
+                               cutoffs_,
+                               neighborListIndex,
+                               simulatorParticleNumber,
+                               numberOfNeighbors,
+                               &simulatorNeighborsOfParticle,
+                               displacementsOfNeighbors,
+                               &squaredDistances);
+  }
+  else if (languageName == LANGUAGE_NAME::c)
+  {
+    error = CGetNeighborList(const_cast<void *>(dataObject),
+                             numberOfNeighborLists_,
+                             cutoffs_,
+                             neighborListIndex,
+                             simulatorParticleNumber,
+                             numberOfNeighbors,
+                             &simulatorNeighborsOfParticle,
+                             displacementsOfNeighbors,
+                             &squaredDistances);
+  }
+  else if (languageName == LANGUAGE_NAME::fortran)
+  {
+    FGetNeighborList(const_cast<void *>(dataObject),
+                     numberOfNeighborLists_,
+                     cutoffs_,
+                     neighborListIndex + 1,
+                     simulatorParticleNumber,
+                     numberOfNeighbors,
+                     &simulatorNeighborsOfParticle,
+                     displacementsOfNeighbors,
+                     &squaredDistances,
+                     &error);
+  }
+  else
+  {
+    LOG_ERROR("Unknown LanguageName.  SHOULD NEVER GET HERE.");
+    return true;
+  }
+
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->neighborListCalls);
+    statistics_->neighborListTime += ModelStatistics::WallTime() - startTime;
+    if (!error) statistics_->neighborsServed += *numberOfNeighbors;
+  }
+
+  if (error)
+  {
+    LOG_ERROR("Simulator supplied GetNeighborListWithDisplacements() routine "
+              "returned error.");
+    return true;
+  }
+
+  if (squaredDistancesOfNeighbors != NULL)
+    *squaredDistancesOfNeighbors = squaredDistances;
+
+  // account for numbering differences if needed
+  if ((simulatorNumbering_ != modelNumbering_) && translateNeighborNumbering_)
+  {
+    std::vector<int> & list = getNeighborListStorage_[neighborListIndex];
+    list.resize(*numberOfNeighbors);
+    for (int i = 0; i < *numberOfNeighbors; ++i)
+      list[i] = simulatorNeighborsOfParticle[i] + numberingOffset_;
+
+    *neighborsOfParticle = list.data();
+  }
+  else
+  {
+    *neighborsOfParticle = simulatorNeighborsOfParticle;
+  }
+
+  return false;
+}
+
+int ComputeArgumentsImplementation::GetNeighborLists(
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle) const
+{
+  // No debug logging for callbacks: too expensive
+
+  if (!IsNestedNeighborListsCallbackPresent())
+  {
+    // fall back to one GetNeighborList callback per list
+    for (int i = 0; i < numberOfNeighborLists_; ++i)
+    {
+      if (GetNeighborList(i,
+                          particleNumber,
+                          &(numberOfNeighbors[i]),
+                          &(neighborsOfParticle[i])))
+        return true;
+    }
+    return false;
+  }
+
+#if ERROR_VERBOSITY
+  int zeroBasedParticleNumber
+      = particleNumber + ((NUMBERING::zeroBased == modelNumbering_) ? 0 : -1);
+  int const * numberOfParticles = reinterpret_cast<int const *>(
+      computeArgumentPointer_[COMPUTE_ARGUMENT_NAME::numberOfParticles]);
+  if ((zeroBasedParticleNumber < 0)
+      || (zeroBasedParticleNumber >= *(numberOfParticles)))
+  {
+    LOG_ERROR("Invalid particleNumber, " + SNUM(zeroBasedParticleNumber) + ".");
+    return true;
+  }
+#endif
+
+  int const * simulatorNeighborsOfParticle;
+  if (GetNestedMasterList(particleNumber, &simulatorNeighborsOfParticle))
+    return true;
+  int longest = 0;
+  for (int i = 0; i < numberOfNeighborLists_; ++i)
+  {
+    numberOfNeighbors[i] = getNestedNeighborListsNumberOfNeighbors_[i];
+    if (numberOfNeighbors[i] > longest) longest = numberOfNeighbors[i];
+  }
+  // the lists share the neighbors of the longest one
+  if (statistics_ != NULL) statistics_->neighborsServed += longest;
+
+  // every list is a prefix of the master list
+  int const * masterList = simulatorNeighborsOfParticle;
+
+  // account for numbering differences if needed
+  if ((simulatorNumbering_ != modelNumbering_) && translateNeighborNumbering_)
+  {
+    std::vector<int> & list = getNestedNeighborListsStorage_;
+    list.resize(longest);
+    for (int i = 0; i < longest; ++i)
+      list[i] = simulatorNeighborsOfParticle[i] + numberingOffset_;
+
+    masterList = list.data();
+  }
+
+  for (int i = 0; i < numberOfNeighborLists_; ++i)
+    neighborsOfParticle[i] = masterList;
+
+  return false;
+}
+
+int ComputeArgumentsImplementation::IsNestedNeighborListsCallbackPresent()
+    const
+{
+  return IsCallbackFunctionPresent(
+      COMPUTE_CALLBACK_NAME::GetNestedNeighborLists);
+}
+
+int ComputeArgumentsImplementation::IsCallbackFunctionPresent(
+    ComputeCallbackName const computeCallbackName) const
+{
+  return (computeCallbackFunctionPointer_[computeCallbackName] != NULL);
+}
+
+int ComputeArgumentsImplementation::IsMissing(
+    ComputeArgumentName const computeArgumentName) const
+{
+  SupportStatus const supportStatus
+      = computeArgumentSupportStatus_[computeArgumentName];
+  if (((supportStatus != SUPPORT_STATUS::requiredByAPI)
+       && (supportStatus != SUPPORT_STATUS::required))
+      || (computeArgumentPointer_[computeArgumentName] != NULL))
+    return false;
+
+  // the single-precision array alone, or all three component arrays
+  ComputeArgumentName variants[numberOfVariants];
+  if (!GetVariants(computeArgumentName, variants)) return true;
+
+  int provided[numberOfVariants];
+  for (int i = 0; i < numberOfVariants; ++i)
+  {
+    provided[i] = ((computeArgumentSupportStatus_[variants[i]]
+                    != SUPPORT_STATUS::notSupported)
+                   && (computeArgumentPointer_[variants[i]] != NULL));
+  }
+  return !(provided[0] || (provided[1] && provided[2] && provided[3]));
+}
+
+int ComputeArgumentsImplementation::NumberOfMissing(
+    ComputeArgumentName const computeArgumentName) const
+{
+  // setting a variant also affects the argument it stands in for
+  ComputeArgumentName const variantOf = GetVariantOf(computeArgumentName);
+  if (variantOf == computeArgumentName)
+    return IsMissing(computeArgumentName);
+  else
+    return IsMissing(computeArgumentName) + IsMissing(variantOf);
+}
+
+int ComputeArgumentsImplementation::IsMissing(
+    ComputeCallbackName const computeCallbackName) const
+{
+  SupportStatus const supportStatus
+      = computeCallbackSupportStatus_[computeCallbackName];
+  return (((supportStatus == SUPPORT_STATUS::requiredByAPI)
+           || (supportStatus == SUPPORT_STATUS::required))
+          && (computeCallbackFunctionPointer_[computeCallbackName] == NULL));
+}
+
+int ComputeArgumentsImplementation::GetNestedMasterList(
+    int const particleNumber,
+    int const ** const simulatorNeighborsOfParticle) const
+{
+  // a Model typically asks for each list of a particle in turn
+  if (nestedMasterListCached_ && (nestedMasterListParticle_ == particleNumber))
+  {
+    *simulatorNeighborsOfParticle = nestedMasterList_;
+    return false;
+  }
+
+  nestedMasterListCached_ = false;
+  if (CallGetNestedNeighborLists(
+          particleNumber,
+          getNestedNeighborListsNumberOfNeighbors_.data(),
+          simulatorNeighborsOfParticle))
+    return true;
+
+  nestedMasterListCached_ = true;
+  nestedMasterListParticle_ = particleNumber;
+  nestedMasterList_ = *simulatorNeighborsOfParticle;
+  return false;
+}
+
+int ComputeArgumentsImplementation::CallGetNestedNeighborLists(
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const simulatorNeighborsOfParticle) const
+{
+  // No debug logging for callbacks: too expensive
+
+  LanguageName const languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::GetNestedNeighborLists];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::GetNestedNeighborLists];
+
+  Function * functionPointer
+      = computeCallbackFunctionPointer_
+        [COMPUTE_CALLBACK_NAME::GetNestedNeighborLists];
+  GetNestedNeighborListsFunction * CppGetNestedNeighborLists
+      = reinterpret_cast<GetNestedNeighborListsFunction *>(functionPointer);
+  KIM_GetNestedNeighborListsFunction * CGetNestedNeighborLists
+      = reinterpret_cast<KIM_GetNestedNeighborListsFunction *>(functionPointer);
+  typedef void GetNestedNeighborListsF(void * const dataObject,
+                                       int const numberOfNeighborLists,
+                                       double const * const cutoffs,
+                                       int const particleNumber,
+                                       int * const numberOfNeighbors,
+                                       int const ** const neighborsOfParticle,
+                                       int * const ierr);
+  GetNestedNeighborListsF * FGetNestedNeighborLists
+      = reinterpret_cast<GetNestedNeighborListsF *>(functionPointer);
+
+
+  int simulatorParticleNumber
+      = particleNumber
+        + ((simulatorNumbering_ == modelNumbering_) ? 0 : -numberingOffset_);
+  int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
+  if (languageName == LANGUAGE_NAME::cpp)
+  {
+    error = CppGetNestedNeighborLists(const_cast<void *>(dataObject),
+                                      numberOfNeighborLists_,
+                                      cutoffs_,
+                                      simulatorParticleNumber,
+                                      numberOfNeighbors,
+                                      simulatorNeighborsOfParticle);
+  }
+  else if (languageName == LANGUAGE_NAME::c)
+  {
+    error = CGetNestedNeighborLists(const_cast<void *>(dataObject),
+                                    numberOfNeighborLists_,
+                                    cutoffs_,
+                                    simulatorParticleNumber,
+                                    numberOfNeighbors,
+                                    simulatorNeighborsOfParticle);
+  }
+  else if (languageName == LANGUAGE_NAME::fortran)
+  {
+    FGetNestedNeighborLists(const_cast<void *>(dataObject),
+                            numberOfNeighborLists_,
+                            cutoffs_,
+                            simulatorParticleNumber,
+                            numberOfNeighbors,
+                            simulatorNeighborsOfParticle,
+                            &error);
+  }
+  else
+  {
+    LOG_ERROR("Unknown LanguageName.  SHOULD NEVER GET HERE.");
+    return true;
+  }
+
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->neighborListCalls);
+    statistics_->neighborListTime += ModelStatistics::WallTime() - startTime;
+  }
+
+  if (error)
+  {
+    LOG_ERROR("Simulator supplied GetNestedNeighborLists() routine returned "
+              "error.");
+    return true;
+  }
+
+  return false;
+}
+
 int ComputeArgumentsImplementation::ProcessDEDrTerm(double const de,
                                                     double const r,
                                                     double const * const dx,
@@ -923,19 +1517,22 @@ int ComputeArgumentsImplementation::ProcessDEDrTerm(double const de,
   // #endif
   //   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ComputeCallbackName const,
-           LanguageName,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator languageResult
-      = computeCallbackLanguage_.find(COMPUTE_CALLBACK_NAME::ProcessDEDrTerm);
+  Function * functionPointer
+      = computeCallbackFunctionPointer_[COMPUTE_CALLBACK_NAME::ProcessDEDrTerm];
+  if (functionPointer == NULL)
+  {
+    if (IsCallbackFunctionPresent(COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch))
+      return ProcessDEDrTermBatch(1, &de, &r, dx, &i, &j);
+
+    LOG_ERROR("Simulator did not provide a ProcessDEDrTerm() routine.");
+    return true;
+  }
 
-  LanguageName languageName = languageResult->second;
-  void const * dataObject = (computeCallbackDataObjectPointer_.find(
-                                 COMPUTE_CALLBACK_NAME::ProcessDEDrTerm))
-                                ->second;
+  LanguageName languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::ProcessDEDrTerm];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessDEDrTerm];
 
-  Function * functionPointer = (computeCallbackFunctionPointer_.find(
-                                    COMPUTE_CALLBACK_NAME::ProcessDEDrTerm))
-                                   ->second;
   ProcessDEDrTermFunction * CppProcess_dEdr
       = reinterpret_cast<ProcessDEDrTermFunction *>(functionPointer);
   KIM_ProcessDEDrTermFunction * CProcess_dEdr
@@ -956,6 +1553,8 @@ int ComputeArgumentsImplementation::ProcessDEDrTerm(double const de,
   int simulatorJ = j + offset;
 
   int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
   if (languageName == LANGUAGE_NAME::cpp)
   {
     error = CppProcess_dEdr(
@@ -983,6 +1582,12 @@ int ComputeArgumentsImplementation::ProcessDEDrTerm(double const de,
     return true;
   }
 
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->processTermCalls);
+    statistics_->processTermTime += ModelStatistics::WallTime() - startTime;
+  }
+
   if (error)
   {
     LOG_ERROR("Simulator supplied ProcessDEDrTerm() routine returned error.");
@@ -1010,19 +1615,23 @@ int ComputeArgumentsImplementation::ProcessD2EDr2Term(double const de,
   //       + SPTR(i) + ", " + SPTR(j) + ").";
   // #endif
   //   LOG_DEBUG("Enter  " + callString);
-  std::map<ComputeCallbackName const,
-           LanguageName,
-           COMPUTE_CALLBACK_NAME::Comparator>::const_iterator languageResult
-      = computeCallbackLanguage_.find(COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term);
-
-  LanguageName languageName = languageResult->second;
-  void const * dataObject = (computeCallbackDataObjectPointer_.find(
-                                 COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term))
-                                ->second;
-
-  Function * functionPointer = (computeCallbackFunctionPointer_.find(
-                                    COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term))
-                                   ->second;
+  Function * functionPointer = computeCallbackFunctionPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term];
+  if (functionPointer == NULL)
+  {
+    if (IsCallbackFunctionPresent(
+            COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch))
+      return ProcessD2EDr2TermBatch(1, &de, r, dx, i, j);
+
+    LOG_ERROR("Simulator did not provide a ProcessD2EDr2Term() routine.");
+    return true;
+  }
+
+  LanguageName languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term];
+
   ProcessD2EDr2TermFunction * CppProcess_d2Edr2
       = reinterpret_cast<ProcessD2EDr2TermFunction *>(functionPointer);
   KIM_ProcessD2EDr2TermFunction * CProcess_d2Edr2
@@ -1048,6 +1657,8 @@ int ComputeArgumentsImplementation::ProcessD2EDr2Term(double const de,
   simulatorJ[1] = j[1] + offset;
 
   int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
   if (languageName == LANGUAGE_NAME::cpp)
   {
     error = CppProcess_d2Edr2(
@@ -1075,6 +1686,12 @@ int ComputeArgumentsImplementation::ProcessD2EDr2Term(double const de,
     return true;
   }
 
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->processTermCalls);
+    statistics_->processTermTime += ModelStatistics::WallTime() - startTime;
+  }
+
   if (error)
   {
     LOG_ERROR("Simulator supplied ProcessD2EDr2Term() routine returned error.");
@@ -1088,6 +1705,265 @@ int ComputeArgumentsImplementation::ProcessD2EDr2Term(double const de,
   }
 }
 
+int ComputeArgumentsImplementation::ProcessDEDrTermBatch(
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j) const
+{
+  // No debug logging for callbacks: too expensive
+
+  Function * functionPointer = computeCallbackFunctionPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch];
+  if (functionPointer == NULL)
+  {
+    for (int t = 0; t < numberOfTerms; ++t)
+    {
+      if (ProcessDEDrTerm(de[t], r[t], &(dx[3 * t]), i[t], j[t]))
+        return true;
+    }
+    return false;
+  }
+
+  LanguageName const languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch];
+
+  ProcessDEDrTermBatchFunction * CppProcess_dEdrBatch
+      = reinterpret_cast<ProcessDEDrTermBatchFunction *>(functionPointer);
+  KIM_ProcessDEDrTermBatchFunction * CProcess_dEdrBatch
+      = reinterpret_cast<KIM_ProcessDEDrTermBatchFunction *>(functionPointer);
+  typedef void ProcessDEDrTermBatchF(void * const dataObject,
+                                     int const numberOfTerms,
+                                     double const * const de,
+                                     double const * const r,
+                                     double const * const dx,
+                                     int const * const i,
+                                     int const * const j,
+                                     int * const ierr);
+  ProcessDEDrTermBatchF * FProcess_dEdrBatch
+      = reinterpret_cast<ProcessDEDrTermBatchF *>(functionPointer);
+
+  int const * simulatorI = i;
+  int const * simulatorJ = j;
+  if (simulatorNumbering_ != modelNumbering_)
+  {
+    processTermBatchStorage_.resize(2 * numberOfTerms);
+    for (int t = 0; t < numberOfTerms; ++t)
+    {
+      processTermBatchStorage_[t] = i[t] - numberingOffset_;
+      processTermBatchStorage_[numberOfTerms + t] = j[t] - numberingOffset_;
+    }
+    simulatorI = processTermBatchStorage_.data();
+    simulatorJ = simulatorI + numberOfTerms;
+  }
+
+  int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
+  if (languageName == LANGUAGE_NAME::cpp)
+  {
+    error = CppProcess_dEdrBatch(const_cast<void *>(dataObject),
+                                 numberOfTerms,
+                                 de,
+                                 r,
+                                 dx,
+                                 simulatorI,
+                                 simulatorJ);
+  }
+  else if (languageName == LANGUAGE_NAME::c)
+  {
+    error = CProcess_dEdrBatch(const_cast<void *>(dataObject),
+                               numberOfTerms,
+                               de,
+                               r,
+                               dx,
+                               simulatorI,
+                               simulatorJ);
+  }
+  else if (languageName == LANGUAGE_NAME::fortran)
+  {
+    FProcess_dEdrBatch(const_cast<void *>(dataObject),
+                       numberOfTerms,
+                       de,
+                       r,
+                       dx,
+                       simulatorI,
+                       simulatorJ,
+                       &error);
+  }
+  else
+  {
+    LOG_ERROR("Unknown LanguageName.  SHOULD NEVER GET HERE.");
+    return true;
+  }
+
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->processTermCalls);
+    statistics_->processTermTime += ModelStatistics::WallTime() - startTime;
+  }
+
+  if (error)
+  {
+    LOG_ERROR("Simulator supplied ProcessDEDrTermBatch() routine returned "
+              "error.");
+    return true;
+  }
+
+  return false;
+}
+
+int ComputeArgumentsImplementation::ProcessD2EDr2TermBatch(
+    int const numberOfTerms,
+    double const * const de,
+    double const * const r,
+    double const * const dx,
+    int const * const i,
+    int const * const j) const
+{
+  // No debug logging for callbacks: too expensive
+
+  Function * functionPointer = computeCallbackFunctionPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch];
+  if (functionPointer == NULL)
+  {
+    for (int t = 0; t < numberOfTerms; ++t)
+    {
+      if (ProcessD2EDr2Term(
+              de[t], &(r[2 * t]), &(dx[6 * t]), &(i[2 * t]), &(j[2 * t])))
+        return true;
+    }
+    return false;
+  }
+
+  LanguageName const languageName
+      = computeCallbackLanguage_[COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch];
+  void const * dataObject = computeCallbackDataObjectPointer_
+      [COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch];
+
+  ProcessD2EDr2TermBatchFunction * CppProcess_d2Edr2Batch
+      = reinterpret_cast<ProcessD2EDr2TermBatchFunction *>(functionPointer);
+  KIM_ProcessD2EDr2TermBatchFunction * CProcess_d2Edr2Batch
+      = reinterpret_cast<KIM_ProcessD2EDr2TermBatchFunction *>(
+          functionPointer);
+  typedef void ProcessD2EDr2TermBatchF(void * const dataObject,
+                                       int const numberOfTerms,
+                                       double const * const de,
+                                       double const * const r,
+                                       double const * const dx,
+                                       int const * const i,
+                                       int const * const j,
+                                       int * const ierr);
+  ProcessD2EDr2TermBatchF * FProcess_d2Edr2Batch
+      = reinterpret_cast<ProcessD2EDr2TermBatchF *>(functionPointer);
+
+  int const * simulatorI = i;
+  int const * simulatorJ = j;
+  if (simulatorNumbering_ != modelNumbering_)
+  {
+    int const numberOfIndices = 2 * numberOfTerms;
+    processTermBatchStorage_.resize(2 * numberOfIndices);
+    for (int t = 0; t < numberOfIndices; ++t)
+    {
+      processTermBatchStorage_[t] = i[t] - numberingOffset_;
+      processTermBatchStorage_[numberOfIndices + t] = j[t] - numberingOffset_;
+    }
+    simulatorI = processTermBatchStorage_.data();
+    simulatorJ = simulatorI + numberOfIndices;
+  }
+
+  int error;
+  double const startTime
+      = (statistics_ == NULL) ? 0.0 : ModelStatistics::WallTime();
+  if (languageName == LANGUAGE_NAME::cpp)
+  {
+    error = CppProcess_d2Edr2Batch(const_cast<void *>(dataObject),
+                                   numberOfTerms,
+                                   de,
+                                   r,
+                                   dx,
+                                   simulatorI,
+                                   simulatorJ);
+  }
+  else if (languageName == LANGUAGE_NAME::c)
+  {
+    error = CProcess_d2Edr2Batch(const_cast<void *>(dataObject),
+                                 numberOfTerms,
+                                 de,
+                                 r,
+                                 dx,
+                                 simulatorI,
+                                 simulatorJ);
+  }
+  else if (languageName == LANGUAGE_NAME::fortran)
+  {
+    FProcess_d2Edr2Batch(const_cast<void *>(dataObject),
+                         numberOfTerms,
+                         de,
+                         r,
+                         dx,
+                         simulatorI,
+                         simulatorJ,
+                         &error);
+  }
+  else
+  {
+    LOG_ERROR("Unknown LanguageName.  SHOULD NEVER GET HERE.");
+    return true;
+  }
+
+  if (statistics_ != NULL)
+  {
+    ++(statistics_->processTermCalls);
+    statistics_->processTermTime += ModelStatistics::WallTime() - startTime;
+  }
+
+  if (error)
+  {
+    LOG_ERROR("Simulator supplied ProcessD2EDr2TermBatch() routine returned "
+              "error.");
+    return true;
+  }
+
+  return false;
+}
+
+void ComputeArgumentsImplementation::SetNeighborNumberingTranslation(
+    int const translateNeighborNumbering)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "SetNeighborNumberingTranslation("
+                                 + SNUM(translateNeighborNumbering) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  translateNeighborNumbering_ = translateNeighborNumbering;
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
+void ComputeArgumentsImplementation::GetNeighborNumberingOffset(
+    int * const neighborNumberingOffset) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetNeighborNumberingOffset("
+                                 + SPTR(neighborNumberingOffset) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  *neighborNumberingOffset
+      = (((simulatorNumbering_ != modelNumbering_)
+          && (!translateNeighborNumbering_))
+             ? numberingOffset_
+             : 0);
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
 void ComputeArgumentsImplementation::SetModelBufferPointer(void * const ptr)
 {
 #if DEBUG_VERBOSITY
@@ -1215,6 +2091,10 @@ std::string const & ComputeArgumentsImplementation::ToString() const
      << "-----------------------\n\n";
   ss << "Model Name : " << modelName_ << "\n";
   ss << "Log ID : " << log_->GetID() << "\n";
+  ss << "Model Numbering : " << modelNumbering_.ToString() << "\n";
+  ss << "Simulator Numbering : " << simulatorNumbering_.ToString() << "\n";
+  ss << "Translate Neighbor Numbering : "
+     << (translateNeighborNumbering_ ? "true" : "false") << "\n";
   ss << "\n";
 
   ss << "Compute Arguments :\n";
@@ -1226,27 +2106,16 @@ std::string const & ComputeArgumentsImplementation::ToString() const
      << std::setw(argW) << "-------------------------" << std::setw(argW)
      << "-------------------------"
      << "\n\n";
-  for (std::map<ComputeArgumentName const,
-                SupportStatus,
-                COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator argName
-       = computeArgumentSupportStatus_.begin();
-       argName != computeArgumentSupportStatus_.end();
-       ++argName)
+  for (int i = 0; i < computeArgumentSupportStatus_.Size(); ++i)
   {
-    ss << "\t" << std::setw(argW) << (argName->first).ToString()
-       << std::setw(argW) << (argName->second).ToString();
+    ComputeArgumentName const argName(i);
+    SupportStatus const supportStatus = computeArgumentSupportStatus_[argName];
+    ss << "\t" << std::setw(argW) << argName.ToString() << std::setw(argW)
+       << supportStatus.ToString();
 
-    if ((argName->second) != SUPPORT_STATUS::notSupported)
+    if (supportStatus != SUPPORT_STATUS::notSupported)
     {
-      std::map<ComputeArgumentName const,
-               void *,
-               COMPUTE_ARGUMENT_NAME::Comparator>::const_iterator ptr
-          = computeArgumentPointer_.find(argName->first);
-      if (ptr != computeArgumentPointer_.end())
-      {
-        ss << std::setw(argW) << SPTR(ptr->second);
-      }
-      else { ss << std::setw(argW) << "Not Set"; }
+      ss << std::setw(argW) << SPTR(computeArgumentPointer_[argName]);
     }
     else { ss << std::setw(argW) << "N/A"; }
     ss << "\n";
@@ -1269,37 +2138,18 @@ std::string const & ComputeArgumentsImplementation::ToString() const
      << "------------" << std::setw(cbWd) << "-------------------------"
      << std::setw(cbWf) << "-------------------------"
      << "\n\n";
-  for (std::map<ComputeCallbackName const,
-                SupportStatus,
-                COMPUTE_CALLBACK_NAME::Comparator>::const_iterator cbName
-       = computeCallbackSupportStatus_.begin();
-       cbName != computeCallbackSupportStatus_.end();
-       ++cbName)
+  for (int i = 0; i < computeCallbackSupportStatus_.Size(); ++i)
   {
-    ss << "\t" << std::setw(cbWn) << (cbName->first).ToString()
-       << std::setw(cbWs) << (cbName->second).ToString();
+    ComputeCallbackName const cbName(i);
+    SupportStatus const supportStatus = computeCallbackSupportStatus_[cbName];
+    ss << "\t" << std::setw(cbWn) << cbName.ToString() << std::setw(cbWs)
+       << supportStatus.ToString();
 
-    if ((cbName->second) != SUPPORT_STATUS::notSupported)
+    if (supportStatus != SUPPORT_STATUS::notSupported)
     {
-      std::map<ComputeCallbackName const,
-               LanguageName,
-               COMPUTE_CALLBACK_NAME::Comparator>::const_iterator ptr
-          = computeCallbackLanguage_.find(cbName->first);
-      if (ptr != computeCallbackLanguage_.end())
-      {
-        ss << std::setw(cbWl) << (ptr->second).ToString();
-        std::map<ComputeCallbackName const,
-                 void *,
-                 COMPUTE_CALLBACK_NAME::Comparator>::const_iterator ptr2
-            = computeCallbackDataObjectPointer_.find(cbName->first);
-        ss << std::setw(cbWd) << SPTR(ptr2->second);
-        std::map<ComputeCallbackName const,
-                 Function *,
-                 COMPUTE_CALLBACK_NAME::Comparator>::const_iterator ptr3
-            = computeCallbackFunctionPointer_.find(cbName->first);
-        ss << std::setw(cbWf) << SFUNC(ptr3->second);
-      }
-      else { ss << std::setw(cbWl) << "Not Set"; }
+      ss << std::setw(cbWl) << computeCallbackLanguage_[cbName].ToString();
+      ss << std::setw(cbWd) << SPTR(computeCallbackDataObjectPointer_[cbName]);
+      ss << std::setw(cbWf) << SFUNC(computeCallbackFunctionPointer_[cbName]);
     }
     else { ss << std::setw(cbWs) << "N/A"; }
     ss << "\n";
@@ -1337,9 +2187,15 @@ ComputeArgumentsImplementation::ComputeArgumentsImplementation(
     modelNumbering_(modelNumbering),
     simulatorNumbering_(simulatorNumbering),
     numberingOffset_(numberingOffset),
+    translateNeighborNumbering_(true),
     inModelComputeRoutine_(false),
     numberOfNeighborLists_(0),
     cutoffs_(NULL),
+    statistics_(NULL),
+    numberOfMissingRequired_(0),
+    nestedMasterListCached_(false),
+    nestedMasterListParticle_(0),
+    nestedMasterList_(NULL),
     modelBuffer_(NULL),
     simulatorBuffer_(NULL)
 {
@@ -1350,16 +2206,8 @@ ComputeArgumentsImplementation::ComputeArgumentsImplementation(
   LOG_DEBUG("Enter  " + callString);
 
   // populate ComputeArguments
-  int numberOfComputeArgumentNames;
-  COMPUTE_ARGUMENT_NAME::GetNumberOfComputeArgumentNames(
-      &numberOfComputeArgumentNames);
-  for (int i = 0; i < numberOfComputeArgumentNames; ++i)
-  {
-    ComputeArgumentName computeArgumentName;
-    COMPUTE_ARGUMENT_NAME::GetComputeArgumentName(i, &computeArgumentName);
-    computeArgumentSupportStatus_[computeArgumentName]
-        = SUPPORT_STATUS::notSupported;
-  }
+  computeArgumentSupportStatus_.Fill(SUPPORT_STATUS::notSupported);
+  computeArgumentPointer_.Fill(NULL);
   // populate requiredByAPI ComputeArguments
   for (std::vector<ComputeArgumentName>::const_iterator
            requiredByAPI_ComputeArgument
@@ -1370,21 +2218,14 @@ ComputeArgumentsImplementation::ComputeArgumentsImplementation(
   {
     computeArgumentSupportStatus_[*requiredByAPI_ComputeArgument]
         = SUPPORT_STATUS::requiredByAPI;
-    computeArgumentPointer_[*requiredByAPI_ComputeArgument] = NULL;
   }
 
   // populate ComputeCallbacks
-  int numberOfComputeCallbackNames;
-  COMPUTE_CALLBACK_NAME::GetNumberOfComputeCallbackNames(
-      &numberOfComputeCallbackNames);
-  for (int i = 0; i < numberOfComputeCallbackNames; ++i)
-  {
-    ComputeCallbackName computeCallbackName;
-    COMPUTE_CALLBACK_NAME::GetComputeCallbackName(i, &computeCallbackName);
-    computeCallbackSupportStatus_[computeCallbackName]
-        = SUPPORT_STATUS::notSupported;
-  }
-  // populate ComputeCallbacks
+  computeCallbackSupportStatus_.Fill(SUPPORT_STATUS::notSupported);
+  computeCallbackLanguage_.Fill(LANGUAGE_NAME::cpp);  // place holder
+  computeCallbackFunctionPointer_.Fill(NULL);
+  computeCallbackDataObjectPointer_.Fill(NULL);
+  // populate requiredByAPI ComputeCallbacks
   for (std::vector<ComputeCallbackName>::const_iterator
            requiredByAPI_ComputeCallback
        = COMPUTE_CALLBACK_NAME::requiredByAPI_ComputeCallbacks.begin();
@@ -1394,12 +2235,13 @@ ComputeArgumentsImplementation::ComputeArgumentsImplementation(
   {
     computeCallbackSupportStatus_[*requiredByAPI_ComputeCallback]
         = SUPPORT_STATUS::requiredByAPI;
-    computeCallbackLanguage_[*requiredByAPI_ComputeCallback]
-        = LANGUAGE_NAME::cpp;  // place holder
-    computeCallbackFunctionPointer_[*requiredByAPI_ComputeCallback] = NULL;
-    computeCallbackDataObjectPointer_[*requiredByAPI_ComputeCallback] = NULL;
   }
 
+  for (int i = 0; i < computeArgumentSupportStatus_.Size(); ++i)
+  { numberOfMissingRequired_ += IsMissing(ComputeArgumentName(i)); }
+  for (int i = 0; i < computeCallbackSupportStatus_.Size(); ++i)
+  { numberOfMissingRequired_ += IsMissing(ComputeCallbackName(i)); }
+
   LOG_DEBUG("Exit   " + callString);
 }
 
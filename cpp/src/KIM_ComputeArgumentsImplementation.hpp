@@ -31,7 +31,6 @@
 #ifndef KIM_COMPUTE_ARGUMENTS_IMPLEMENTATION_HPP_
 #define KIM_COMPUTE_ARGUMENTS_IMPLEMENTATION_HPP_
 
-#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -64,11 +63,19 @@
 #include "KIM_ComputeCallbackName.hpp"
 #endif
 
+#ifndef KIM_NAME_INDEXED_ARRAY_HPP_
+#include "KIM_NameIndexedArray.hpp"
+#endif
+
+#include "KIM_ComputeArgumentName.inc"
+#include "KIM_ComputeCallbackName.inc"
+
 
 namespace KIM
 {
 // Forward declaration
 class Log;
+struct ModelStatistics;
 
 
 class ComputeArgumentsImplementation
@@ -105,6 +112,10 @@ class ComputeArgumentsImplementation
                          double const * const ptr);
   int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
                          double * const ptr);
+  int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float const * const ptr);
+  int SetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float * const ptr);
   int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
                          int const ** const ptr) const;
   int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
@@ -113,6 +124,10 @@ class ComputeArgumentsImplementation
                          double const ** const ptr) const;
   int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
                          double ** const ptr) const;
+  int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float const ** const ptr) const;
+  int GetArgumentPointer(ComputeArgumentName const computeArgumentName,
+                         float ** const ptr) const;
 
 
   int SetCallbackPointer(ComputeCallbackName const computeCallbackName,
@@ -123,12 +138,25 @@ class ComputeArgumentsImplementation
                         int * const present) const;
 
   void AreAllRequiredArgumentsAndCallbacksPresent(int * const result) const;
+  int HasSameInputs(ComputeArgumentsImplementation const & other) const;
 
   int GetNeighborList(int const neighborListIndex,
                       int const particleNumber,
                       int * const numberOfNeighbors,
                       int const ** const neighborsOfParticle) const;
 
+  int GetNeighborListWithDisplacements(
+      int const neighborListIndex,
+      int const particleNumber,
+      int * const numberOfNeighbors,
+      int const ** const neighborsOfParticle,
+      double const ** const displacementsOfNeighbors,
+      double const ** const squaredDistancesOfNeighbors) const;
+
+  int GetNeighborLists(int const particleNumber,
+                       int * const numberOfNeighbors,
+                       int const ** const neighborsOfParticle) const;
+
   int ProcessDEDrTerm(double const de,
                       double const r,
                       double const * const dx,
@@ -141,6 +169,22 @@ class ComputeArgumentsImplementation
                         int const * const i,
                         int const * const j) const;
 
+  int ProcessDEDrTermBatch(int const numberOfTerms,
+                           double const * const de,
+                           double const * const r,
+                           double const * const dx,
+                           int const * const i,
+                           int const * const j) const;
+
+  int ProcessD2EDr2TermBatch(int const numberOfTerms,
+                             double const * const de,
+                             double const * const r,
+                             double const * const dx,
+                             int const * const i,
+                             int const * const j) const;
+
+  void SetNeighborNumberingTranslation(int const translateNeighborNumbering);
+  void GetNeighborNumberingOffset(int * const neighborNumberingOffset) const;
 
   void SetModelBufferPointer(void * const ptr);
   void GetModelBufferPointer(void ** const ptr) const;
@@ -181,6 +225,20 @@ class ComputeArgumentsImplementation
   int Validate(LanguageName const languageName) const;
   int Validate(SupportStatus const supportStatus) const;
 
+  int IsCallbackFunctionPresent(
+      ComputeCallbackName const computeCallbackName) const;
+  int IsMissing(ComputeArgumentName const computeArgumentName) const;
+  int IsMissing(ComputeCallbackName const computeCallbackName) const;
+  int NumberOfMissing(ComputeArgumentName const computeArgumentName) const;
+  int IsNestedNeighborListsCallbackPresent() const;
+  int CallGetNestedNeighborLists(
+      int const particleNumber,
+      int * const numberOfNeighbors,
+      int const ** const simulatorNeighborsOfParticle) const;
+  int GetNestedMasterList(
+      int const particleNumber,
+      int const ** const simulatorNeighborsOfParticle) const;
+
 
   std::string modelName_;
 
@@ -189,35 +247,56 @@ class ComputeArgumentsImplementation
   Numbering const modelNumbering_;
   Numbering const simulatorNumbering_;
   int const numberingOffset_;
+  bool translateNeighborNumbering_;
 
   mutable bool inModelComputeRoutine_;
   mutable int numberOfNeighborLists_;
   mutable double const * cutoffs_;
-
-  std::map<ComputeArgumentName const,
-           SupportStatus,
-           COMPUTE_ARGUMENT_NAME::Comparator>
-      computeArgumentSupportStatus_;
-  std::map<ComputeArgumentName const, void *, COMPUTE_ARGUMENT_NAME::Comparator>
-      computeArgumentPointer_;
-
-
-  std::map<ComputeCallbackName const,
-           SupportStatus,
-           COMPUTE_CALLBACK_NAME::Comparator>
-      computeCallbackSupportStatus_;
-  std::map<ComputeCallbackName const,
-           LanguageName,
-           COMPUTE_CALLBACK_NAME::Comparator>
-      computeCallbackLanguage_;
-  std::map<ComputeCallbackName const,
-           Function *,
-           COMPUTE_CALLBACK_NAME::Comparator>
-      computeCallbackFunctionPointer_;
-  std::map<ComputeCallbackName const, void *, COMPUTE_CALLBACK_NAME::Comparator>
-      computeCallbackDataObjectPointer_;
+  mutable ModelStatistics * statistics_;
+
+  template<class Value>
+  struct ArgumentArray
+  {
+    typedef NameIndexedArray<ComputeArgumentName,
+                             &ComputeArgumentName::computeArgumentNameID,
+                             Value,
+                             NUMBER_OF_COMPUTE_ARGUMENT_NAMES>
+        Type;
+  };
+  template<class Value>
+  struct CallbackArray
+  {
+    typedef NameIndexedArray<ComputeCallbackName,
+                             &ComputeCallbackName::computeCallbackNameID,
+                             Value,
+                             NUMBER_OF_COMPUTE_CALLBACK_NAMES>
+        Type;
+  };
+
+  ArgumentArray<SupportStatus>::Type computeArgumentSupportStatus_;
+  ArgumentArray<void *>::Type computeArgumentPointer_;
+
+
+  CallbackArray<SupportStatus>::Type computeCallbackSupportStatus_;
+  CallbackArray<LanguageName>::Type computeCallbackLanguage_;
+  CallbackArray<Function *>::Type computeCallbackFunctionPointer_;
+  CallbackArray<void *>::Type computeCallbackDataObjectPointer_;
+
+  // number of required arguments and callbacks whose pointer is NULL;
+  // kept current by the Set*() routines so that the readiness check
+  // done by every Compute() does not need to scan the arrays
+  int numberOfMissingRequired_;
 
   mutable std::vector<std::vector<int> > getNeighborListStorage_;
+  mutable std::vector<int> getNestedNeighborListsNumberOfNeighbors_;
+  mutable std::vector<int> getNestedNeighborListsStorage_;
+  // the master list of the last particle served by GetNestedNeighborLists,
+  // reused while the Model asks for the other lists of the same particle;
+  // invalidated at the start of each Compute()
+  mutable bool nestedMasterListCached_;
+  mutable int nestedMasterListParticle_;
+  mutable int const * nestedMasterList_;
+  mutable std::vector<int> processTermBatchStorage_;
 
 
   void * modelBuffer_;
@@ -43,6 +43,11 @@ namespace COMPUTE_CALLBACK_NAME
 ComputeCallbackName const GetNeighborList(ID_GetNeighborList);
 ComputeCallbackName const ProcessDEDrTerm(ID_ProcessDEDrTerm);
 ComputeCallbackName const ProcessD2EDr2Term(ID_ProcessD2EDr2Term);
+ComputeCallbackName const
+    GetNeighborListWithDisplacements(ID_GetNeighborListWithDisplacements);
+ComputeCallbackName const GetNestedNeighborLists(ID_GetNestedNeighborLists);
+ComputeCallbackName const ProcessDEDrTermBatch(ID_ProcessDEDrTermBatch);
+ComputeCallbackName const ProcessD2EDr2TermBatch(ID_ProcessD2EDr2TermBatch);
 
 namespace
 {
@@ -57,6 +62,10 @@ StringMap const GetStringMap()
   m[GetNeighborList] = "GetNeighborList";
   m[ProcessDEDrTerm] = "ProcessDEDrTerm";
   m[ProcessD2EDr2Term] = "ProcessD2EDr2Term";
+  m[GetNeighborListWithDisplacements] = "GetNeighborListWithDisplacements";
+  m[GetNestedNeighborLists] = "GetNestedNeighborLists";
+  m[ProcessDEDrTermBatch] = "ProcessDEDrTermBatch";
+  m[ProcessD2EDr2TermBatch] = "ProcessD2EDr2TermBatch";
   return m;
 }
 
@@ -41,6 +41,7 @@ namespace DATA_TYPE
 #include "KIM_DataType.inc"
 DataType const Integer(ID_Integer);
 DataType const Double(ID_Double);
+DataType const Float(ID_Float);
 
 namespace
 {
@@ -51,6 +52,7 @@ StringMap const GetStringMap()
   StringMap m;
   m[Integer] = "Integer";
   m[Double] = "Double";
+  m[Float] = "Float";
   return m;
 }
 
@@ -0,0 +1,80 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+
+#ifndef KIM_HASH_HPP_
+#define KIM_HASH_HPP_
+
+#include <cstdio>
+#include <string>
+
+namespace KIM
+{
+// The 64-bit FNV-1a hash.  C++98 has no 64-bit integer type, so the state
+// is kept in two 32-bit halves and the multiplication by the FNV prime
+// 0x100000001b3 (= 2^40 + 0x1b3) is carried out on 16-bit pieces.
+class Fnv1aHash
+{
+ public:
+  Fnv1aHash() : high_(0xcbf29ce4u), low_(0x84222325u) {}
+
+  void Add(unsigned char const byte)
+  {
+    low_ ^= byte;
+    unsigned int const lowTimes1b3Carry
+        = ((low_ >> 16) * 0x1b3u + (((low_ & 0xffffu) * 0x1b3u) >> 16)) >> 16;
+    high_ = (high_ * 0x1b3u + lowTimes1b3Carry + (low_ << 8)) & 0xffffffffu;
+    low_ = (low_ * 0x1b3u) & 0xffffffffu;
+  }
+
+  void Add(char const * const bytes, std::size_t const numberOfBytes)
+  {
+    for (std::size_t i = 0; i < numberOfBytes; ++i)
+      Add(static_cast<unsigned char>(bytes[i]));
+  }
+
+  void Add(std::string const & bytes) { Add(bytes.data(), bytes.size()); }
+
+  // sixteen lower-case hexadecimal digits
+  std::string Digest() const
+  {
+    char hexadecimal[32];
+    std::sprintf(hexadecimal, "%08x%08x", high_, low_);
+    return hexadecimal;
+  }
+
+ private:
+  unsigned int high_;
+  unsigned int low_;
+};  // class Fnv1aHash
+}  // namespace KIM
+
+#endif  // KIM_HASH_HPP_
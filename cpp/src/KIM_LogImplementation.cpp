@@ -56,6 +56,10 @@ extern "C" {
 #include "KIM_LanguageName.hpp"
 #endif
 
+#ifndef KIM_THREADS_HPP_
+#include "KIM_Threads.hpp"
+#endif
+
 #include "KIM_LOG_DEFINES.inc"
 
 #define LOG_FILE "kim.log"
@@ -142,11 +146,16 @@ void LogImplementation::PopDefaultVerbosity()
 
 namespace
 {
+// Serializes entries written by objects living on different threads, such
+// as Models created by Model::CreateAsync.
+Mutex logFileMutex;
+
 int GlobalDefaultLogPrintFunction(std::string const & entryString)
 {
   // Need to figure out how to do file locking to make this work for
   // parallel computations.
 
+  MutexLock lock(logFileMutex);
   std::ofstream file;
   file.open(LOG_FILE, std::ios_base::out | std::ios_base::app);
   if (!file)
@@ -29,6 +29,12 @@
 
 
 #include <cstddef>
+#include <sstream>
+#include <vector>
+
+#ifndef KIM_LOG_HPP_
+#include "KIM_Log.hpp"
+#endif
 
 #ifndef KIM_LOG_VERBOSITY_HPP_
 #include "KIM_LogVerbosity.hpp"
@@ -58,6 +64,14 @@
 #include "KIM_ModelImplementation.hpp"
 #endif
 
+#ifndef KIM_PENDING_MODEL_HPP_
+#include "KIM_PendingModel.hpp"
+#endif
+
+#ifndef KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
+#include "KIM_PendingModelImplementation.hpp"
+#endif
+
 namespace KIM
 {
 int Model::Create(Numbering const numbering,
@@ -90,6 +104,67 @@ int Model::Create(Numbering const numbering,
   else { return false; }
 }
 
+int Model::CreateFromLibraryPath(Numbering const numbering,
+                                 LengthUnit const requestedLengthUnit,
+                                 EnergyUnit const requestedEnergyUnit,
+                                 ChargeUnit const requestedChargeUnit,
+                                 TemperatureUnit const requestedTemperatureUnit,
+                                 TimeUnit const requestedTimeUnit,
+                                 std::string const & modelLibraryPath,
+                                 std::string const & driverLibraryPath,
+                                 int * const requestedUnitsAccepted,
+                                 Model ** const model)
+{
+  *model = new Model();
+
+  int error = ModelImplementation::CreateFromLibraryPath(
+      numbering,
+      requestedLengthUnit,
+      requestedEnergyUnit,
+      requestedChargeUnit,
+      requestedTemperatureUnit,
+      requestedTimeUnit,
+      modelLibraryPath,
+      driverLibraryPath,
+      requestedUnitsAccepted,
+      &((*model)->pimpl));
+  if (error)
+  {
+    delete *model;
+    *model = NULL;
+    return true;
+  }
+  else { return false; }
+}
+
+int Model::CreateAsync(Numbering const numbering,
+                       LengthUnit const requestedLengthUnit,
+                       EnergyUnit const requestedEnergyUnit,
+                       ChargeUnit const requestedChargeUnit,
+                       TemperatureUnit const requestedTemperatureUnit,
+                       TimeUnit const requestedTimeUnit,
+                       std::string const & modelName,
+                       PendingModel ** const pendingModel)
+{
+  *pendingModel = new PendingModel();
+
+  int error = PendingModelImplementation::Create(numbering,
+                                                 requestedLengthUnit,
+                                                 requestedEnergyUnit,
+                                                 requestedChargeUnit,
+                                                 requestedTemperatureUnit,
+                                                 requestedTimeUnit,
+                                                 modelName,
+                                                 &((*pendingModel)->pimpl));
+  if (error)
+  {
+    delete *pendingModel;
+    *pendingModel = NULL;
+    return true;
+  }
+  else { return false; }
+}
+
 void Model::Destroy(Model ** const model)
 {
   if (*model != NULL) { ModelImplementation::Destroy(&((*model)->pimpl)); }
@@ -121,6 +196,13 @@ void Model::GetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+void Model::GetSpeciesPairCutoffsPointer(
+    int * const numberOfSpeciesCodes,
+    double const ** const speciesPairCutoffs) const
+{
+  pimpl->GetSpeciesPairCutoffsPointer(numberOfSpeciesCodes, speciesPairCutoffs);
+}
+
 void Model::GetUnits(LengthUnit * const lengthUnit,
                      EnergyUnit * const energyUnit,
                      ChargeUnit * const chargeUnit,
@@ -148,6 +230,33 @@ int Model::Compute(ComputeArguments const * const computeArguments) const
   return pimpl->Compute(computeArguments);
 }
 
+int Model::ComputeEnsemble(
+    int const numberOfMembers,
+    Model * const * const models,
+    ComputeArguments const * const * const computeArguments)
+{
+  if (numberOfMembers < 1)
+  {
+    // there is no member whose Log could be used
+    Log * log;
+    if (!Log::Create(&log))
+    {
+      std::stringstream ss;
+      ss << "Model::ComputeEnsemble() called with " << numberOfMembers
+         << " members.";
+      log->LogEntry(LOG_VERBOSITY::error, ss, __LINE__, __FILE__);
+      Log::Destroy(&log);
+    }
+    return true;
+  }
+
+  std::vector<ModelImplementation *> members(numberOfMembers);
+  for (int i = 0; i < numberOfMembers; ++i) members[i] = models[i]->pimpl;
+
+  return models[0]->pimpl->ComputeEnsemble(
+      numberOfMembers, &(members[0]), computeArguments);
+}
+
 int Model::Extension(std::string const & extensionID,
                      void * const extensionStructure)
 {
@@ -162,6 +271,30 @@ int Model::WriteParameterizedModel(std::string const & path,
   return pimpl->WriteParameterizedModel(path, modelName);
 }
 
+void Model::SetStatisticsEnabled(int const enabled)
+{
+  pimpl->SetStatisticsEnabled(enabled);
+}
+
+void Model::GetStatistics(long * const computeCalls,
+                          double * const computeTime,
+                          long * const neighborListCalls,
+                          double * const neighborListTime,
+                          long * const neighborsServed,
+                          long * const processTermCalls,
+                          double * const processTermTime) const
+{
+  pimpl->GetStatistics(computeCalls,
+                       computeTime,
+                       neighborListCalls,
+                       neighborListTime,
+                       neighborsServed,
+                       processTermCalls,
+                       processTermTime);
+}
+
+void Model::ResetStatistics() { pimpl->ResetStatistics(); }
+
 int Model::GetSpeciesSupportAndCode(SpeciesName const speciesName,
                                     int * const speciesIsSupported,
                                     int * const code) const
@@ -213,6 +346,59 @@ int Model::SetParameter(int const parameterIndex,
   return pimpl->SetParameter(parameterIndex, arrayIndex, parameterValue);
 }
 
+int Model::GetParameterArray(int const parameterIndex,
+                             int const offset,
+                             int const count,
+                             int * const parameterValues) const
+{
+  return pimpl->GetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int Model::GetParameterArray(int const parameterIndex,
+                             int const offset,
+                             int const count,
+                             double * const parameterValues) const
+{
+  return pimpl->GetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int Model::SetParameterArray(int const parameterIndex,
+                             int const offset,
+                             int const count,
+                             int const * const parameterValues)
+{
+  return pimpl->SetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+int Model::SetParameterArray(int const parameterIndex,
+                             int const offset,
+                             int const count,
+                             double const * const parameterValues)
+{
+  return pimpl->SetParameterArray(
+      parameterIndex, offset, count, parameterValues);
+}
+
+void Model::GetParameterVectorSize(int * const parameterVectorSize) const
+{
+  pimpl->GetParameterVectorSize(parameterVectorSize);
+}
+
+int Model::GetParameterVector(int const parameterVectorSize,
+                              double * const parameterValues) const
+{
+  return pimpl->GetParameterVector(parameterVectorSize, parameterValues);
+}
+
+int Model::SetParameterVector(int const parameterVectorSize,
+                              double const * const parameterValues)
+{
+  return pimpl->SetParameterVector(parameterVectorSize, parameterValues);
+}
+
 void Model::SetSimulatorBufferPointer(void * const ptr)
 {
   pimpl->SetSimulatorBufferPointer(ptr);
@@ -70,6 +70,43 @@ int ModelComputeArguments::GetNeighborList(
                                 neighborsOfParticle);
 }
 
+int ModelComputeArguments::GetNeighborListWithDisplacements(
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetNeighborListWithDisplacements(neighborListIndex,
+                                                 particleNumber,
+                                                 numberOfNeighbors,
+                                                 neighborsOfParticle,
+                                                 displacementsOfNeighbors,
+                                                 squaredDistancesOfNeighbors);
+}
+
+int ModelComputeArguments::GetNeighborLists(
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetNeighborLists(
+      particleNumber, numberOfNeighbors, neighborsOfParticle);
+}
+
+void ModelComputeArguments::GetNeighborNumberingOffset(
+    int * const neighborNumberingOffset) const
+{
+  CONVERT_POINTER;
+
+  pImpl->GetNeighborNumberingOffset(neighborNumberingOffset);
+}
+
 int ModelComputeArguments::ProcessDEDrTerm(double const de,
                                            double const r,
                                            double const * const dx,
@@ -92,6 +129,30 @@ int ModelComputeArguments::ProcessD2EDr2Term(double const de,
   return pImpl->ProcessD2EDr2Term(de, r, dx, i, j);
 }
 
+int ModelComputeArguments::ProcessDEDrTermBatch(int const numberOfTerms,
+                                                double const * const de,
+                                                double const * const r,
+                                                double const * const dx,
+                                                int const * const i,
+                                                int const * const j) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->ProcessDEDrTermBatch(numberOfTerms, de, r, dx, i, j);
+}
+
+int ModelComputeArguments::ProcessD2EDr2TermBatch(int const numberOfTerms,
+                                                  double const * const de,
+                                                  double const * const r,
+                                                  double const * const dx,
+                                                  int const * const i,
+                                                  int const * const j) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->ProcessD2EDr2TermBatch(numberOfTerms, de, r, dx, i, j);
+}
+
 int ModelComputeArguments::GetArgumentPointer(
     ComputeArgumentName const computeArgumentName, int const ** const ptr) const
 {
@@ -125,6 +186,23 @@ int ModelComputeArguments::GetArgumentPointer(
   return pImpl->GetArgumentPointer(computeArgumentName, ptr);
 }
 
+int ModelComputeArguments::GetArgumentPointer(
+    ComputeArgumentName const computeArgumentName, float ** const ptr) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetArgumentPointer(computeArgumentName, ptr);
+}
+
+int ModelComputeArguments::GetArgumentPointer(
+    ComputeArgumentName const computeArgumentName,
+    float const ** const ptr) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetArgumentPointer(computeArgumentName, ptr);
+}
+
 int ModelComputeArguments::IsCallbackPresent(
     ComputeCallbackName const computeCallbackName, int * const present) const
 {
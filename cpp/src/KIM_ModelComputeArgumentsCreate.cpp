@@ -79,6 +79,14 @@ int ModelComputeArgumentsCreate::SetCallbackSupportStatus(
   return pImpl->SetCallbackSupportStatus(computeCallbackName, supportStatus);
 }
 
+void ModelComputeArgumentsCreate::SetNeighborNumberingTranslation(
+    int const translateNeighborNumbering)
+{
+  CONVERT_POINTER;
+
+  pImpl->SetNeighborNumberingTranslation(translateNeighborNumbering);
+}
+
 void ModelComputeArgumentsCreate::SetModelBufferPointer(void * const ptr)
 {
   CONVERT_POINTER;
@@ -96,6 +96,15 @@ void ModelCreate::SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int ModelCreate::SetSpeciesPairCutoffsPointer(
+    int const numberOfSpeciesCodes, double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pImpl->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                             speciesPairCutoffs);
+}
+
 int ModelCreate::SetRoutinePointer(ModelRoutineName const modelRoutineName,
                                    LanguageName const languageName,
                                    int const required,
@@ -128,6 +128,15 @@ void ModelDriverCreate::SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int ModelDriverCreate::SetSpeciesPairCutoffsPointer(
+    int const numberOfSpeciesCodes, double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pImpl->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                             speciesPairCutoffs);
+}
+
 int ModelDriverCreate::SetRoutinePointer(
     ModelRoutineName const modelRoutineName,
     LanguageName const languageName,
@@ -175,6 +184,24 @@ void ModelDriverCreate::SetModelBufferPointer(void * const ptr)
   pImpl->SetModelBufferPointer(ptr);
 }
 
+int ModelDriverCreate::DeclareSharedBuffer(std::string const & bufferName,
+                                           long const numberOfBytes,
+                                           void ** const buffer,
+                                           int * const mustInitialize)
+{
+  CONVERT_POINTER;
+
+  return pImpl->DeclareSharedBuffer(
+      bufferName, numberOfBytes, buffer, mustInitialize);
+}
+
+int ModelDriverCreate::SetSharedBufferInitialized(void * const buffer)
+{
+  CONVERT_POINTER;
+
+  return pImpl->SetSharedBufferInitialized(buffer);
+}
+
 
 int ModelDriverCreate::SetUnits(LengthUnit const lengthUnit,
                                 EnergyUnit const energyUnit,
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -62,6 +63,26 @@
 #include "KIM_ComputeArgumentsImplementation.hpp"
 #endif
 
+#ifndef KIM_TRACE_HPP_
+#include "KIM_Trace.hpp"
+#endif
+
+#ifndef KIM_SHARED_BUFFER_HPP_
+#include "KIM_SharedBuffer.hpp"
+#endif
+
+#ifndef KIM_HASH_HPP_
+#include "KIM_Hash.hpp"
+#endif
+
+#ifndef KIM_SUPPORTED_EXTENSIONS_HPP_
+#include "KIM_SupportedExtensions.hpp"
+#endif
+
+#ifndef KIM_COMPUTE_ENSEMBLE_HPP_
+#include "KIM_ComputeEnsemble.hpp"
+#endif
+
 #ifndef KIM_UNIT_SYSTEM_H_
 extern "C" {
 #include "KIM_UnitSystem.h"
@@ -207,6 +228,29 @@ KIM_TimeUnit makeTimeUnitC(KIM::TimeUnit const timeUnit)
   KIM_TimeUnit timeUnitC = {timeUnit.timeUnitID};
   return timeUnitC;
 }
+
+// 64-bit FNV-1a hash of the contents of the files, as 16 hexadecimal digits
+int FilesDigest(std::vector<std::string> const & fileNames,
+                std::string * const digest)
+{
+  KIM::Fnv1aHash hash;
+  for (std::size_t i = 0; i < fileNames.size(); ++i)
+  {
+    std::ifstream file(fileNames[i].c_str(), std::ifstream::binary);
+    if (!file) return true;
+
+    char buffer[4096];
+    while (file.read(buffer, sizeof(buffer)) || (file.gcount() > 0))
+      hash.Add(buffer, static_cast<std::size_t>(file.gcount()));
+    if (!file.eof()) return true;
+    // mark the end of each file so that contents cannot move between files
+    // without changing the digest
+    hash.Add(static_cast<unsigned char>(0xff));
+  }
+
+  *digest = hash.Digest();
+  return false;
+}
 }  // namespace
 
 // log helpers
@@ -251,6 +295,61 @@ int ModelImplementation::Create(
     int * const requestedUnitsAccepted,
     ModelImplementation ** const modelImplementation)
 {
+  return CreateModel(numbering,
+                     requestedLengthUnit,
+                     requestedEnergyUnit,
+                     requestedChargeUnit,
+                     requestedTemperatureUnit,
+                     requestedTimeUnit,
+                     modelName,
+                     "",
+                     "",
+                     requestedUnitsAccepted,
+                     modelImplementation);
+}
+
+int ModelImplementation::CreateFromLibraryPath(
+    Numbering const numbering,
+    LengthUnit const requestedLengthUnit,
+    EnergyUnit const requestedEnergyUnit,
+    ChargeUnit const requestedChargeUnit,
+    TemperatureUnit const requestedTemperatureUnit,
+    TimeUnit const requestedTimeUnit,
+    std::string const & modelLibraryPath,
+    std::string const & driverLibraryPath,
+    int * const requestedUnitsAccepted,
+    ModelImplementation ** const modelImplementation)
+{
+  return CreateModel(numbering,
+                     requestedLengthUnit,
+                     requestedEnergyUnit,
+                     requestedChargeUnit,
+                     requestedTemperatureUnit,
+                     requestedTimeUnit,
+                     "",
+                     modelLibraryPath,
+                     driverLibraryPath,
+                     requestedUnitsAccepted,
+                     modelImplementation);
+}
+
+int ModelImplementation::CreateModel(
+    Numbering const numbering,
+    LengthUnit const requestedLengthUnit,
+    EnergyUnit const requestedEnergyUnit,
+    ChargeUnit const requestedChargeUnit,
+    TemperatureUnit const requestedTemperatureUnit,
+    TimeUnit const requestedTimeUnit,
+    std::string const & modelName,
+    std::string const & modelLibraryPath,
+    std::string const & driverLibraryPath,
+    int * const requestedUnitsAccepted,
+    ModelImplementation ** const modelImplementation)
+{
+  TraceSpan const span(
+      "Model::Create",
+      (modelName != "") ? modelName.c_str() : modelLibraryPath.c_str());
+
   // error checking of arguments performed as part of ModelCreate()
 
   Log * pLog;
@@ -265,11 +364,12 @@ int ModelImplementation::Create(
   pModelImplementation = new ModelImplementation(new SharedLibrary(pLog), pLog);
 #if DEBUG_VERBOSITY
   std::string const callString
-      = "Create(" + numbering.ToString() + ", " + requestedLengthUnit.ToString()
-        + ", " + requestedEnergyUnit.ToString() + ", "
-        + requestedChargeUnit.ToString() + ", "
+      = "CreateModel(" + numbering.ToString() + ", "
+        + requestedLengthUnit.ToString() + ", " + requestedEnergyUnit.ToString()
+        + ", " + requestedChargeUnit.ToString() + ", "
         + requestedTemperatureUnit.ToString() + ", "
-        + requestedTimeUnit.ToString() + ", '" + modelName + "', "
+        + requestedTimeUnit.ToString() + ", '" + modelName + "', '"
+        + modelLibraryPath + "', '" + driverLibraryPath + "', "
         + SPTR(requestedUnitsAccepted) + ", " + SPTR(modelImplementation)
         + ").";
   pModelImplementation->LogEntry(
@@ -285,7 +385,9 @@ int ModelImplementation::Create(
                                             requestedChargeUnit,
                                             requestedTemperatureUnit,
                                             requestedTimeUnit,
-                                            modelName);
+                                            modelName,
+                                            modelLibraryPath,
+                                            driverLibraryPath);
   if (error)
   {
 #if DEBUG_VERBOSITY
@@ -348,6 +450,7 @@ void ModelImplementation::Destroy(
 {
   if (*modelImplementation != NULL)
   {
+    TraceSpan const span("Model::Destroy");
 #if DEBUG_VERBOSITY
     std::string callString = "Destroy(" + SPTR(modelImplementation) + ").";
     (*modelImplementation)
@@ -392,10 +495,8 @@ int ModelImplementation::IsRoutinePresent(
   }
 #endif
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator result
-      = routineFunction_.find(modelRoutineName);
-  if (result->second == NULL)
+  Function * const result = routineFunction_[modelRoutineName];
+  if (result == NULL)
   {
     if (present != NULL) *present = false;
     if (required != NULL) *required = false;
@@ -405,10 +506,7 @@ int ModelImplementation::IsRoutinePresent(
     if (present != NULL) *present = true;
     if (required != NULL)
     {
-      std::map<ModelRoutineName const, int, MODEL_ROUTINE_NAME::Comparator>::
-          const_iterator requiredResult
-          = routineRequired_.find(modelRoutineName);
-      *required = requiredResult->second;
+      *required = routineRequired_[modelRoutineName];
     }
   }
 
@@ -424,6 +522,7 @@ int ModelImplementation::ComputeArgumentsCreate(
       = "ComputeArgumentsCreate(" + SPTR(computeArguments) + ").";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Model::ComputeArgumentsCreate", modelName_.c_str());
 
   *computeArguments = new ComputeArguments();
 
@@ -585,6 +684,69 @@ void ModelImplementation::GetNeighborListPointers(
   LOG_DEBUG("Exit   " + callString);
 }
 
+int ModelImplementation::SetSpeciesPairCutoffsPointer(
+    int const numberOfSpeciesCodes, double const * const speciesPairCutoffs)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "SetSpeciesPairCutoffsPointer("
+                                 + SNUM(numberOfSpeciesCodes) + ", "
+                                 + SPTR(speciesPairCutoffs) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if ((numberOfNeighborLists_ < 1) || (cutoffs_ == NULL))
+  {
+    LOG_ERROR("SetNeighborListPointers() must be called before "
+              "SetSpeciesPairCutoffsPointer().");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  if (numberOfSpeciesCodes < 1)
+  {
+    LOG_ERROR("Number of species codes, " + SNUM(numberOfSpeciesCodes)
+              + ", must be >= 1.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  if (speciesPairCutoffs == NULL)
+  {
+    LOG_ERROR("Null pointer provided for speciesPairCutoffs.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  if (CheckSpeciesPairCutoffValues(numberOfSpeciesCodes, speciesPairCutoffs))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  numberOfSpeciesCodes_ = numberOfSpeciesCodes;
+  speciesPairCutoffs_ = speciesPairCutoffs;
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+void ModelImplementation::GetSpeciesPairCutoffsPointer(
+    int * const numberOfSpeciesCodes,
+    double const ** const speciesPairCutoffs) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetSpeciesPairCutoffsPointer("
+                                 + SPTR(numberOfSpeciesCodes) + ", "
+                                 + SPTR(speciesPairCutoffs) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  if (numberOfSpeciesCodes != NULL)
+    *numberOfSpeciesCodes = numberOfSpeciesCodes_;
+  if (speciesPairCutoffs != NULL) *speciesPairCutoffs = speciesPairCutoffs_;
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
 int ModelImplementation::SetRoutinePointer(
     ModelRoutineName const modelRoutineName,
     LanguageName const languageName,
@@ -993,6 +1155,8 @@ int ModelImplementation::SetParameterPointer(int const extent,
   parameterDataType_.push_back(DATA_TYPE::Integer);
   parameterExtent_.push_back(extent);
   parameterPointer_.push_back(ptr);
+  parameterChangedElements_.push_back(std::vector<int>());
+  parameterAllElementsChanged_.push_back(false);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -1047,6 +1211,8 @@ int ModelImplementation::SetParameterPointer(int const extent,
   parameterDataType_.push_back(DATA_TYPE::Double);
   parameterExtent_.push_back(extent);
   parameterPointer_.push_back(ptr);
+  parameterChangedElements_.push_back(std::vector<int>());
+  parameterAllElementsChanged_.push_back(false);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -1226,6 +1392,7 @@ int ModelImplementation::SetParameter(int const parameterIndex,
 
   reinterpret_cast<int *>(parameterPointer_[parameterIndex])[arrayIndex]
       = parameterValue;
+  MarkParameterElementsChanged(parameterIndex, arrayIndex, 1);
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -1269,19 +1436,516 @@ int ModelImplementation::SetParameter(int const parameterIndex,
 
   reinterpret_cast<double *>(parameterPointer_[parameterIndex])[arrayIndex]
       = parameterValue;
+  MarkParameterElementsChanged(parameterIndex, arrayIndex, 1);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::GetParameterArray(int const parameterIndex,
+                                           int const offset,
+                                           int const count,
+                                           int * const parameterValues) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "GetParameterArray(" + SNUM(parameterIndex) + ", " + SNUM(offset)
+        + ", " + SNUM(count) + ", " + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (CheckParameterArrayRange(
+          parameterIndex, DATA_TYPE::Integer, offset, count))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  std::memcpy(parameterValues,
+              reinterpret_cast<int const *>(parameterPointer_[parameterIndex])
+                  + offset,
+              count * sizeof(int));
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::GetParameterArray(
+    int const parameterIndex,
+    int const offset,
+    int const count,
+    double * const parameterValues) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "GetParameterArray(" + SNUM(parameterIndex) + ", " + SNUM(offset)
+        + ", " + SNUM(count) + ", " + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (CheckParameterArrayRange(
+          parameterIndex, DATA_TYPE::Double, offset, count))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  std::memcpy(
+      parameterValues,
+      reinterpret_cast<double const *>(parameterPointer_[parameterIndex])
+          + offset,
+      count * sizeof(double));
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::SetParameterArray(int const parameterIndex,
+                                           int const offset,
+                                           int const count,
+                                           int const * const parameterValues)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "SetParameterArray(" + SNUM(parameterIndex) + ", " + SNUM(offset)
+        + ", " + SNUM(count) + ", " + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (CheckParameterArrayRange(
+          parameterIndex, DATA_TYPE::Integer, offset, count))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  std::memcpy(reinterpret_cast<int *>(parameterPointer_[parameterIndex])
+                  + offset,
+              parameterValues,
+              count * sizeof(int));
+  MarkParameterElementsChanged(parameterIndex, offset, count);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::SetParameterArray(
+    int const parameterIndex,
+    int const offset,
+    int const count,
+    double const * const parameterValues)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "SetParameterArray(" + SNUM(parameterIndex) + ", " + SNUM(offset)
+        + ", " + SNUM(count) + ", " + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (CheckParameterArrayRange(
+          parameterIndex, DATA_TYPE::Double, offset, count))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  std::memcpy(reinterpret_cast<double *>(parameterPointer_[parameterIndex])
+                  + offset,
+              parameterValues,
+              count * sizeof(double));
+  MarkParameterElementsChanged(parameterIndex, offset, count);
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+void ModelImplementation::GetParameterVectorSize(
+    int * const parameterVectorSize) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "GetParameterVectorSize(" + SPTR(parameterVectorSize) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  *parameterVectorSize = ParameterVectorSize();
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
+int ModelImplementation::GetParameterVector(
+    int const parameterVectorSize, double * const parameterValues) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetParameterVector("
+                                 + SNUM(parameterVectorSize) + ", "
+                                 + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (parameterVectorSize != ParameterVectorSize())
+  {
+    LOG_ERROR("Invalid parameterVectorSize, " + SNUM(parameterVectorSize)
+              + "; the parameter vector has " + SNUM(ParameterVectorSize())
+              + " values.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  double * values = parameterValues;
+  for (unsigned int i = 0; i < parameterPointer_.size(); ++i)
+  {
+    if (parameterDataType_[i] != DATA_TYPE::Double) continue;
+
+    std::memcpy(values,
+                parameterPointer_[i],
+                parameterExtent_[i] * sizeof(double));
+    values += parameterExtent_[i];
+  }
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::SetParameterVector(
+    int const parameterVectorSize, double const * const parameterValues)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "SetParameterVector("
+                                 + SNUM(parameterVectorSize) + ", "
+                                 + SPTR(parameterValues) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (parameterVectorSize != ParameterVectorSize())
+  {
+    LOG_ERROR("Invalid parameterVectorSize, " + SNUM(parameterVectorSize)
+              + "; the parameter vector has " + SNUM(ParameterVectorSize())
+              + " values.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  double const * values = parameterValues;
+  for (unsigned int i = 0; i < parameterPointer_.size(); ++i)
+  {
+    if (parameterDataType_[i] != DATA_TYPE::Double) continue;
+
+    std::memcpy(parameterPointer_[i],
+                values,
+                parameterExtent_[i] * sizeof(double));
+    MarkParameterElementsChanged(i, 0, parameterExtent_[i]);
+    values += parameterExtent_[i];
+  }
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
 }
 
-int ModelImplementation::Compute(
+// only the parameters of data type Double are part of the parameter vector
+int ModelImplementation::ParameterVectorSize() const
+{
+  int size = 0;
+  for (unsigned int i = 0; i < parameterPointer_.size(); ++i)
+  {
+    if (parameterDataType_[i] == DATA_TYPE::Double) size += parameterExtent_[i];
+  }
+  return size;
+}
+
+int ModelImplementation::CheckParameterArrayRange(int const parameterIndex,
+                                                  DataType const dataType,
+                                                  int const offset,
+                                                  int const count) const
+{
+  if ((parameterIndex < 0)
+      || (static_cast<unsigned int>(parameterIndex)
+          >= parameterPointer_.size()))
+  {
+    LOG_ERROR("Invalid parameter index, " + SNUM(parameterIndex) + ".");
+    return true;
+  }
+
+  if (parameterDataType_[parameterIndex] != dataType)
+  {
+    LOG_ERROR("Data type of parameter is not " + dataType.ToString() + ".");
+    return true;
+  }
+
+  if ((offset < 0) || (count < 0)
+      || (count > parameterExtent_[parameterIndex] - offset))
+  {
+    LOG_ERROR("Invalid parameter array range, offset " + SNUM(offset)
+              + " and count " + SNUM(count) + ".");
+    return true;
+  }
+
+  return false;
+}
+
+int ModelImplementation::GetNumberOfChangedParameterElements(
+    int const parameterIndex, int * const numberOfChangedElements) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetNumberOfChangedParameterElements("
+                                 + SNUM(parameterIndex) + ", "
+                                 + SPTR(numberOfChangedElements) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if ((parameterIndex < 0)
+      || (static_cast<unsigned int>(parameterIndex)
+          >= parameterPointer_.size()))
+  {
+    LOG_ERROR("Invalid parameter index, " + SNUM(parameterIndex) + ".");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  if (parameterAllElementsChanged_[parameterIndex])
+    *numberOfChangedElements = parameterExtent_[parameterIndex];
+  else
+    *numberOfChangedElements
+        = static_cast<int>(parameterChangedElements_[parameterIndex].size());
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::GetChangedParameterElement(
+    int const parameterIndex, int const index, int * const arrayIndex) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "GetChangedParameterElement(" + SNUM(parameterIndex) + ", "
+        + SNUM(index) + ", " + SPTR(arrayIndex) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if ((parameterIndex < 0)
+      || (static_cast<unsigned int>(parameterIndex)
+          >= parameterPointer_.size()))
+  {
+    LOG_ERROR("Invalid parameter index, " + SNUM(parameterIndex) + ".");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  bool const allChanged = parameterAllElementsChanged_[parameterIndex];
+  std::vector<int> const & changed = parameterChangedElements_[parameterIndex];
+
+#if ERROR_VERBOSITY
+  int const numberOfChangedElements
+      = allChanged ? parameterExtent_[parameterIndex]
+                   : static_cast<int>(changed.size());
+  if ((index < 0) || (index >= numberOfChangedElements))
+  {
+    LOG_ERROR("Invalid changed element index, " + SNUM(index) + ".");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  *arrayIndex = allChanged ? index : changed[index];
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+void ModelImplementation::MarkParameterElementsChanged(int const parameterIndex,
+                                                       int const offset,
+                                                       int const count)
+{
+  if (parameterAllElementsChanged_[parameterIndex]) return;
+
+  std::vector<int> & changed = parameterChangedElements_[parameterIndex];
+  int const extent = parameterExtent_[parameterIndex];
+  if (count == extent)
+  {  // bulk sets of the whole array do not need the list
+    parameterAllElementsChanged_[parameterIndex] = true;
+    std::vector<int>().swap(changed);
+    return;
+  }
+
+  for (int i = offset; i < offset + count; ++i) changed.push_back(i);
+
+  // keep repeated changes of the same elements from growing the list
+  if (changed.size() > 2 * static_cast<unsigned int>(extent))
+  {
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    if (changed.size() == static_cast<unsigned int>(extent))
+    {
+      parameterAllElementsChanged_[parameterIndex] = true;
+      std::vector<int>().swap(changed);
+    }
+  }
+}
+
+void ModelImplementation::SortChangedParameterElements()
+{
+  for (std::vector<std::vector<int> >::iterator changed
+       = parameterChangedElements_.begin();
+       changed != parameterChangedElements_.end();
+       ++changed)
+  {
+    std::sort(changed->begin(), changed->end());
+    changed->erase(std::unique(changed->begin(), changed->end()),
+                   changed->end());
+  }
+}
+
+int ModelImplementation::Compute(
+    ComputeArguments const * const computeArguments) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "Compute(" + SPTR(computeArguments) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Model::Compute", modelName_.c_str());
+
+  if (PrepareCompute(computeArguments))
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  double const startTime
+      = statisticsEnabled_ ? ModelStatistics::WallTime() : 0.0;
+
+  // Call the Model supplied compute routine
+  int error = ModelCompute(computeArguments);
+
+  FinishCompute(computeArguments);
+
+  if (statisticsEnabled_)
+  {
+    ++(statistics_.computeCalls);
+    statistics_.computeTime += ModelStatistics::WallTime() - startTime;
+  }
+
+  if (error)
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  else
+  {
+    LOG_DEBUG("Exit 0=" + callString);
+    return false;
+  }
+}
+
+int ModelImplementation::ComputeEnsemble(
+    int const numberOfMembers,
+    ModelImplementation * const * const members,
+    ComputeArguments const * const * const computeArguments)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "ComputeEnsemble(" + SNUM(numberOfMembers)
+                                 + ", " + SPTR(members) + ", "
+                                 + SPTR(computeArguments) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Model::ComputeEnsemble", modelName_.c_str());
+
+  if (!CanComputeEnsemble(numberOfMembers, members, computeArguments))
+  {
+    // fall back to one Compute() per member
+    for (int i = 0; i < numberOfMembers; ++i)
+    {
+      if (members[i]->Compute(computeArguments[i]))
+      {
+        LOG_ERROR("Compute() failed for ensemble member " + SNUM(i) + ".");
+        LOG_DEBUG("Exit 1=" + callString);
+        return true;
+      }
+    }
+
+    LOG_DEBUG("Exit 0=" + callString);
+    return false;
+  }
+
+  for (int i = 0; i < numberOfMembers; ++i)
+  {
+    if (members[i]->PrepareCompute(computeArguments[i]))
+    {
+      LOG_ERROR("Ensemble member " + SNUM(i) + " is not ready to compute.");
+      for (int j = 0; j < i; ++j)
+        members[j]->FinishCompute(computeArguments[j]);
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+  }
+
+  double const startTime = ModelStatistics::WallTime();
+
+  // each element has the layout of the Mdl struct used by ModelCompute()
+  std::vector<void const *> M(numberOfMembers);
+  std::vector<KIM::ModelCompute const *> modelCompute(numberOfMembers);
+  std::vector<KIM::ModelComputeArguments const *> modelComputeArguments(
+      numberOfMembers);
+  for (int i = 0; i < numberOfMembers; ++i)
+  {
+    M[i] = members[i];
+    modelCompute[i] = reinterpret_cast<KIM::ModelCompute const *>(&M[i]);
+    modelComputeArguments[i]
+        = reinterpret_cast<KIM::ModelComputeArguments const *>(
+            computeArguments[i]);
+  }
+
+  KIM::ComputeEnsemble ensemble;
+  ensemble.numberOfMembers = numberOfMembers;
+  ensemble.modelCompute = &(modelCompute[0]);
+  ensemble.modelComputeArguments = &(modelComputeArguments[0]);
+
+  // Call the Model supplied extension routine for all members at once
+  int error = ModelExtension(KIM_COMPUTE_ENSEMBLE_ID, &ensemble);
+
+  // the members share the elapsed time equally
+  double const memberTime
+      = (ModelStatistics::WallTime() - startTime) / numberOfMembers;
+  for (int i = 0; i < numberOfMembers; ++i)
+  {
+    members[i]->FinishCompute(computeArguments[i]);
+    if (members[i]->statisticsEnabled_)
+    {
+      ++(members[i]->statistics_.computeCalls);
+      members[i]->statistics_.computeTime += memberTime;
+    }
+  }
+
+  if (error)
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  else
+  {
+    LOG_DEBUG("Exit 0=" + callString);
+    return false;
+  }
+}
+
+int ModelImplementation::PrepareCompute(
     ComputeArguments const * const computeArguments) const
 {
-#if DEBUG_VERBOSITY
-  std::string const callString = "Compute(" + SPTR(computeArguments) + ").";
-#endif
-  LOG_DEBUG("Enter  " + callString);
-
   // Check that computeArguments is for this model
   if (modelName_ != computeArguments->pimpl->modelName_)
   {
@@ -1290,8 +1954,6 @@ int ModelImplementation::Compute(
               + "' cannot be used with the "
                 "ModelCompute() routine of Model '"
               + modelName_ + "'.");
-
-    LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 
@@ -1303,8 +1965,6 @@ int ModelImplementation::Compute(
   {
     LOG_ERROR("Not all required ComputeArguments and ComputeCallbacks "
               "are present in ComputeArguments object.");
-
-    LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
 #endif
@@ -1313,6 +1973,11 @@ int ModelImplementation::Compute(
   computeArguments->pimpl->inModelComputeRoutine_ = true;
   computeArguments->pimpl->numberOfNeighborLists_ = numberOfNeighborLists_;
   computeArguments->pimpl->cutoffs_ = cutoffs_;
+  computeArguments->pimpl->statistics_
+      = statisticsEnabled_ ? &statistics_ : NULL;
+  computeArguments->pimpl->getNestedNeighborListsNumberOfNeighbors_.resize(
+      numberOfNeighborLists_);
+  computeArguments->pimpl->nestedMasterListCached_ = false;
   // Resize computeArguments storage if needed
   if (simulatorNumbering_ != modelNumbering_)
   {
@@ -1320,24 +1985,80 @@ int ModelImplementation::Compute(
         numberOfNeighborLists_);
   }
 
-  // Call the Model supplied compute routine
-  int error = ModelCompute(computeArguments);
+  return false;
+}
 
+void ModelImplementation::FinishCompute(
+    ComputeArguments const * const computeArguments) const
+{
   // Unset cutoffs data within computeArguments
   computeArguments->pimpl->inModelComputeRoutine_ = false;
   computeArguments->pimpl->numberOfNeighborLists_ = 0;
   computeArguments->pimpl->cutoffs_ = NULL;
+  computeArguments->pimpl->statistics_ = NULL;
+}
 
-  if (error)
+int ModelImplementation::IsComputeEnsembleSupported()
+{
+  if (computeEnsembleSupported_ == -1)
   {
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
+    computeEnsembleSupported_ = false;
+
+    // the extension structure holds C++ interface pointers
+    if ((routineFunction_[MODEL_ROUTINE_NAME::Extension] != NULL)
+        && (routineLanguage_[MODEL_ROUTINE_NAME::Extension]
+            == LANGUAGE_NAME::cpp))
+    {
+      SupportedExtensions supportedExtensions;
+      supportedExtensions.numberOfSupportedExtensions = 0;
+      if (!ModelExtension(KIM_SUPPORTED_EXTENSIONS_ID, &supportedExtensions))
+      {
+        for (int i = 0; i < supportedExtensions.numberOfSupportedExtensions;
+             ++i)
+        {
+          if (strcmp(supportedExtensions.supportedExtensionID[i],
+                     KIM_COMPUTE_ENSEMBLE_ID)
+              == 0)
+          { computeEnsembleSupported_ = true; }
+        }
+      }
+    }
   }
-  else
-  {
-    LOG_DEBUG("Exit 0=" + callString);
+
+  return computeEnsembleSupported_;
+}
+
+int ModelImplementation::CanComputeEnsemble(
+    int const numberOfMembers,
+    ModelImplementation * const * const members,
+    ComputeArguments const * const * const computeArguments)
+{
+  if ((numberOfMembers < 2) || (modelDriverName_ == "")
+      || (!IsComputeEnsembleSupported()))
     return false;
+
+  // the driver walks the neighbor lists of the first member for all of
+  // them, so the members must request the same lists
+  for (int i = 1; i < numberOfMembers; ++i)
+  {
+    ModelImplementation const * const member = members[i];
+    if ((member->modelDriverName_ != modelDriverName_)
+        || (*(member->influenceDistance_) != *influenceDistance_)
+        || (member->numberOfNeighborLists_ != numberOfNeighborLists_)
+        || (!computeArguments[i]->pimpl->HasSameInputs(
+            *(computeArguments[0]->pimpl))))
+      return false;
+
+    for (int j = 0; j < numberOfNeighborLists_; ++j)
+    {
+      if ((member->cutoffs_[j] != cutoffs_[j])
+          || (member->modelWillNotRequestNeighborsOfNoncontributingParticles_[j]
+              != modelWillNotRequestNeighborsOfNoncontributingParticles_[j]))
+        return false;
+    }
   }
+
+  return true;
 }
 
 void ModelImplementation::GetExtensionID(
@@ -1388,6 +2109,7 @@ int ModelImplementation::ClearThenRefresh()
   std::string const callString = "ClearThenRefresh().";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("Model::ClearThenRefresh", modelName_.c_str());
 
   if (parameterPointer_.size() == 0)
   {
@@ -1401,8 +2123,11 @@ int ModelImplementation::ClearThenRefresh()
   numberOfNeighborLists_ = 0;
   cutoffs_ = NULL;
   modelWillNotRequestNeighborsOfNoncontributingParticles_ = NULL;
+  numberOfSpeciesCodes_ = 0;
+  speciesPairCutoffs_ = NULL;
 
   // Call Model supplied Refresh routine
+  SortChangedParameterElements();
   int error = ModelRefresh();
 
   if (error)
@@ -1412,6 +2137,15 @@ int ModelImplementation::ClearThenRefresh()
   }
   else
   {
+    // the Model has now seen all changes
+    for (std::vector<std::vector<int> >::iterator changed
+         = parameterChangedElements_.begin();
+         changed != parameterChangedElements_.end();
+         ++changed)
+      changed->clear();
+    parameterAllElementsChanged_.assign(parameterAllElementsChanged_.size(),
+                                        false);
+
 #if ERROR_VERBOSITY
     // error checking
     if (influenceDistance_ == NULL)
@@ -1454,6 +2188,11 @@ int ModelImplementation::ClearThenRefresh()
       return true;
     }
 #endif
+    if (CheckSpeciesPairCutoffs())
+    {
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
     LOG_DEBUG("Exit 0=" + callString);
     return false;
   }
@@ -1556,6 +2295,183 @@ int ModelImplementation::WriteParameterizedModel(
   return false;
 }
 
+void ModelImplementation::SetStatisticsEnabled(int const enabled)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "SetStatisticsEnabled(" + SNUM(enabled) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  statisticsEnabled_ = (enabled != 0);
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
+void ModelImplementation::GetStatistics(long * const computeCalls,
+                                        double * const computeTime,
+                                        long * const neighborListCalls,
+                                        double * const neighborListTime,
+                                        long * const neighborsServed,
+                                        long * const processTermCalls,
+                                        double * const processTermTime) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "GetStatistics(" + SPTR(computeCalls) + ", " + SPTR(computeTime) + ", "
+        + SPTR(neighborListCalls) + ", " + SPTR(neighborListTime) + ", "
+        + SPTR(neighborsServed) + ", " + SPTR(processTermCalls) + ", "
+        + SPTR(processTermTime) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  if (computeCalls != NULL) *computeCalls = statistics_.computeCalls;
+  if (computeTime != NULL) *computeTime = statistics_.computeTime;
+  if (neighborListCalls != NULL)
+    *neighborListCalls = statistics_.neighborListCalls;
+  if (neighborListTime != NULL)
+    *neighborListTime = statistics_.neighborListTime;
+  if (neighborsServed != NULL) *neighborsServed = statistics_.neighborsServed;
+  if (processTermCalls != NULL)
+    *processTermCalls = statistics_.processTermCalls;
+  if (processTermTime != NULL) *processTermTime = statistics_.processTermTime;
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
+void ModelImplementation::ResetStatistics()
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "ResetStatistics().";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  statistics_.Reset();
+
+  LOG_DEBUG("Exit   " + callString);
+}
+
+int ModelImplementation::DeclareSharedBuffer(std::string const & bufferName,
+                                             long const numberOfBytes,
+                                             void ** const buffer,
+                                             int * const mustInitialize)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "DeclareSharedBuffer('" + bufferName + "', " + SNUM(numberOfBytes)
+        + ", " + SPTR(buffer) + ", " + SPTR(mustInitialize) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+#if ERROR_VERBOSITY
+  if (numberOfBytes <= 0)
+  {
+    LOG_ERROR("Number of bytes, " + SNUM(numberOfBytes) + ", must be > 0.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  if (!IsCIdentifier(bufferName))
+  {
+    LOG_ERROR("Name '" + bufferName + "' is not a valid C identifier.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  if (std::find(sharedBufferName_.begin(), sharedBufferName_.end(), bufferName)
+      != sharedBufferName_.end())
+  {
+    LOG_ERROR("Name '" + bufferName
+              + "' is already associated with another "
+                "shared buffer.  Shared buffer names must be unique.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  // Models created on the same node with the same name, requested units and
+  // parameter file contents derive the same contents, so they may share them.
+  if (parameterFilesDigest_.empty())
+  {
+    int error = FilesDigest(parameterFileNames_, &parameterFilesDigest_);
+    if (error)
+    {
+      LOG_ERROR("Unable to read the parameter files.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+  }
+  SharedBuffer * sharedBuffer = NULL;
+  int error = SharedBuffer::Create(modelName_ + " " + requestedUnits_ + " "
+                                       + parameterFilesDigest_ + " "
+                                       + bufferName,
+                                   numberOfBytes,
+                                   &sharedBuffer);
+  if (error)
+  {
+    LOG_ERROR("Unable to allocate shared buffer '" + bufferName + "'.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  if (SharedBuffer::Enabled() && !sharedBuffer->IsShared())
+  {
+    LOG_WARNING("Shared buffer '" + bufferName
+                + "' could not be placed in shared memory.  Using private "
+                  "memory instead.");
+  }
+
+  sharedBufferName_.push_back(bufferName);
+  sharedBuffer_.push_back(sharedBuffer);
+  *buffer = sharedBuffer->Data();
+  *mustInitialize = sharedBuffer->IsOwner();
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
+int ModelImplementation::SetSharedBufferInitialized(void * const buffer)
+{
+#if DEBUG_VERBOSITY
+  std::string const callString
+      = "SetSharedBufferInitialized(" + SPTR(buffer) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  std::size_t index = 0;
+  while ((index < sharedBuffer_.size())
+         && (sharedBuffer_[index]->Data() != buffer))
+    ++index;
+
+#if ERROR_VERBOSITY
+  if (index == sharedBuffer_.size())
+  {
+    LOG_ERROR("Pointer does not refer to a declared shared buffer.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+  if ((!sharedBuffer_[index]->IsOwner())
+      || sharedBuffer_[index]->IsPublished())
+  {
+    LOG_ERROR("Shared buffer '" + sharedBufferName_[index]
+              + "' is already initialized.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+#endif
+
+  int error = sharedBuffer_[index]->Publish();
+  if (error)
+  {
+    LOG_ERROR("Unable to publish shared buffer '" + sharedBufferName_[index]
+              + "'.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
 void ModelImplementation::SetModelBufferPointer(void * const ptr)
 {
 #if DEBUG_VERBOSITY
@@ -1687,6 +2603,8 @@ int ModelImplementation::ConvertUnit(LengthUnit const fromLengthUnit,
                                      double const timeExponent,
                                      double * const conversionFactor)
 {
+  TraceSpan const span("ConvertUnit");
+
   // No debug logging for ConvertUnit: no log object available
   //
   // #if DEBUG_VERBOSITY
@@ -1900,22 +2818,13 @@ std::string const & ModelImplementation::ToString() const
     ModelRoutineName modelRoutineName;
     MODEL_ROUTINE_NAME::GetModelRoutineName(i, &modelRoutineName);
 
-    std::map<ModelRoutineName const,
-             LanguageName,
-             MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-        = routineLanguage_.find(modelRoutineName);
-    std::map<ModelRoutineName const, int, MODEL_ROUTINE_NAME::Comparator>::
-        const_iterator requiredResult
-        = routineRequired_.find(modelRoutineName);
-    std::map<ModelRoutineName const,
-             Function *,
-             MODEL_ROUTINE_NAME::Comparator>::const_iterator fptrResult
-        = routineFunction_.find(modelRoutineName);
+    LanguageName const langResult = routineLanguage_[modelRoutineName];
+    int const requiredResult = routineRequired_[modelRoutineName];
+    Function * const fptrResult = routineFunction_[modelRoutineName];
 
     ss << "\t" << std::setw(25) << modelRoutineName.ToString() << std::setw(10)
-       << langResult->second.ToString() << std::setw(10)
-       << requiredResult->second << std::setw(25) << SFUNC(fptrResult->second)
-       << "\n";
+       << langResult.ToString() << std::setw(10) << requiredResult
+       << std::setw(25) << SFUNC(fptrResult) << "\n";
   }
   ss << "\n";
 
@@ -1964,6 +2873,36 @@ std::string const & ModelImplementation::ToString() const
   }
   ss << "\n\n";
 
+  if (speciesPairCutoffs_ == NULL)
+  {
+    ss << "Species Pair Cutoffs : "
+       << "NULL"
+       << "\n\n";
+  }
+  else
+  {
+    ss << "Species Pair Cutoffs (number of species codes = "
+       << numberOfSpeciesCodes_ << ") :\n";
+    for (int i = 0; i < numberOfNeighborLists_; ++i)
+    {
+      ss << "\t"
+         << "Neighbor list " << i << "\n";
+      for (int j = 0; j < numberOfSpeciesCodes_; ++j)
+      {
+        ss << "\t";
+        for (int k = 0; k < numberOfSpeciesCodes_; ++k)
+        {
+          ss << std::setw(20)
+             << speciesPairCutoffs_[(i * numberOfSpeciesCodes_ + j)
+                                        * numberOfSpeciesCodes_
+                                    + k];
+        }
+        ss << "\n";
+      }
+    }
+    ss << "\n\n";
+  }
+
   ss << "Supported Species :\n";
   int const specWidth = 10;
   ss << "\t" << std::setw(specWidth) << "Species" << std::setw(specWidth)
@@ -2027,6 +2966,7 @@ ModelImplementation::ModelImplementation(SharedLibrary * const sharedLibrary,
                                          Log * const log) :
     modelName_(""),
     modelDriverName_(""),
+    requestedUnits_(""),
     sharedLibrary_(sharedLibrary),
     numberOfParameterFiles_(0),
     log_(log),
@@ -2044,6 +2984,10 @@ ModelImplementation::ModelImplementation(SharedLibrary * const sharedLibrary,
     numberOfNeighborLists_(0),
     cutoffs_(NULL),
     modelWillNotRequestNeighborsOfNoncontributingParticles_(NULL),
+    numberOfSpeciesCodes_(0),
+    speciesPairCutoffs_(NULL),
+    computeEnsembleSupported_(-1),
+    statisticsEnabled_(false),
     modelBuffer_(NULL),
     simulatorBuffer_(NULL),
     string_("")
@@ -2056,17 +3000,9 @@ ModelImplementation::ModelImplementation(SharedLibrary * const sharedLibrary,
 
   // populate default values for
   // routineLanguage, routineRequired, routineFunction
-  int numberOfModelRoutineNames;
-  MODEL_ROUTINE_NAME::GetNumberOfModelRoutineNames(&numberOfModelRoutineNames);
-  for (int i = 0; i < numberOfModelRoutineNames; ++i)
-  {
-    ModelRoutineName modelRoutineName;
-    MODEL_ROUTINE_NAME::GetModelRoutineName(i, &modelRoutineName);
-
-    routineLanguage_[modelRoutineName] = LANGUAGE_NAME::cpp;
-    routineRequired_[modelRoutineName] = false;
-    routineFunction_[modelRoutineName] = NULL;
-  }
+  routineLanguage_.Fill(LANGUAGE_NAME::cpp);
+  routineRequired_.Fill(false);
+  routineFunction_.Fill(NULL);
 
   LOG_DEBUG("Exit   " + callString);
 }
@@ -2078,6 +3014,9 @@ ModelImplementation::~ModelImplementation()
 #endif
   LOG_DEBUG("Enter  " + callString);
 
+  for (std::size_t i = 0; i < sharedBuffer_.size(); ++i)
+    SharedBuffer::Destroy(&(sharedBuffer_[i]));
+
   if (sharedLibrary_->IsOpen()) sharedLibrary_->Close();
   delete sharedLibrary_;
 
@@ -2092,7 +3031,9 @@ int ModelImplementation::ModelCreate(
     ChargeUnit const requestedChargeUnit,
     TemperatureUnit const requestedTemperatureUnit,
     TimeUnit const requestedTimeUnit,
-    std::string const & modelName)
+    std::string const & modelName,
+    std::string const & modelLibraryPath,
+    std::string const & driverLibraryPath)
 {
 #if DEBUG_VERBOSITY
   std::string const callString
@@ -2100,7 +3041,8 @@ int ModelImplementation::ModelCreate(
         + requestedLengthUnit.ToString() + ", " + requestedEnergyUnit.ToString()
         + ", " + requestedChargeUnit.ToString() + ", "
         + requestedTemperatureUnit.ToString() + ", "
-        + requestedTimeUnit.ToString() + ", '" + modelName + "').";
+        + requestedTimeUnit.ToString() + ", '" + modelName + "', '"
+        + modelLibraryPath + "', '" + driverLibraryPath + "').";
 #endif
   LOG_DEBUG("Enter  " + callString);
 
@@ -2118,6 +3060,11 @@ int ModelImplementation::ModelCreate(
 #endif
 
   modelName_ = modelName;
+  requestedUnits_ = requestedLengthUnit.ToString() + " "
+                    + requestedEnergyUnit.ToString() + " "
+                    + requestedChargeUnit.ToString() + " "
+                    + requestedTemperatureUnit.ToString() + " "
+                    + requestedTimeUnit.ToString();
 
   error = SetSimulatorNumbering(numbering);
   if (error)
@@ -2127,23 +3074,30 @@ int ModelImplementation::ModelCreate(
     return true;
   }
 
-  std::string const * itemFilePath;
-  Collections * collections;
-  error = Collections::Create(&collections);
-  if (error)
+  // The collections are only searched for libraries whose path is not given
+  std::string const * itemFilePath = &modelLibraryPath;
+  Collections * collections = NULL;
+  if ((modelLibraryPath == "") || (driverLibraryPath == ""))
   {
-    LOG_ERROR("Could not create Collections object.");
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
+    error = Collections::Create(&collections);
+    if (error)
+    {
+      LOG_ERROR("Could not create Collections object.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+    collections->SetLogID(log_->GetID() + "_Collections");
   }
-  collections->SetLogID(log_->GetID() + "_Collections");
-  error = collections->GetItemLibraryFileNameAndCollection(
-      COLLECTION_ITEM_TYPE::portableModel, modelName, &itemFilePath, NULL);
-  if (error)
+  if (modelLibraryPath == "")
   {
-    LOG_ERROR("Could not find model shared library.");
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
+    error = collections->GetItemLibraryFileNameAndCollection(
+        COLLECTION_ITEM_TYPE::portableModel, modelName, &itemFilePath, NULL);
+    if (error)
+    {
+      LOG_ERROR("Could not find model shared library.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
   }
 
   error = sharedLibrary_->Open(*itemFilePath);
@@ -2154,6 +3108,17 @@ int ModelImplementation::ModelCreate(
     return true;
   }
 
+  if (modelLibraryPath != "")
+  {
+    error = sharedLibrary_->GetItemName(&modelName_);
+    if (error)
+    {
+      LOG_ERROR("Could not get Model name.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+  }
+
   // get driver name
   error = sharedLibrary_->GetDriverName(&modelDriverName_);
   if (error)
@@ -2191,7 +3156,8 @@ int ModelImplementation::ModelCreate(
                                            requestedChargeUnit,
                                            requestedTemperatureUnit,
                                            requestedTimeUnit,
-                                           collections);
+                                           collections,
+                                           driverLibraryPath);
       if (error)
       {
         LOG_ERROR("Initialization of Parameterized Model returned error.");
@@ -2218,7 +3184,7 @@ int ModelImplementation::ModelCreate(
       return true;
     }
   }
-  Collections::Destroy(&collections);
+  if (collections != NULL) Collections::Destroy(&collections);
 
 #if ERROR_VERBOSITY
   // Error checking
@@ -2281,6 +3247,12 @@ int ModelImplementation::ModelCreate(
     return true;
   }
 
+  if (CheckSpeciesPairCutoffs())
+  {
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;
+  }
+
   {
     using namespace KIM::MODEL_ROUTINE_NAME;
     for (unsigned int i = 0; i < requiredByAPI_ModelRoutines.size(); ++i)
@@ -2288,12 +3260,9 @@ int ModelImplementation::ModelCreate(
       ModelRoutineName const modelRoutineName
           = requiredByAPI_ModelRoutines.at(i);
 
-      std::map<ModelRoutineName const,
-               Function *,
-               MODEL_ROUTINE_NAME::Comparator>::const_iterator funcResult
-          = routineFunction_.find(modelRoutineName);
+      Function * const funcResult = routineFunction_[modelRoutineName];
 
-      if (funcResult->second == NULL)
+      if (funcResult == NULL)
       {
         LOG_ERROR("Model supplied Create() routine did not set pointer for "
                   + modelRoutineName.ToString() + ".");
@@ -2362,21 +3331,16 @@ int ModelImplementation::ModelDestroy()
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::Destroy);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::Destroy);
+  Function * const funcResult = routineFunction_[MODEL_ROUTINE_NAME::Destroy];
+  LanguageName const langResult = routineLanguage_[MODEL_ROUTINE_NAME::Destroy];
 
   ModelDestroyFunction * CppDestroy
-      = reinterpret_cast<ModelDestroyFunction *>(funcResult->second);
+      = reinterpret_cast<ModelDestroyFunction *>(funcResult);
   KIM_ModelDestroyFunction * CDestroy
-      = reinterpret_cast<KIM_ModelDestroyFunction *>(funcResult->second);
+      = reinterpret_cast<KIM_ModelDestroyFunction *>(funcResult);
   typedef void ModelDestroyF(KIM_ModelDestroy * const, int * const);
   ModelDestroyF * FDestroy
-      = reinterpret_cast<ModelDestroyF *>(funcResult->second);
+      = reinterpret_cast<ModelDestroyF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2385,17 +3349,17 @@ int ModelImplementation::ModelDestroy()
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppDestroy(reinterpret_cast<KIM::ModelDestroy *>(&M));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelDestroy cM;
     cM.p = &M;
     error = CDestroy(&cM);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelDestroy cM;
     cM.p = &M;
@@ -2431,26 +3395,23 @@ int ModelImplementation::ModelComputeArgumentsCreate(
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::ComputeArgumentsCreate);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::ComputeArgumentsCreate);
+  Function * const funcResult
+      = routineFunction_[MODEL_ROUTINE_NAME::ComputeArgumentsCreate];
+  LanguageName const langResult
+      = routineLanguage_[MODEL_ROUTINE_NAME::ComputeArgumentsCreate];
 
   ModelComputeArgumentsCreateFunction * CppComputeArgumentsCreate
       = reinterpret_cast<ModelComputeArgumentsCreateFunction *>(
-          funcResult->second);
+          funcResult);
   KIM_ModelComputeArgumentsCreateFunction * CComputeArgumentsCreate
       = reinterpret_cast<KIM_ModelComputeArgumentsCreateFunction *>(
-          funcResult->second);
+          funcResult);
   typedef void ModelComputeArgumentsCreateF(
       KIM_ModelCompute const * const,
       KIM_ModelComputeArgumentsCreate * const,
       int * const);
   ModelComputeArgumentsCreateF * FComputeArgumentsCreate
-      = reinterpret_cast<ModelComputeArgumentsCreateF *>(funcResult->second);
+      = reinterpret_cast<ModelComputeArgumentsCreateF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2459,13 +3420,13 @@ int ModelImplementation::ModelComputeArgumentsCreate(
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppComputeArgumentsCreate(
         reinterpret_cast<KIM::ModelCompute const *>(&M),
         reinterpret_cast<KIM::ModelComputeArgumentsCreate *>(computeArguments));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2473,7 +3434,7 @@ int ModelImplementation::ModelComputeArgumentsCreate(
     cMcac.p = computeArguments;
     error = CComputeArgumentsCreate(&cM, &cMcac);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2514,26 +3475,23 @@ int ModelImplementation::ModelComputeArgumentsDestroy(
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::ComputeArgumentsDestroy);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::ComputeArgumentsDestroy);
+  Function * const funcResult
+      = routineFunction_[MODEL_ROUTINE_NAME::ComputeArgumentsDestroy];
+  LanguageName const langResult
+      = routineLanguage_[MODEL_ROUTINE_NAME::ComputeArgumentsDestroy];
 
   ModelComputeArgumentsDestroyFunction * CppComputeArgumentsDestroy
       = reinterpret_cast<ModelComputeArgumentsDestroyFunction *>(
-          funcResult->second);
+          funcResult);
   KIM_ModelComputeArgumentsDestroyFunction * CComputeArgumentsDestroy
       = reinterpret_cast<KIM_ModelComputeArgumentsDestroyFunction *>(
-          funcResult->second);
+          funcResult);
   typedef void ModelComputeArgumentsDestroyF(
       KIM_ModelCompute const * const,
       KIM_ModelComputeArgumentsDestroy * const,
       int * const);
   ModelComputeArgumentsDestroyF * FComputeArgumentsDestroy
-      = reinterpret_cast<ModelComputeArgumentsDestroyF *>(funcResult->second);
+      = reinterpret_cast<ModelComputeArgumentsDestroyF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2542,14 +3500,14 @@ int ModelImplementation::ModelComputeArgumentsDestroy(
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppComputeArgumentsDestroy(
         reinterpret_cast<KIM::ModelCompute const *>(&M),
         reinterpret_cast<KIM::ModelComputeArgumentsDestroy *>(
             computeArguments));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2557,7 +3515,7 @@ int ModelImplementation::ModelComputeArgumentsDestroy(
     cMcad.p = computeArguments;
     error = CComputeArgumentsDestroy(&cM, &cMcad);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2599,23 +3557,18 @@ int ModelImplementation::ModelCompute(
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::Compute);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::Compute);
+  Function * const funcResult = routineFunction_[MODEL_ROUTINE_NAME::Compute];
+  LanguageName const langResult = routineLanguage_[MODEL_ROUTINE_NAME::Compute];
 
   ModelComputeFunction * CppCompute
-      = reinterpret_cast<ModelComputeFunction *>(funcResult->second);
+      = reinterpret_cast<ModelComputeFunction *>(funcResult);
   KIM_ModelComputeFunction * CCompute
-      = reinterpret_cast<KIM_ModelComputeFunction *>(funcResult->second);
+      = reinterpret_cast<KIM_ModelComputeFunction *>(funcResult);
   typedef void ModelComputeF(KIM_ModelCompute * const,
                              KIM_ModelComputeArguments const * const,
                              int * const);
   ModelComputeF * FCompute
-      = reinterpret_cast<ModelComputeF *>(funcResult->second);
+      = reinterpret_cast<ModelComputeF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2624,13 +3577,13 @@ int ModelImplementation::ModelCompute(
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppCompute(
         reinterpret_cast<KIM::ModelCompute const *>(&M),
         reinterpret_cast<KIM::ModelComputeArguments const *>(computeArguments));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2639,7 +3592,7 @@ int ModelImplementation::ModelCompute(
         const_cast<KIM::ComputeArguments *>(computeArguments));
     error = CCompute(&cM, &cMca);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelCompute cM;
     cM.p = &M;
@@ -2680,22 +3633,18 @@ int ModelImplementation::ModelExtension(void * const extensionStructure)
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::Extension);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::Extension);
+  Function * const funcResult = routineFunction_[MODEL_ROUTINE_NAME::Extension];
+  LanguageName const langResult
+      = routineLanguage_[MODEL_ROUTINE_NAME::Extension];
 
   ModelExtensionFunction * CppExtension
-      = reinterpret_cast<ModelExtensionFunction *>(funcResult->second);
+      = reinterpret_cast<ModelExtensionFunction *>(funcResult);
   KIM_ModelExtensionFunction * CExtension
-      = reinterpret_cast<KIM_ModelExtensionFunction *>(funcResult->second);
+      = reinterpret_cast<KIM_ModelExtensionFunction *>(funcResult);
   typedef void ModelExtensionF(
       KIM_ModelExtension * const, void * const, int * const);
   ModelExtensionF * FExtension
-      = reinterpret_cast<ModelExtensionF *>(funcResult->second);
+      = reinterpret_cast<ModelExtensionF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2704,18 +3653,18 @@ int ModelImplementation::ModelExtension(void * const extensionStructure)
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppExtension(reinterpret_cast<KIM::ModelExtension *>(&M),
                          extensionStructure);
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelExtension cM;
     cM.p = &M;
     error = CExtension(&cM, extensionStructure);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelExtension cM;
     cM.p = &M;
@@ -2743,6 +3692,17 @@ int ModelImplementation::ModelExtension(void * const extensionStructure)
   }
 }
 
+int ModelImplementation::ModelExtension(std::string const & extensionID,
+                                        void * const extensionStructure)
+{
+  std::string const previousExtensionID = extensionID_;
+  extensionID_ = extensionID;
+  int error = ModelExtension(extensionStructure);
+  extensionID_ = previousExtensionID;
+
+  return error;
+}
+
 int ModelImplementation::ModelRefresh()
 {
 #if DEBUG_VERBOSITY
@@ -2758,21 +3718,16 @@ int ModelImplementation::ModelRefresh()
     return true;
   }
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::Refresh);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::Refresh);
+  Function * const funcResult = routineFunction_[MODEL_ROUTINE_NAME::Refresh];
+  LanguageName const langResult = routineLanguage_[MODEL_ROUTINE_NAME::Refresh];
 
   ModelRefreshFunction * CppRefresh
-      = reinterpret_cast<ModelRefreshFunction *>(funcResult->second);
+      = reinterpret_cast<ModelRefreshFunction *>(funcResult);
   KIM_ModelRefreshFunction * CRefresh
-      = reinterpret_cast<KIM_ModelRefreshFunction *>(funcResult->second);
+      = reinterpret_cast<KIM_ModelRefreshFunction *>(funcResult);
   typedef void ModelRefreshF(KIM_ModelRefresh * const, int * const);
   ModelRefreshF * FRefresh
-      = reinterpret_cast<ModelRefreshF *>(funcResult->second);
+      = reinterpret_cast<ModelRefreshF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2781,17 +3736,17 @@ int ModelImplementation::ModelRefresh()
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppRefresh(reinterpret_cast<KIM::ModelRefresh *>(&M));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelRefresh cM;
     cM.p = &M;
     error = CRefresh(&cM);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelRefresh cM;
     cM.p = &M;
@@ -2826,24 +3781,21 @@ int ModelImplementation::ModelWriteParameterizedModel() const
 #endif
   LOG_DEBUG("Enter  " + callString);
 
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>::
-      const_iterator funcResult
-      = routineFunction_.find(MODEL_ROUTINE_NAME::WriteParameterizedModel);
-  std::map<ModelRoutineName const,
-           LanguageName,
-           MODEL_ROUTINE_NAME::Comparator>::const_iterator langResult
-      = routineLanguage_.find(MODEL_ROUTINE_NAME::WriteParameterizedModel);
+  Function * const funcResult
+      = routineFunction_[MODEL_ROUTINE_NAME::WriteParameterizedModel];
+  LanguageName const langResult
+      = routineLanguage_[MODEL_ROUTINE_NAME::WriteParameterizedModel];
 
   ModelWriteParameterizedModelFunction * CppWriteParameterizedModel
       = reinterpret_cast<ModelWriteParameterizedModelFunction *>(
-          funcResult->second);
+          funcResult);
   KIM_ModelWriteParameterizedModelFunction * CWriteParameterizedModel
       = reinterpret_cast<KIM_ModelWriteParameterizedModelFunction *>(
-          funcResult->second);
+          funcResult);
   typedef void ModelWriteParameterizedModelF(
       KIM_ModelWriteParameterizedModel * const, int * const);
   ModelWriteParameterizedModelF * FWriteParameterizedModel
-      = reinterpret_cast<ModelWriteParameterizedModelF *>(funcResult->second);
+      = reinterpret_cast<ModelWriteParameterizedModelF *>(funcResult);
 
   int error;
   struct Mdl
@@ -2852,18 +3804,18 @@ int ModelImplementation::ModelWriteParameterizedModel() const
   };
   Mdl M;
   M.p = this;
-  if (langResult->second == LANGUAGE_NAME::cpp)
+  if (langResult == LANGUAGE_NAME::cpp)
   {
     error = CppWriteParameterizedModel(
         reinterpret_cast<KIM::ModelWriteParameterizedModel const *>(&M));
   }
-  else if (langResult->second == LANGUAGE_NAME::c)
+  else if (langResult == LANGUAGE_NAME::c)
   {
     KIM_ModelWriteParameterizedModel cM;
     cM.p = &M;
     error = CWriteParameterizedModel(&cM);
   }
-  else if (langResult->second == LANGUAGE_NAME::fortran)
+  else if (langResult == LANGUAGE_NAME::fortran)
   {
     KIM_ModelWriteParameterizedModel cM;
     cM.p = &M;
@@ -2948,6 +3900,7 @@ int ModelImplementation::InitializeStandAloneModel(
                             KIM_TimeUnit const requestedTimeUnit,
                             int * const ierr);
   ModelCreateF * FCreate = reinterpret_cast<ModelCreateF *>(functionPointer);
+  double const createBeginTime = TRACE::enabled.Get() ? TRACE::Now() : 0.0;
 
   struct Mdl
   {
@@ -3001,6 +3954,13 @@ int ModelImplementation::InitializeStandAloneModel(
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
+  if (TRACE::enabled.Get())
+  {
+    TRACE::Record("Model Create routine",
+                  modelName_.c_str(),
+                  createBeginTime,
+                  TRACE::Now());
+  }
   if (error)
   {
     LOG_ERROR("Model supplied Create() routine returned error.");
@@ -3020,7 +3980,8 @@ int ModelImplementation::InitializeParameterizedModel(
     ChargeUnit const requestedChargeUnit,
     TemperatureUnit const requestedTemperatureUnit,
     TimeUnit const requestedTimeUnit,
-    Collections * collections)
+    Collections * collections,
+    std::string const & driverLibraryPath)
 {
 #if DEBUG_VERBOSITY
   std::string const callString
@@ -3074,14 +4035,20 @@ int ModelImplementation::InitializeParameterizedModel(
   SharedLibrary * parameterizedModelLibrary = sharedLibrary_;
   sharedLibrary_ = new SharedLibrary(log_);
 
-  std::string const * itemFilePath;
-  error = collections->GetItemLibraryFileNameAndCollection(
-      COLLECTION_ITEM_TYPE::modelDriver, modelDriverName_, &itemFilePath, NULL);
-  if (error)
+  std::string const * itemFilePath = &driverLibraryPath;
+  if (driverLibraryPath == "")
   {
-    LOG_ERROR("Could not find model driver shared library.");
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
+    error = collections->GetItemLibraryFileNameAndCollection(
+        COLLECTION_ITEM_TYPE::modelDriver,
+        modelDriverName_,
+        &itemFilePath,
+        NULL);
+    if (error)
+    {
+      LOG_ERROR("Could not find model driver shared library.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
   }
 
   error = sharedLibrary_->Open(*itemFilePath);
@@ -3092,6 +4059,20 @@ int ModelImplementation::InitializeParameterizedModel(
     return true;
   }
 
+  if (driverLibraryPath != "")
+  {
+    std::string driverName;
+    error = sharedLibrary_->GetItemName(&driverName);
+    if ((error) || (driverName != modelDriverName_))
+    {
+      LOG_ERROR("Model driver shared library '" + driverLibraryPath
+                + "' is not the '" + modelDriverName_
+                + "' driver required by the model.");
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
+  }
+
   // check that it is a driver
   CollectionItemType itemType;
   error = sharedLibrary_->GetType(&itemType);
@@ -3131,6 +4112,7 @@ int ModelImplementation::InitializeParameterizedModel(
       int * const);
   ModelDriverCreateF * FCreate
       = reinterpret_cast<ModelDriverCreateF *>(functionPointer);
+  double const createBeginTime = TRACE::enabled.Get() ? TRACE::Now() : 0.0;
 
 
   struct Mdl
@@ -3185,6 +4167,13 @@ int ModelImplementation::InitializeParameterizedModel(
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
+  if (TRACE::enabled.Get())
+  {
+    TRACE::Record("Model Driver Create routine",
+                  modelDriverName_.c_str(),
+                  createBeginTime,
+                  TRACE::Now());
+  }
   if (error)
   {
     LOG_ERROR("Model Driver supplied Create() routine returned error.");
@@ -3192,6 +4181,19 @@ int ModelImplementation::InitializeParameterizedModel(
     return true;
   }
 
+  // release the other Model objects waiting for buffers that were never
+  // initialized; they fall back to private memory
+  for (std::size_t i = 0; i < sharedBuffer_.size(); ++i)
+  {
+    if (sharedBuffer_[i]->IsOwner() && !sharedBuffer_[i]->IsPublished())
+    {
+      LOG_WARNING("Shared buffer '" + sharedBufferName_[i]
+                  + "' was not initialized by the Model Driver Create "
+                    "routine.  Other Model objects will not share it.");
+      sharedBuffer_[i]->Withdraw();
+    }
+  }
+
   // remove parameter files
   parameterizedModelLibrary->RemoveParameterFileDirectory();
   parameterizedModelLibrary->Close();
@@ -3206,6 +4208,65 @@ int ModelImplementation::InitializeParameterizedModel(
   return false;
 }
 
+int ModelImplementation::CheckSpeciesPairCutoffs() const
+{
+  // The species pair cutoffs are optional
+  if (speciesPairCutoffs_ == NULL) return false;
+
+  if (cutoffs_ == NULL)
+  {
+    LOG_ERROR("Species pair cutoffs set without neighbor list cutoffs.");
+    return true;
+  }
+
+  for (std::map<SpeciesName const, int, SPECIES_NAME::Comparator>::
+           const_iterator spec
+       = supportedSpecies_.begin();
+       spec != supportedSpecies_.end();
+       ++spec)
+  {
+    if ((spec->second < 0) || (spec->second >= numberOfSpeciesCodes_))
+    {
+      LOG_ERROR("Species code " + SNUM(spec->second) + " for species "
+                + spec->first.ToString()
+                + " is outside the range of the species pair cutoffs.");
+      return true;
+    }
+  }
+
+  return CheckSpeciesPairCutoffValues(numberOfSpeciesCodes_,
+                                      speciesPairCutoffs_);
+}
+
+int ModelImplementation::CheckSpeciesPairCutoffValues(
+    int const numberOfSpeciesCodes,
+    double const * const speciesPairCutoffs) const
+{
+  for (int i = 0; i < numberOfNeighborLists_; ++i)
+  {
+    for (int j = 0; j < numberOfSpeciesCodes; ++j)
+    {
+      for (int k = 0; k < numberOfSpeciesCodes; ++k)
+      {
+        double const cutoff
+            = speciesPairCutoffs[(i * numberOfSpeciesCodes + j)
+                                     * numberOfSpeciesCodes
+                                 + k];
+        if ((cutoff < 0.0) || (cutoff > cutoffs_[i]))
+        {
+          LOG_ERROR("Species pair cutoff (" + SNUM(j) + ", " + SNUM(k)
+                    + ") of neighbor list " + SNUM(i)
+                    + " is outside the range [0, cutoffs[" + SNUM(i)
+                    + "]].");
+          return true;
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
 int ModelImplementation::IsCIdentifier(std::string const & id) const
 {
   std::string const numbers("0123456789");
@@ -73,6 +73,16 @@
 #include "KIM_FilesystemPath.hpp"
 #endif
 
+#ifndef KIM_MODEL_STATISTICS_HPP_
+#include "KIM_ModelStatistics.hpp"
+#endif
+
+#ifndef KIM_NAME_INDEXED_ARRAY_HPP_
+#include "KIM_NameIndexedArray.hpp"
+#endif
+
+#include "KIM_ModelRoutineName.inc"
+
 namespace KIM
 {
 // Forward declaration
@@ -80,6 +90,7 @@ class Log;
 class Collections;
 class ComputeArguments;
 class SharedLibrary;
+class SharedBuffer;
 
 class ModelImplementation
 {
@@ -93,6 +104,17 @@ class ModelImplementation
                     std::string const & modelName,
                     int * const requestedUnitsAccepted,
                     ModelImplementation ** const modelImplementation);
+  static int
+  CreateFromLibraryPath(Numbering const numbering,
+                        LengthUnit const requestedLengthUnit,
+                        EnergyUnit const requestedEnergyUnit,
+                        ChargeUnit const requestedChargeUnit,
+                        TemperatureUnit const requestedTemperatureUnit,
+                        TimeUnit const requestedTimeUnit,
+                        std::string const & modelLibraryPath,
+                        std::string const & driverLibraryPath,
+                        int * const requestedUnitsAccepted,
+                        ModelImplementation ** const modelImplementation);
   static void Destroy(ModelImplementation ** const modelImplementation);
 
   int IsRoutinePresent(ModelRoutineName const modelRoutineName,
@@ -116,6 +138,12 @@ class ModelImplementation
       int const ** const modelWillNotRequestNeighborsOfNoncontributingParticles)
       const;
 
+  int SetSpeciesPairCutoffsPointer(int const numberOfSpeciesCodes,
+                                   double const * const speciesPairCutoffs);
+  void
+  GetSpeciesPairCutoffsPointer(int * const numberOfSpeciesCodes,
+                               double const ** const speciesPairCutoffs) const;
+
 
   int SetRoutinePointer(ModelRoutineName const modelRoutineName,
                         LanguageName const languageName,
@@ -183,9 +211,38 @@ class ModelImplementation
   int SetParameter(int const parameterIndex,
                    int const arrayIndex,
                    double const parameterValue);
+  int GetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        int * const parameterValues) const;
+  int GetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        double * const parameterValues) const;
+  int SetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        int const * const parameterValues);
+  int SetParameterArray(int const parameterIndex,
+                        int const offset,
+                        int const count,
+                        double const * const parameterValues);
+  void GetParameterVectorSize(int * const parameterVectorSize) const;
+  int GetParameterVector(int const parameterVectorSize,
+                         double * const parameterValues) const;
+  int SetParameterVector(int const parameterVectorSize,
+                         double const * const parameterValues);
+  int GetNumberOfChangedParameterElements(
+      int const parameterIndex, int * const numberOfChangedElements) const;
+  int GetChangedParameterElement(int const parameterIndex,
+                                 int const index,
+                                 int * const arrayIndex) const;
 
 
   int Compute(ComputeArguments const * const computeArguments) const;
+  int ComputeEnsemble(int const numberOfMembers,
+                      ModelImplementation * const * const members,
+                      ComputeArguments const * const * const computeArguments);
 
   void GetExtensionID(std::string const ** const extensionID) const;
   int Extension(std::string const & extensionID,
@@ -197,6 +254,22 @@ class ModelImplementation
   int WriteParameterizedModel(std::string const & path,
                               std::string const & modelName) const;
 
+  void SetStatisticsEnabled(int const enabled);
+  void GetStatistics(long * const computeCalls,
+                     double * const computeTime,
+                     long * const neighborListCalls,
+                     double * const neighborListTime,
+                     long * const neighborsServed,
+                     long * const processTermCalls,
+                     double * const processTermTime) const;
+  void ResetStatistics();
+
+
+  int DeclareSharedBuffer(std::string const & bufferName,
+                          long const numberOfBytes,
+                          void ** const buffer,
+                          int * const mustInitialize);
+  int SetSharedBufferInitialized(void * const buffer);
 
   void SetModelBufferPointer(void * const ptr);
   void GetModelBufferPointer(void ** const ptr) const;
@@ -244,13 +317,29 @@ class ModelImplementation
   ModelImplementation(SharedLibrary * const sharedLibrary, Log * const log);
   ~ModelImplementation();
 
+  // modelName is searched for in the collections unless modelLibraryPath is
+  // given; likewise for the driver of a parameterized model.
+  static int CreateModel(Numbering const numbering,
+                         LengthUnit const requestedLengthUnit,
+                         EnergyUnit const requestedEnergyUnit,
+                         ChargeUnit const requestedChargeUnit,
+                         TemperatureUnit const requestedTemperatureUnit,
+                         TimeUnit const requestedTimeUnit,
+                         std::string const & modelName,
+                         std::string const & modelLibraryPath,
+                         std::string const & driverLibraryPath,
+                         int * const requestedUnitsAccepted,
+                         ModelImplementation ** const modelImplementation);
+
   int ModelCreate(Numbering const numbering,
                   LengthUnit const requestedLengthUnit,
                   EnergyUnit const requestedEnergyUnit,
                   ChargeUnit const requestedChargeUnit,
                   TemperatureUnit const requestedTemperatureUnit,
                   TimeUnit const requestedTimeUnit,
-                  std::string const & modelName);
+                  std::string const & modelName,
+                  std::string const & modelLibraryPath,
+                  std::string const & driverLibraryPath);
   int ModelDestroy();
 
   int ModelComputeArgumentsCreate(
@@ -260,14 +349,29 @@ class ModelImplementation
 
   int ModelCompute(ComputeArguments const * const computeArguments) const;
   int ModelExtension(void * const extensionStructure);
+  int ModelExtension(std::string const & extensionID,
+                     void * const extensionStructure);
   int ModelRefresh();
   int ModelWriteParameterizedModel() const;
 
 
+  int PrepareCompute(ComputeArguments const * const computeArguments) const;
+  void FinishCompute(ComputeArguments const * const computeArguments) const;
+  int IsComputeEnsembleSupported();
+  int CanComputeEnsemble(
+      int const numberOfMembers,
+      ModelImplementation * const * const members,
+      ComputeArguments const * const * const computeArguments);
+
   int IsCIdentifier(std::string const & id) const;
+  int CheckSpeciesPairCutoffs() const;
+  int CheckSpeciesPairCutoffValues(
+      int const numberOfSpeciesCodes,
+      double const * const speciesPairCutoffs) const;
 
   std::string modelName_;
   std::string modelDriverName_;
+  std::string requestedUnits_;  // part of the shared buffer keys
 
   SharedLibrary * sharedLibrary_;
   FILESYSTEM::Path parameterFileDirectoryName_;
@@ -290,7 +394,8 @@ class ModelImplementation
       ChargeUnit const requestedChargeUnit,
       TemperatureUnit const requestedTemperatureUnit,
       TimeUnit const requestedTimeUnit,
-      Collections * collections);
+      Collections * collections,
+      std::string const & driverLibraryPath);
 
   bool numberingHasBeenSet_;
   Numbering modelNumbering_;
@@ -312,12 +417,21 @@ class ModelImplementation
   double const * cutoffs_;
   int const * modelWillNotRequestNeighborsOfNoncontributingParticles_;
 
-  std::map<ModelRoutineName const, LanguageName, MODEL_ROUTINE_NAME::Comparator>
-      routineLanguage_;
-  std::map<ModelRoutineName const, int, MODEL_ROUTINE_NAME::Comparator>
-      routineRequired_;
-  std::map<ModelRoutineName const, Function *, MODEL_ROUTINE_NAME::Comparator>
-      routineFunction_;
+  int numberOfSpeciesCodes_;
+  double const * speciesPairCutoffs_;
+
+  template<class Value>
+  struct RoutineArray
+  {
+    typedef NameIndexedArray<ModelRoutineName,
+                             &ModelRoutineName::modelRoutineNameID,
+                             Value,
+                             NUMBER_OF_MODEL_ROUTINE_NAMES>
+        Type;
+  };
+  RoutineArray<LanguageName>::Type routineLanguage_;
+  RoutineArray<int>::Type routineRequired_;
+  RoutineArray<Function *>::Type routineFunction_;
 
   std::map<SpeciesName const, int, SPECIES_NAME::Comparator> supportedSpecies_;
 
@@ -327,13 +441,35 @@ class ModelImplementation
   std::vector<DataType> parameterDataType_;
   std::vector<int> parameterExtent_;
   std::vector<void *> parameterPointer_;
+  // array indices set since the last successful Refresh; sorted and unique
+  // while the Model's Refresh routine runs.  Empty, and the flag set, once
+  // every element of the array has been set.
+  std::vector<std::vector<int> > parameterChangedElements_;
+  std::vector<bool> parameterAllElementsChanged_;
+  void MarkParameterElementsChanged(int const parameterIndex,
+                                    int const offset,
+                                    int const count);
+  int CheckParameterArrayRange(int const parameterIndex,
+                               DataType const dataType,
+                               int const offset,
+                               int const count) const;
+  int ParameterVectorSize() const;
+  void SortChangedParameterElements();
 
   std::string extensionID_;
+  int computeEnsembleSupported_;  // -1 until the Model has been queried
 
   mutable std::string writePath_;
   mutable std::string writeModelName_;
   mutable std::stringstream cmakelists_;
 
+  bool statisticsEnabled_;
+  mutable ModelStatistics statistics_;
+
+  std::string parameterFilesDigest_;
+  std::vector<std::string> sharedBufferName_;
+  std::vector<SharedBuffer *> sharedBuffer_;
+
   void * modelBuffer_;
   void * simulatorBuffer_;
 
@@ -69,6 +69,33 @@ void ModelRefresh::SetNeighborListPointers(
       modelWillNotRequestNeighborsOfNoncontributingParticles);
 }
 
+int ModelRefresh::SetSpeciesPairCutoffsPointer(
+    int const numberOfSpeciesCodes, double const * const speciesPairCutoffs)
+{
+  CONVERT_POINTER;
+
+  return pImpl->SetSpeciesPairCutoffsPointer(numberOfSpeciesCodes,
+                                             speciesPairCutoffs);
+}
+
+int ModelRefresh::GetNumberOfChangedParameterElements(
+    int const parameterIndex, int * const numberOfChangedElements) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetNumberOfChangedParameterElements(parameterIndex,
+                                                    numberOfChangedElements);
+}
+
+int ModelRefresh::GetChangedParameterElement(int const parameterIndex,
+                                             int const index,
+                                             int * const arrayIndex) const
+{
+  CONVERT_POINTER;
+
+  return pImpl->GetChangedParameterElement(parameterIndex, index, arrayIndex);
+}
+
 void ModelRefresh::GetModelBufferPointer(void ** const ptr) const
 {
   CONVERT_POINTER;
@@ -0,0 +1,84 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_MODEL_STATISTICS_HPP_
+#define KIM_MODEL_STATISTICS_HPP_
+
+#if defined(_WIN32)
+#include <ctime>
+#else
+#include <time.h>
+#endif
+
+namespace KIM
+{
+// Counters behind Model::GetStatistics().  They are only updated while
+// collection is enabled by Model::SetStatisticsEnabled(); otherwise the
+// ComputeArgumentsImplementation holds a NULL pointer and each callback pays
+// a single branch.
+struct ModelStatistics
+{
+  ModelStatistics() { Reset(); }
+
+  void Reset()
+  {
+    computeCalls = 0;
+    computeTime = 0.0;
+    neighborListCalls = 0;
+    neighborListTime = 0.0;
+    neighborsServed = 0;
+    processTermCalls = 0;
+    processTermTime = 0.0;
+  }
+
+  // Seconds from an arbitrary origin; only differences are meaningful
+  static double WallTime()
+  {
+#if defined(_WIN32)
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) + 1.0e-9 * ts.tv_nsec;
+#endif
+  }
+
+  long computeCalls;
+  double computeTime;
+  long neighborListCalls;
+  double neighborListTime;
+  long neighborsServed;
+  long processTermCalls;
+  double processTermTime;
+};  // struct ModelStatistics
+}  // namespace KIM
+
+#endif  // KIM_MODEL_STATISTICS_HPP_
@@ -0,0 +1,75 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_NAME_INDEXED_ARRAY_HPP_
+#define KIM_NAME_INDEXED_ARRAY_HPP_
+
+namespace KIM
+{
+// Fixed-size storage of one Value per Name (ComputeArgumentName,
+// ComputeCallbackName, ModelRoutineName, ...), indexed directly by the
+// name's ID.  Replaces std::map where the IDs are small and dense.
+//
+// Unknown names share one extra slot past the known ones, so that they
+// never index outside the array.  As with the maps this replaces, callers
+// are expected to reject unknown names before relying on their values.
+template<class Name, int Name::*nameID, class Value, int numberOfNames>
+class NameIndexedArray
+{
+ public:
+  NameIndexedArray() {}
+  explicit NameIndexedArray(Value const & value) { Fill(value); }
+
+  void Fill(Value const & value)
+  {
+    for (int i = 0; i <= numberOfNames; ++i) values_[i] = value;
+  }
+
+  static int Size() { return numberOfNames; }
+
+  Value & operator[](Name const & name) { return values_[Index(name)]; }
+  Value const & operator[](Name const & name) const
+  {
+    return values_[Index(name)];
+  }
+
+ private:
+  static int Index(Name const & name)
+  {
+    int const id = name.*nameID;
+    return ((id < 0) || (id >= numberOfNames)) ? numberOfNames : id;
+  }
+
+  Value values_[numberOfNames + 1];
+};  // class NameIndexedArray
+}  // namespace KIM
+
+#endif  // KIM_NAME_INDEXED_ARRAY_HPP_
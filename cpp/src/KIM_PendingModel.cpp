@@ -0,0 +1,64 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include <cstddef>
+
+#ifndef KIM_PENDING_MODEL_HPP_
+#include "KIM_PendingModel.hpp"
+#endif
+
+#ifndef KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
+#include "KIM_PendingModelImplementation.hpp"
+#endif
+
+namespace KIM
+{
+void PendingModel::Destroy(PendingModel ** const pendingModel)
+{
+  if (*pendingModel != NULL)
+  { PendingModelImplementation::Destroy(&((*pendingModel)->pimpl)); }
+  delete *pendingModel;
+  *pendingModel = NULL;
+}
+
+void PendingModel::IsComplete(int * const isComplete) const
+{
+  pimpl->IsComplete(isComplete);
+}
+
+int PendingModel::Wait(int * const requestedUnitsAccepted, Model ** const model)
+{
+  return pimpl->Wait(requestedUnitsAccepted, model);
+}
+
+PendingModel::PendingModel() : pimpl(NULL) {}
+
+PendingModel::~PendingModel() {}
+}  // namespace KIM
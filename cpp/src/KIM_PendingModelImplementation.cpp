@@ -0,0 +1,164 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include <cstddef>
+
+#ifndef KIM_MODEL_HPP_
+#include "KIM_Model.hpp"
+#endif
+
+#ifndef KIM_TRACE_HPP_
+#include "KIM_Trace.hpp"
+#endif
+
+#ifndef KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
+#include "KIM_PendingModelImplementation.hpp"
+#endif
+
+namespace KIM
+{
+int PendingModelImplementation::Create(
+    Numbering const numbering,
+    LengthUnit const requestedLengthUnit,
+    EnergyUnit const requestedEnergyUnit,
+    ChargeUnit const requestedChargeUnit,
+    TemperatureUnit const requestedTemperatureUnit,
+    TimeUnit const requestedTimeUnit,
+    std::string const & modelName,
+    PendingModelImplementation ** const pendingModelImplementation)
+{
+  PendingModelImplementation * const pPendingModelImplementation
+      = new PendingModelImplementation(numbering,
+                                       requestedLengthUnit,
+                                       requestedEnergyUnit,
+                                       requestedChargeUnit,
+                                       requestedTemperatureUnit,
+                                       requestedTimeUnit,
+                                       modelName);
+
+  // If no thread can be started, create the Model on the caller's thread so
+  // that the PendingModel is complete on return.
+  if (pPendingModelImplementation->thread_.Start(&CreateModel,
+                                                 pPendingModelImplementation))
+    CreateModel(pPendingModelImplementation);
+
+  *pendingModelImplementation = pPendingModelImplementation;
+  return false;
+}
+
+void PendingModelImplementation::Destroy(
+    PendingModelImplementation ** const pendingModelImplementation)
+{
+  if (*pendingModelImplementation != NULL)
+  {
+    (*pendingModelImplementation)->thread_.Join();
+    if ((*pendingModelImplementation)->model_ != NULL)
+      Model::Destroy(&((*pendingModelImplementation)->model_));
+  }
+  delete *pendingModelImplementation;
+  *pendingModelImplementation = NULL;
+}
+
+void PendingModelImplementation::IsComplete(int * const isComplete) const
+{
+  MutexLock lock(mutex_);
+  *isComplete = isComplete_;
+}
+
+int PendingModelImplementation::Wait(int * const requestedUnitsAccepted,
+                                     Model ** const model)
+{
+  TraceSpan span("PendingModel::Wait", modelName_.c_str());
+
+  thread_.Join();
+
+  if ((error_) || (isRetrieved_))
+  {
+    *model = NULL;
+    return true;
+  }
+
+  *requestedUnitsAccepted = requestedUnitsAccepted_;
+  *model = model_;
+  model_ = NULL;
+  isRetrieved_ = true;
+  return false;
+}
+
+PendingModelImplementation::PendingModelImplementation(
+    Numbering const numbering,
+    LengthUnit const requestedLengthUnit,
+    EnergyUnit const requestedEnergyUnit,
+    ChargeUnit const requestedChargeUnit,
+    TemperatureUnit const requestedTemperatureUnit,
+    TimeUnit const requestedTimeUnit,
+    std::string const & modelName) :
+    numbering_(numbering),
+    requestedLengthUnit_(requestedLengthUnit),
+    requestedEnergyUnit_(requestedEnergyUnit),
+    requestedChargeUnit_(requestedChargeUnit),
+    requestedTemperatureUnit_(requestedTemperatureUnit),
+    requestedTimeUnit_(requestedTimeUnit),
+    modelName_(modelName),
+    isComplete_(false),
+    isRetrieved_(false),
+    error_(false),
+    requestedUnitsAccepted_(false),
+    model_(NULL)
+{
+}
+
+PendingModelImplementation::~PendingModelImplementation() {}
+
+void PendingModelImplementation::CreateModel(
+    void * const pendingModelImplementation)
+{
+  PendingModelImplementation * const pPendingModelImplementation
+      = static_cast<PendingModelImplementation *>(pendingModelImplementation);
+
+  TraceSpan span("Model::CreateAsync",
+                 pPendingModelImplementation->modelName_.c_str());
+
+  pPendingModelImplementation->error_ = Model::Create(
+      pPendingModelImplementation->numbering_,
+      pPendingModelImplementation->requestedLengthUnit_,
+      pPendingModelImplementation->requestedEnergyUnit_,
+      pPendingModelImplementation->requestedChargeUnit_,
+      pPendingModelImplementation->requestedTemperatureUnit_,
+      pPendingModelImplementation->requestedTimeUnit_,
+      pPendingModelImplementation->modelName_,
+      &(pPendingModelImplementation->requestedUnitsAccepted_),
+      &(pPendingModelImplementation->model_));
+
+  MutexLock lock(pPendingModelImplementation->mutex_);
+  pPendingModelImplementation->isComplete_ = true;
+}
+}  // namespace KIM
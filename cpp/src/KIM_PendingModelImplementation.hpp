@@ -0,0 +1,107 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
+#define KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
+
+#include <string>
+
+#ifndef KIM_NUMBERING_HPP_
+#include "KIM_Numbering.hpp"
+#endif
+
+#ifndef KIM_UNIT_SYSTEM_HPP_
+#include "KIM_UnitSystem.hpp"
+#endif
+
+#ifndef KIM_THREADS_HPP_
+#include "KIM_Threads.hpp"
+#endif
+
+namespace KIM
+{
+// Forward declaration
+class Model;
+
+class PendingModelImplementation
+{
+ public:
+  static int
+  Create(Numbering const numbering,
+         LengthUnit const requestedLengthUnit,
+         EnergyUnit const requestedEnergyUnit,
+         ChargeUnit const requestedChargeUnit,
+         TemperatureUnit const requestedTemperatureUnit,
+         TimeUnit const requestedTimeUnit,
+         std::string const & modelName,
+         PendingModelImplementation ** const pendingModelImplementation);
+  static void
+  Destroy(PendingModelImplementation ** const pendingModelImplementation);
+
+  void IsComplete(int * const isComplete) const;
+
+  int Wait(int * const requestedUnitsAccepted, Model ** const model);
+
+ private:
+  // do not allow copy constructor or operator=
+  PendingModelImplementation(PendingModelImplementation const &);
+  void operator=(PendingModelImplementation const &);
+
+  PendingModelImplementation(Numbering const numbering,
+                             LengthUnit const requestedLengthUnit,
+                             EnergyUnit const requestedEnergyUnit,
+                             ChargeUnit const requestedChargeUnit,
+                             TemperatureUnit const requestedTemperatureUnit,
+                             TimeUnit const requestedTimeUnit,
+                             std::string const & modelName);
+  ~PendingModelImplementation();
+
+  // Thread routine; argument is the PendingModelImplementation
+  static void CreateModel(void * const pendingModelImplementation);
+
+  Numbering const numbering_;
+  LengthUnit const requestedLengthUnit_;
+  EnergyUnit const requestedEnergyUnit_;
+  ChargeUnit const requestedChargeUnit_;
+  TemperatureUnit const requestedTemperatureUnit_;
+  TimeUnit const requestedTimeUnit_;
+  std::string const modelName_;
+
+  Thread thread_;
+  mutable Mutex mutex_;
+  bool isComplete_;  // guarded by mutex_
+  bool isRetrieved_;
+  int error_;
+  int requestedUnitsAccepted_;
+  Model * model_;
+};  // class PendingModelImplementation
+}  // namespace KIM
+#endif  // KIM_PENDING_MODEL_IMPLEMENTATION_HPP_
@@ -0,0 +1,387 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#ifndef KIM_CONFIGURATION_HPP_
+#include "KIM_Configuration.hpp"
+#endif
+
+#ifndef KIM_SHARED_BUFFER_HPP_
+#include "KIM_SharedBuffer.hpp"
+#endif
+
+#ifndef KIM_HASH_HPP_
+#include "KIM_Hash.hpp"
+#endif
+
+namespace KIM
+{
+// Layout of the first page(s) of a segment; the key follows the struct and
+// the data starts at the next page boundary.
+struct SharedBuffer::Header
+{
+  unsigned int magic;
+  volatile int state;
+  long numberOfBytes;
+};
+
+namespace
+{
+unsigned int const headerMagic = 0x4b494d53;  // "KIMS"
+int const stateInitializing = 0;  // ftruncate() zero-fills the segment
+int const stateReady = 1;
+int const stateFailed = 2;
+int const createAttempts = 3;
+// how long an unsized segment is given before its owner is presumed dead
+int const sizingGraceMilliseconds = 100;
+
+#if !defined(_WIN32)
+// POSIX shared-memory names may be as short as 31 characters (macOS), so
+// the (user id, key) pair is reduced to its 64-bit FNV-1a hash.
+std::string SegmentName(std::string const & key)
+{
+  char uid[32];
+  std::sprintf(uid, "%lu:", static_cast<unsigned long>(getuid()));
+  Fnv1aHash hash;
+  hash.Add(uid + key);
+  return "/kim-" + hash.Digest();
+}
+
+void SleepOneMillisecond()
+{
+  struct timespec const delay = {0, 1000000};
+  nanosleep(&delay, NULL);
+}
+
+// Remove the name of the segment open on fd, unless the name has meanwhile
+// been given to another segment.  The caller must hold the exclusive lock
+// on fd: every remover holds it, so the name cannot change in between.
+void UnlinkIfCurrent(std::string const & segmentName, int const fd)
+{
+  int const currentFd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+  if (currentFd < 0) return;
+
+  struct stat status;
+  struct stat currentStatus;
+  if ((fstat(fd, &status) == 0) && (fstat(currentFd, &currentStatus) == 0)
+      && (status.st_dev == currentStatus.st_dev)
+      && (status.st_ino == currentStatus.st_ino))
+  {
+    shm_unlink(segmentName.c_str());
+  }
+  close(currentFd);
+}
+#endif
+}  // namespace
+
+
+bool SharedBuffer::Enabled()
+{
+#if defined(_WIN32)
+  return false;
+#else
+  char const * const value = getenv(KIM_ENVIRONMENT_SHARED_MEMORY);
+  return (value != NULL) && (*value != '\0') && (std::strcmp(value, "0") != 0);
+#endif
+}
+
+int SharedBuffer::Create(std::string const & key,
+                         long const numberOfBytes,
+                         SharedBuffer ** const sharedBuffer)
+{
+  if (numberOfBytes <= 0) return true;
+
+  SharedBuffer * const pSharedBuffer = new SharedBuffer();
+  int error = true;
+  if (Enabled()) error = pSharedBuffer->CreateShared(key, numberOfBytes);
+  // fall back to private memory whenever the segment could not be used
+  if (error) error = pSharedBuffer->CreatePrivate(numberOfBytes);
+  if (error)
+  {
+    delete pSharedBuffer;
+    return true;
+  }
+
+  *sharedBuffer = pSharedBuffer;
+  return false;
+}
+
+void SharedBuffer::Destroy(SharedBuffer ** const sharedBuffer)
+{
+  delete *sharedBuffer;
+  *sharedBuffer = NULL;
+}
+
+int SharedBuffer::Publish()
+{
+  if ((!isOwner_) || isPublished_ || isWithdrawn_) return true;
+
+#if !defined(_WIN32)
+  if (header_ != NULL)
+  {
+    mprotect(data_, numberOfBytes_, PROT_READ);
+    __sync_synchronize();  // contents before state
+    header_->state = stateReady;
+    // from now on the owner is an ordinary user
+    flock(fd_, LOCK_SH);
+  }
+#endif
+  isPublished_ = true;
+  return false;
+}
+
+void SharedBuffer::Withdraw()
+{
+  if ((!isOwner_) || isPublished_ || isWithdrawn_) return;
+
+#if !defined(_WIN32)
+  if (header_ != NULL)
+  {  // release the waiting creators; the owner still holds the exclusive lock
+    header_->state = stateFailed;
+    UnlinkIfCurrent(segmentName_, fd_);
+  }
+#endif
+  isWithdrawn_ = true;
+}
+
+SharedBuffer::SharedBuffer() :
+    header_(NULL),
+    headerBytes_(0),
+    fd_(-1),
+    data_(NULL),
+    numberOfBytes_(0),
+    isOwner_(false),
+    isPublished_(false),
+    isWithdrawn_(false)
+{
+}
+
+SharedBuffer::~SharedBuffer()
+{
+#if !defined(_WIN32)
+  if (header_ != NULL)
+  {
+    if (isOwner_ && (!isPublished_)) { Withdraw(); }
+    else
+    {  // the last user gets the exclusive lock and removes the segment
+      flock(fd_, LOCK_UN);
+      if (flock(fd_, LOCK_EX | LOCK_NB) == 0)
+        UnlinkIfCurrent(segmentName_, fd_);
+    }
+    munmap(data_, numberOfBytes_);
+    munmap(header_, headerBytes_);
+    close(fd_);
+    return;
+  }
+#endif
+  std::free(data_);
+}
+
+int SharedBuffer::CreatePrivate(long const numberOfBytes)
+{
+  data_ = std::calloc(numberOfBytes, 1);
+  if (data_ == NULL) return true;
+
+  numberOfBytes_ = numberOfBytes;
+  isOwner_ = true;
+  return false;
+}
+
+// Every process with a segment open holds a flock() on it, which the kernel
+// releases when the process dies: the owner holds the exclusive lock until
+// it publishes, and afterwards all users hold shared locks.  A waiter that
+// gets the exclusive lock of an unpublished segment has therefore outlived
+// its owner.
+int SharedBuffer::CreateShared(std::string const & key,
+                               long const numberOfBytes)
+{
+#if defined(_WIN32)
+  (void) key;
+  (void) numberOfBytes;
+  return true;
+#else
+  long const pageSize = sysconf(_SC_PAGESIZE);
+  long const headerBytes
+      = ((sizeof(Header) + key.size() + 1 + pageSize - 1) / pageSize)
+        * pageSize;
+  off_t const segmentBytes = headerBytes + numberOfBytes;
+  std::string const segmentName = SegmentName(key);
+
+  for (int attempt = 0; attempt < createAttempts; ++attempt)
+  {
+    // become the owner if the segment does not exist yet
+    int fd = shm_open(
+        segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    bool const isOwner = (fd >= 0);
+    if (isOwner)
+    {  // lock before sizing, so that a sized segment always has a holder
+      if (flock(fd, LOCK_EX) != 0)
+      {  // no locks, so no one else can use the segment either
+        shm_unlink(segmentName.c_str());
+        close(fd);
+        return true;
+      }
+      if (ftruncate(fd, segmentBytes) != 0)
+      {
+        UnlinkIfCurrent(segmentName, fd);
+        close(fd);
+        return true;
+      }
+    }
+    else
+    {
+      if (errno != EEXIST) return true;
+      fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+      if (fd < 0)
+      {
+        if (errno == ENOENT) continue;  // unlinked in between; start over
+        return true;
+      }
+    }
+
+    // the owner may not have sized the segment yet
+    bool ownerDied = false;
+    struct stat status;
+    int waited = 0;
+    while ((fstat(fd, &status) == 0) && (status.st_size == 0)
+           && (waited < 1000 * timeoutSeconds))
+    {
+      if ((waited >= sizingGraceMilliseconds)
+          && (flock(fd, LOCK_EX | LOCK_NB) == 0))
+      {
+        ownerDied = ((fstat(fd, &status) == 0) && (status.st_size == 0));
+        if (ownerDied) break;
+        flock(fd, LOCK_UN);
+      }
+      SleepOneMillisecond();
+      ++waited;
+    }
+    if (ownerDied)
+    {  // remove the abandoned segment and try to become its owner
+      UnlinkIfCurrent(segmentName, fd);
+      close(fd);
+      continue;
+    }
+    if (status.st_size != segmentBytes)
+    {  // hash collision, size mismatch or timeout; do not touch it
+      close(fd);
+      return true;
+    }
+
+    void * const header = mmap(
+        NULL, headerBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    void * const data
+        = (header == MAP_FAILED)
+              ? MAP_FAILED
+              : mmap(NULL,
+                     numberOfBytes,
+                     isOwner ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                     MAP_SHARED,
+                     fd,
+                     headerBytes);
+    if (data == MAP_FAILED)
+    {
+      if (header != MAP_FAILED) munmap(header, headerBytes);
+      if (isOwner) UnlinkIfCurrent(segmentName, fd);
+      close(fd);
+      return true;
+    }
+
+    Header * const pHeader = static_cast<Header *>(header);
+    segmentName_ = segmentName;
+    header_ = pHeader;
+    headerBytes_ = headerBytes;
+    fd_ = fd;
+    data_ = data;
+    numberOfBytes_ = numberOfBytes;
+
+    if (isOwner)
+    {
+      pHeader->magic = headerMagic;
+      pHeader->numberOfBytes = numberOfBytes;
+      std::memcpy(pHeader + 1, key.c_str(), key.size() + 1);
+      isOwner_ = true;
+      return false;
+    }
+
+    // wait for the owner to publish; give up if it has died
+    waited = 0;
+    while ((pHeader->state == stateInitializing)
+           && (waited < 1000 * timeoutSeconds))
+    {
+      if (flock(fd, LOCK_EX | LOCK_NB) == 0)
+      {
+        ownerDied = (pHeader->state == stateInitializing);
+        break;
+      }
+      SleepOneMillisecond();
+      ++waited;
+    }
+    __sync_synchronize();  // state before contents
+
+    bool const isUsable
+        = (pHeader->state == stateReady) && (pHeader->magic == headerMagic)
+          && (pHeader->numberOfBytes == numberOfBytes)
+          && (key == reinterpret_cast<char const *>(pHeader + 1));
+    if (isUsable && (flock(fd, LOCK_SH) == 0))
+    {
+      isPublished_ = true;
+      return false;
+    }
+
+    if (ownerDied) UnlinkIfCurrent(segmentName, fd);
+    munmap(data_, numberOfBytes_);
+    munmap(header_, headerBytes_);
+    close(fd_);
+    header_ = NULL;
+    fd_ = -1;
+    data_ = NULL;
+    numberOfBytes_ = 0;
+    // try to become the owner of a fresh segment
+    if (!ownerDied) return true;
+  }
+  return true;
+#endif
+}
+}  // namespace KIM
@@ -0,0 +1,102 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_SHARED_BUFFER_HPP_
+#define KIM_SHARED_BUFFER_HPP_
+
+#include <string>
+
+namespace KIM
+{
+// A block of memory that is filled once and then only read.  When the
+// KIM_API_SHARED_MEMORY environment variable is set to a value other than
+// "0", the block lives in a POSIX shared-memory segment named after its key,
+// so that every process on the node that asks for the same key (and size)
+// maps the same physical pages.  Otherwise, and on platforms without POSIX
+// shared memory, it is ordinary private memory.
+//
+// The first creator of a key is its owner: it must fill Data() and then call
+// Publish().  Every other creator waits until the owner has published and
+// gets a read-only mapping.  If the owner fails, withdraws (or takes longer
+// than timeoutSeconds) the waiting creators fall back to private memory and
+// become owners of that; if the owner dies, one of them takes over the key.
+// The last user to go away removes the segment, so a segment left behind by
+// crashed processes is removed by its next user.  Segments are only used
+// where they can be locked with flock().
+class SharedBuffer
+{
+ public:
+  static int Create(std::string const & key,
+                    long const numberOfBytes,
+                    SharedBuffer ** const sharedBuffer);
+  static void Destroy(SharedBuffer ** const sharedBuffer);
+
+  void * Data() const { return data_; }
+  long NumberOfBytes() const { return numberOfBytes_; }
+  bool IsOwner() const { return isOwner_; }
+  bool IsShared() const { return header_ != 0; }
+  bool IsPublished() const { return isPublished_; }
+
+  // Make the contents visible to the other processes; owner only.
+  int Publish();
+  // Give up on publishing: release the waiting creators and remove the
+  // segment.  The contents stay usable as private memory; owner only.
+  void Withdraw();
+
+  static bool Enabled();
+  static int const timeoutSeconds = 30;
+
+ private:
+  // do not allow copy constructor or operator=
+  SharedBuffer(SharedBuffer const &);
+  void operator=(SharedBuffer const &);
+
+  SharedBuffer();
+  ~SharedBuffer();
+
+  int CreatePrivate(long const numberOfBytes);
+  int CreateShared(std::string const & key, long const numberOfBytes);
+
+  struct Header;
+
+  std::string segmentName_;
+  Header * header_;
+  long headerBytes_;
+  int fd_;
+  void * data_;
+  long numberOfBytes_;
+  bool isOwner_;
+  bool isPublished_;
+  bool isWithdrawn_;
+};  // class SharedBuffer
+}  // namespace KIM
+
+#endif  // KIM_SHARED_BUFFER_HPP_
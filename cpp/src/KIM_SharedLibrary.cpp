@@ -36,9 +36,14 @@
 #include <libloaderapi.h>
 #endif
 #include <fstream>
+#include <map>
 #include <sstream>
 #include <unistd.h>  // IWYU pragma: keep  // For macOS
 
+#ifndef KIM_CONFIGURATION_HPP_
+#include "KIM_Configuration.hpp"
+#endif
+
 #ifndef KIM_SHARED_LIBRARY_HPP_
 #include "KIM_SharedLibrary.hpp"
 #endif
@@ -55,6 +60,10 @@
 #include "KIM_SharedLibrarySchema.hpp"
 #endif
 
+#ifndef KIM_TRACE_HPP_
+#include "KIM_Trace.hpp"
+#endif
+
 #ifndef BASE64_HPP
 #include "b64/decode.h"  // For base64 decoding
 #endif
@@ -83,8 +92,89 @@ KIM::FILESYSTEM::Path PrivateGetORIGIN()
   return KIM::FILESYSTEM::Path(pathBuf).parent_path();
 #endif
 }
+
+// Items may be installed with siblings compiled for higher x86-64 ISA levels
+// (see KIM_API_ITEM_ISA_VARIANTS), named "<stem>-x86-64-vN<suffix>".  Return
+// the one for the highest level supported by the running CPU, or the baseline
+// library itself if there is none.
+KIM::FILESYSTEM::Path
+PrivateSelectISAVariant(KIM::FILESYSTEM::Path const & sharedLibraryName)
+{
+#if (defined(__x86_64__) || defined(__amd64__)) \
+    && (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+  std::string const suffix = KIM_SHARED_MODULE_SUFFIX;
+  std::string const name = sharedLibraryName.string();
+  if ((name.length() <= suffix.length())
+      || (name.compare(name.length() - suffix.length(), suffix.length(), suffix)
+          != 0))
+    return sharedLibraryName;
+  std::string const stem = name.substr(0, name.length() - suffix.length());
+
+  __builtin_cpu_init();
+  bool const v2 = __builtin_cpu_supports("popcnt")
+                  && __builtin_cpu_supports("sse4.2")
+                  && __builtin_cpu_supports("ssse3");
+  bool const v3 = v2 && __builtin_cpu_supports("avx2")
+                  && __builtin_cpu_supports("bmi")
+                  && __builtin_cpu_supports("bmi2")
+                  && __builtin_cpu_supports("fma");
+  bool const v4 = v3 && __builtin_cpu_supports("avx512f")
+                  && __builtin_cpu_supports("avx512bw")
+                  && __builtin_cpu_supports("avx512cd")
+                  && __builtin_cpu_supports("avx512dq")
+                  && __builtin_cpu_supports("avx512vl");
+  bool const supported[] = {v4, v3, v2};
+  char const * const levels[] = {"-x86-64-v4", "-x86-64-v3", "-x86-64-v2"};
+
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!supported[i]) continue;
+    KIM::FILESYSTEM::Path const variant(stem + levels[i] + suffix);
+    if (variant.exists()) return variant;
+  }
+#endif
+  return sharedLibraryName;
+}
+
+// Registry of the items linked statically into the executable, keyed by their
+// pseudo path.  Items register during static initialization, which may run
+// before this library's own initializers, so the map is created on first use.
+typedef std::map<std::string,
+                 KIM::SHARED_LIBRARY_SCHEMA::SharedLibrarySchemaV2 const *>
+    StaticItemRegistry;
+
+StaticItemRegistry & PrivateGetStaticItemRegistry()
+{
+  static StaticItemRegistry registry;
+  return registry;
+}
+
+std::string PrivateStaticItemPath(KIM::CollectionItemType const itemType,
+                                  std::string const & itemName)
+{
+  return "static:" + itemType.ToString() + "/" + itemName;
+}
+
+int const staticItemSchemaVersion = 2;
 }  // namespace
 
+namespace KIM
+{
+namespace SHARED_LIBRARY_SCHEMA
+{
+int RegisterStaticItem(SharedLibrarySchemaV2 const * const schema)
+{
+  if ((schema == NULL) || (schema->itemName == NULL)) return true;
+
+  return !PrivateGetStaticItemRegistry()
+              .insert(std::make_pair(
+                  PrivateStaticItemPath(schema->itemType, schema->itemName),
+                  schema))
+              .second;
+}
+}  // namespace SHARED_LIBRARY_SCHEMA
+}  // namespace KIM
+
 // log helpers
 #define SNUM(x)                                                \
   static_cast<std::ostringstream const &>(std::ostringstream() \
@@ -109,6 +199,7 @@ SharedLibrary::SharedLibrary::EmbeddedFile::EmbeddedFile() :
 }
 
 SharedLibrary::SharedLibrary(Log * const log) :
+    isStaticItem_(false),
     sharedLibraryHandle_(NULL),
     sharedLibrarySchemaVersion_(NULL),
     createRoutine_(NULL),
@@ -149,6 +240,9 @@ int SharedLibrary::Open(FILESYSTEM::Path const & sharedLibraryName)
   std::string const callString = "Open('" + sharedLibraryName.string() + "').";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  std::string const traceDetail
+      = TRACE::enabled.Get() ? sharedLibraryName.string() : std::string();
+  TraceSpan const span("SharedLibrary::Open", traceDetail.c_str());
 
   if (sharedLibraryHandle_ != NULL)
   {
@@ -158,54 +252,88 @@ int SharedLibrary::Open(FILESYSTEM::Path const & sharedLibraryName)
   }
 
   sharedLibraryName_ = sharedLibraryName;
+  StaticItemRegistry::const_iterator const staticItem
+      = PrivateGetStaticItemRegistry().find(sharedLibraryName_.string());
+  isStaticItem_ = (staticItem != PrivateGetStaticItemRegistry().end());
+  if (isStaticItem_)
+  {
+    LOG_DEBUG("Using statically linked item '" + sharedLibraryName_.string()
+              + "'.");
+    // there is no library handle; any non-NULL value marks the item open
+    sharedLibraryHandle_ = const_cast<void *>(
+        static_cast<void const *>(staticItem->second));
+    sharedLibrarySchemaVersion_ = &staticItemSchemaVersion;
+  }
+  else
+  {
 #ifndef _WIN32
-  sharedLibraryHandle_ = dlopen(sharedLibraryName_.string().c_str(), RTLD_NOW);
+    FILESYSTEM::Path const libraryFile
+        = PrivateSelectISAVariant(sharedLibraryName_);
+    if (libraryFile != sharedLibraryName_)
+    {
+      LOG_DEBUG("Using ISA variant '" + libraryFile.string() + "'.");
+    }
+    sharedLibraryHandle_ = dlopen(libraryFile.string().c_str(), RTLD_NOW);
+    if ((sharedLibraryHandle_ == NULL) && (libraryFile != sharedLibraryName_))
+    {  // e.g. a variant built against other libraries; use the baseline
+      LOG_WARNING("Unable to open ISA variant '" + libraryFile.string()
+                  + "', using '" + sharedLibraryName_.string() + "' instead.");
+      LOG_WARNING(dlerror());
+      sharedLibraryHandle_
+          = dlopen(sharedLibraryName_.string().c_str(), RTLD_NOW);
+    }
 #else
-  FILESYSTEM::Path winPath = sharedLibraryName;
-  sharedLibraryHandle_ = (void *) LoadLibraryExW(
-      winPath.make_preferred().c_str(), NULL, LOAD_WITH_ALTERED_SEARCH_PATH);
+    FILESYSTEM::Path winPath = sharedLibraryName;
+    sharedLibraryHandle_ = (void *) LoadLibraryExW(
+        winPath.make_preferred().c_str(), NULL, LOAD_WITH_ALTERED_SEARCH_PATH);
 #endif
-  if (sharedLibraryHandle_ == NULL)
-  {
-    LOG_ERROR("Unable to open '" + sharedLibraryName_.string() + "'.");
+    if (sharedLibraryHandle_ == NULL)
+    {
+      LOG_ERROR("Unable to open '" + sharedLibraryName_.string() + "'.");
 #ifndef _WIN32
-    LOG_ERROR(dlerror());
+      LOG_ERROR(dlerror());
 #endif
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
-  }
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
 #ifndef _WIN32
-  sharedLibrarySchemaVersion_ = reinterpret_cast<int const *>(
-      dlsym(sharedLibraryHandle_, "kim_shared_library_schema_version"));
+    sharedLibrarySchemaVersion_ = reinterpret_cast<int const *>(
+        dlsym(sharedLibraryHandle_, "kim_shared_library_schema_version"));
 #else
-  sharedLibrarySchemaVersion_ = reinterpret_cast<int const *>(::GetProcAddress(
-      (HMODULE) sharedLibraryHandle_, "kim_shared_library_schema_version"));
+    sharedLibrarySchemaVersion_
+        = reinterpret_cast<int const *>(::GetProcAddress(
+            (HMODULE) sharedLibraryHandle_,
+            "kim_shared_library_schema_version"));
 #endif
-  if (sharedLibrarySchemaVersion_ == NULL)
-  {
-    LOG_ERROR(
-        "Failed to look up symbol 'kim_shared_library_schema_version' in '"
-        + sharedLibraryName_.string() + "'.");
+    if (sharedLibrarySchemaVersion_ == NULL)
+    {
+      LOG_ERROR(
+          "Failed to look up symbol 'kim_shared_library_schema_version' in '"
+          + sharedLibraryName_.string() + "'.");
 #ifndef _WIN32
-    LOG_ERROR(dlerror());
+      LOG_ERROR(dlerror());
 #endif
-    LOG_DEBUG("Exit 1=" + callString);
-    return true;
+      LOG_DEBUG("Exit 1=" + callString);
+      return true;
+    }
   }
 
-
   if (*sharedLibrarySchemaVersion_ == 2)
   {
     using namespace SHARED_LIBRARY_SCHEMA;
+    SharedLibrarySchemaV2 const * schemaV2
+        = static_cast<SharedLibrarySchemaV2 const *>(sharedLibraryHandle_);
+    if (!isStaticItem_)
+    {
 #ifndef _WIN32
-    SharedLibrarySchemaV2 const * const schemaV2
-        = reinterpret_cast<SharedLibrarySchemaV2 const *>(
-            dlsym(sharedLibraryHandle_, "kim_shared_library_schema"));
+      schemaV2 = reinterpret_cast<SharedLibrarySchemaV2 const *>(
+          dlsym(sharedLibraryHandle_, "kim_shared_library_schema"));
 #else
-    SharedLibrarySchemaV2 const * const schemaV2
-        = reinterpret_cast<SharedLibrarySchemaV2 const *>(::GetProcAddress(
-            (HMODULE) sharedLibraryHandle_, "kim_shared_library_schema"));
+      schemaV2 = reinterpret_cast<SharedLibrarySchemaV2 const *>(
+          ::GetProcAddress((HMODULE) sharedLibraryHandle_,
+                           "kim_shared_library_schema"));
 #endif
+    }
     if (schemaV2 == NULL)
     {
       LOG_ERROR("Failed to look up symbol 'kim_shared_library_schema' in '"
@@ -218,6 +346,7 @@ int SharedLibrary::Open(FILESYSTEM::Path const & sharedLibraryName)
     }
 
     itemType_ = schemaV2->itemType;
+    itemName_ = ((schemaV2->itemName) ? schemaV2->itemName : "");
     createLanguageName_ = schemaV2->createLanguageName;
     createRoutine_ = schemaV2->createRoutine;
     driverName_ = ((schemaV2->driverName) ? schemaV2->driverName : "");
@@ -300,6 +429,7 @@ int SharedLibrary::Open(FILESYSTEM::Path const & sharedLibraryName)
       return true;
     }
 
+    itemName_ = ((schemaV1->itemName) ? schemaV1->itemName : "");
     createLanguageName_ = schemaV1->createLanguageName;
     createRoutine_ = schemaV1->createRoutine;
     driverName_ = ((schemaV1->driverName) ? schemaV1->driverName : "");
@@ -369,6 +499,7 @@ int SharedLibrary::Close()
   sharedLibraryName_.clear();
   sharedLibrarySchemaVersion_ = 0;
   createRoutine_ = NULL;
+  itemName_ = "";
   driverName_ = "";
   simulatorModelSpecificationFile_.fileName = NULL;
   simulatorModelSpecificationFile_.fileLength = 0;
@@ -377,18 +508,26 @@ int SharedLibrary::Close()
   parameterFiles_.clear();
   numberOfMetadataFiles_ = 0;
   metadataFiles_.clear();
+  int error = false;
+  if (!isStaticItem_)
+  {
 #ifndef _WIN32
-  int error = dlclose(sharedLibraryHandle_);
+    error = dlclose(sharedLibraryHandle_);
 #else
-  int error = !::FreeLibrary((HMODULE) sharedLibraryHandle_);
+    error = !::FreeLibrary((HMODULE) sharedLibraryHandle_);
 #endif
+  }
   if (error)
   {
     LOG_ERROR("");
     LOG_DEBUG("Exit 1=" + callString);
     return true;
   }
-  else { sharedLibraryHandle_ = NULL; }
+  else
+  {
+    sharedLibraryHandle_ = NULL;
+    isStaticItem_ = false;
+  }
 
   LOG_DEBUG("Exit 0=" + callString);
   return false;
@@ -612,6 +751,7 @@ int SharedLibrary::WriteParameterFileDirectory()
   std::string const callString = "WriteParameterFileDirectory().";
 #endif
   LOG_DEBUG("Enter  " + callString);
+  TraceSpan const span("SharedLibrary::WriteParameterFileDirectory");
 
   int error;
 
@@ -759,6 +899,26 @@ int SharedLibrary::RemoveParameterFileDirectory()
   return false;
 }
 
+int SharedLibrary::GetItemName(std::string * const itemName) const
+{
+#if DEBUG_VERBOSITY
+  std::string const callString = "GetItemName(" + SPTR(itemName) + ").";
+#endif
+  LOG_DEBUG("Enter  " + callString);
+
+  if (sharedLibraryHandle_ == NULL)
+  {
+    LOG_ERROR("Library not open.");
+    LOG_DEBUG("Exit 1=" + callString);
+    return true;  // not open
+  }
+
+  *itemName = itemName_;
+
+  LOG_DEBUG("Exit 0=" + callString);
+  return false;
+}
+
 int SharedLibrary::GetDriverName(std::string * const driverName) const
 {
 #if DEBUG_VERBOSITY
@@ -797,4 +957,17 @@ void SharedLibrary::LogEntry(LogVerbosity const logVerbosity,
 FILESYSTEM::Path const SharedLibrary::ORIGIN = PrivateGetORIGIN();
 
 FILESYSTEM::Path SharedLibrary::GetORIGIN() { return ORIGIN; }
+
+int SharedLibrary::GetStaticItemPath(CollectionItemType const itemType,
+                                     std::string const & itemName,
+                                     FILESYSTEM::Path * const path)
+{
+  std::string const staticItemPath = PrivateStaticItemPath(itemType, itemName);
+  if (PrivateGetStaticItemRegistry().find(staticItemPath)
+      == PrivateGetStaticItemRegistry().end())
+    return true;
+
+  if (path) *path = staticItemPath;
+  return false;
+}
 }  // namespace KIM
@@ -89,6 +89,7 @@ class SharedLibrary
       FILESYSTEM::Path * const directoryName) const;
   int RemoveParameterFileDirectory();
 
+  int GetItemName(std::string * const itemName) const;
   int GetDriverName(std::string * const driverName) const;
   int GetNumberOfMetadataFiles(int * const numberOfMetadataFiles) const;
   int GetMetadataFile(int const index,
@@ -103,6 +104,12 @@ class SharedLibrary
 
   static FILESYSTEM::Path GetORIGIN();
 
+  // Items registered with SHARED_LIBRARY_SCHEMA::RegisterStaticItem() are
+  // opened through a pseudo path that names no file.
+  static int GetStaticItemPath(CollectionItemType const itemType,
+                               std::string const & itemName,
+                               FILESYSTEM::Path * const path);
+
  private:
   // do not allow copy constructor or operator=
   SharedLibrary(SharedLibrary const &);
@@ -122,10 +129,12 @@ class SharedLibrary
   static FILESYSTEM::Path const ORIGIN;
 
   FILESYSTEM::Path sharedLibraryName_;
+  int isStaticItem_;
   void * sharedLibraryHandle_;
   int const * sharedLibrarySchemaVersion_;
 
   CollectionItemType itemType_;
+  std::string itemName_;
   LanguageName createLanguageName_;
   Function * createRoutine_;
   std::string driverName_;
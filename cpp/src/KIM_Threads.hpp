@@ -0,0 +1,187 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#ifndef KIM_THREADS_HPP_
+#define KIM_THREADS_HPP_
+
+// Win32 builds use C++17; elsewhere the library is C++98 and uses pthreads
+#if defined(_WIN32)
+#include <atomic>
+#include <mutex>
+#include <thread>
+#else
+#include <pthread.h>
+#endif
+
+namespace KIM
+{
+class Mutex
+{
+ public:
+#if defined(_WIN32)
+  void Lock() { mutex_.lock(); }
+  void Unlock() { mutex_.unlock(); }
+
+ private:
+  std::mutex mutex_;
+#else
+  Mutex() { pthread_mutex_init(&mutex_, NULL); }
+  ~Mutex() { pthread_mutex_destroy(&mutex_); }
+  void Lock() { pthread_mutex_lock(&mutex_); }
+  void Unlock() { pthread_mutex_unlock(&mutex_); }
+
+ private:
+  pthread_mutex_t mutex_;
+#endif
+
+  // do not allow copy constructor or operator=
+  Mutex(Mutex const &);
+  void operator=(Mutex const &);
+};  // class Mutex
+
+// Holds the lock of a Mutex for the lifetime of the object.
+class MutexLock
+{
+ public:
+  explicit MutexLock(Mutex & mutex) : mutex_(mutex) { mutex_.Lock(); }
+  ~MutexLock() { mutex_.Unlock(); }
+
+ private:
+  // do not allow copy constructor or operator=
+  MutexLock(MutexLock const &);
+  void operator=(MutexLock const &);
+
+  Mutex & mutex_;
+};  // class MutexLock
+
+// A flag that one thread may clear while others read it.  It has no
+// constructor so that a static AtomicFlag is false before any dynamic
+// initialization runs.
+class AtomicFlag
+{
+ public:
+#if defined(_WIN32)
+  bool Get() const { return flag_.load(std::memory_order_acquire); }
+  void Set(bool const value) { flag_.store(value, std::memory_order_release); }
+
+ private:
+  std::atomic<bool> flag_;
+#elif defined(__GNUC__)  // also clang and the Intel compilers
+  bool Get() const { return __atomic_load_n(&flag_, __ATOMIC_ACQUIRE); }
+  void Set(bool const value)
+  {
+    __atomic_store_n(&flag_, value, __ATOMIC_RELEASE);
+  }
+
+ private:
+  bool flag_;
+#else
+  bool Get() const { return flag_; }
+  void Set(bool const value) { flag_ = value; }
+
+ private:
+  bool volatile flag_;
+#endif
+};  // class AtomicFlag
+
+// A joinable thread running a single routine.  Join must be called before
+// the object is destroyed if Start succeeded.
+class Thread
+{
+ public:
+  typedef void Routine(void * const argument);
+
+  Thread() : routine_(0), argument_(0), started_(false) {}
+
+  // returns true on error
+  int Start(Routine * const routine, void * const argument)
+  {
+    if (started_) return true;
+    routine_ = routine;
+    argument_ = argument;
+#if defined(_WIN32)
+    try
+    {
+      thread_ = std::thread(Run, this);
+    }
+    catch (...)
+    {
+      return true;
+    }
+#else
+    if (pthread_create(&thread_, NULL, Run, this) != 0) return true;
+#endif
+    started_ = true;
+    return false;
+  }
+
+  void Join()
+  {
+    if (!started_) return;
+#if defined(_WIN32)
+    thread_.join();
+#else
+    pthread_join(thread_, NULL);
+#endif
+    started_ = false;
+  }
+
+ private:
+  // do not allow copy constructor or operator=
+  Thread(Thread const &);
+  void operator=(Thread const &);
+
+#if defined(_WIN32)
+  static void Run(Thread * const thread)
+  {
+    thread->routine_(thread->argument_);
+  }
+#else
+  static void * Run(void * const thread)
+  {
+    Thread * const pThread = static_cast<Thread *>(thread);
+    pThread->routine_(pThread->argument_);
+    return NULL;
+  }
+#endif
+
+  Routine * routine_;
+  void * argument_;
+  bool started_;
+#if defined(_WIN32)
+  std::thread thread_;
+#else
+  pthread_t thread_;
+#endif
+};  // class Thread
+}  // namespace KIM
+
+#endif  // KIM_THREADS_HPP_
@@ -0,0 +1,258 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#if defined(_WIN32)
+#include <ctime>
+#include <process.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#ifndef KIM_CONFIGURATION_HPP_
+#include "KIM_Configuration.hpp"
+#endif
+
+#ifndef KIM_THREADS_HPP_
+#include "KIM_Threads.hpp"
+#endif
+
+#ifndef KIM_TRACE_HPP_
+#include "KIM_Trace.hpp"
+#endif
+
+// Win32 builds use C++17; elsewhere the library is C++98
+#if defined(_WIN32)
+#define KIM_TRACE_THREAD_LOCAL thread_local
+#else
+#define KIM_TRACE_THREAD_LOCAL __thread
+#endif
+
+namespace KIM
+{
+namespace
+{
+// Events are appended to a per-thread buffer without locking and written
+// out under the file lock once the buffer is full or at library unload.
+std::size_t const eventsPerFlush = 1024;
+
+struct TraceEvent
+{
+  char const * name;
+  std::string detail;
+  double beginTime;
+  double endTime;
+};
+
+// Owned by the TraceFile and never freed before library unload, so the
+// pointer each thread keeps to its buffer stays valid.  A thread only
+// appends under the buffer's own lock, which the TraceFile also takes when
+// it writes out the buffer at unload.
+struct ThreadBuffer
+{
+  ThreadBuffer() : threadID(0), closed(false) {}
+
+  int threadID;
+  bool closed;  // set once the trace file has been written
+  Mutex lock;
+  std::vector<TraceEvent> events;
+};
+
+std::string JsonEscape(char const * const str)
+{
+  std::string escaped;
+  for (char const * c = str; *c != '\0'; ++c)
+  {
+    if ((*c == '"') || (*c == '\\'))
+    {
+      escaped += '\\';
+      escaped += *c;
+    }
+    else if (static_cast<unsigned char>(*c) < 0x20) { escaped += ' '; }
+    else { escaped += *c; }
+  }
+  return escaped;
+}
+
+class TraceFile
+{
+ public:
+  TraceFile() : file_(NULL), processID_(0), numberOfEvents_(0), origin_(0.0)
+  {
+    char const * const fileName = getenv(KIM_ENVIRONMENT_TRACE_FILE);
+    if ((fileName == NULL) || (*fileName == '\0')) return;
+
+    file_ = std::fopen(fileName, "w");
+    if (file_ == NULL) return;
+
+#if defined(_WIN32)
+    processID_ = _getpid();
+#else
+    processID_ = getpid();
+#endif
+    origin_ = TRACE::Now();
+    std::fprintf(file_, "[");
+    TRACE::enabled.Set(true);
+  }
+
+  ~TraceFile()
+  {
+    if (file_ == NULL) return;
+
+    TRACE::enabled.Set(false);
+    // Threads that are still running may hold their buffer's lock (and
+    // then the file lock) in Record; the buffers are written and closed
+    // but not deleted, since those threads keep pointing to them.
+    ThreadBuffer * buffer;
+    for (std::size_t i = 0; (buffer = GetBuffer(i)) != NULL; ++i)
+    {
+      MutexLock const bufferLock(buffer->lock);
+      MutexLock const fileLock(lock_);
+      Write(buffer);
+      buffer->closed = true;
+    }
+    MutexLock const fileLock(lock_);
+    std::fprintf(file_, "\n]\n");
+    std::fclose(file_);
+    file_ = NULL;
+  }
+
+  ThreadBuffer * Register()
+  {
+    ThreadBuffer * const buffer = new ThreadBuffer;
+    buffer->events.reserve(eventsPerFlush);
+    MutexLock const fileLock(lock_);
+    buffer->threadID = static_cast<int>(buffers_.size()) + 1;
+    buffers_.push_back(buffer);
+    return buffer;
+  }
+
+  // must be called with the buffer's lock held
+  void Flush(ThreadBuffer * const buffer)
+  {
+    MutexLock const fileLock(lock_);
+    Write(buffer);
+  }
+
+ private:
+  // do not allow copy constructor or operator=
+  TraceFile(TraceFile const &);
+  void operator=(TraceFile const &);
+
+  // NULL past the last registered buffer
+  ThreadBuffer * GetBuffer(std::size_t const index)
+  {
+    MutexLock const fileLock(lock_);
+    return (index < buffers_.size()) ? buffers_[index] : NULL;
+  }
+
+  // must be called with the buffer's lock and the file lock held
+  void Write(ThreadBuffer * const buffer)
+  {
+    if (file_ == NULL) return;
+
+    for (std::size_t i = 0; i < buffer->events.size(); ++i)
+    {
+      TraceEvent const & event = buffer->events[i];
+      std::fprintf(file_,
+                   "%s\n{\"name\":\"%s\",\"cat\":\"kim-api\",\"ph\":\"X\","
+                   "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d",
+                   (numberOfEvents_ == 0) ? "" : ",",
+                   event.name,
+                   1.0e6 * (event.beginTime - origin_),
+                   1.0e6 * (event.endTime - event.beginTime),
+                   processID_,
+                   buffer->threadID);
+      if (event.detail != "")
+        std::fprintf(file_,
+                     ",\"args\":{\"detail\":\"%s\"}",
+                     event.detail.c_str());
+      std::fprintf(file_, "}");
+      ++numberOfEvents_;
+    }
+    buffer->events.clear();
+  }
+
+  std::FILE * file_;
+  int processID_;
+  long numberOfEvents_;
+  double origin_;
+  Mutex lock_;
+  std::vector<ThreadBuffer *> buffers_;
+};
+
+TraceFile traceFile;
+KIM_TRACE_THREAD_LOCAL ThreadBuffer * threadBuffer = NULL;
+}  // namespace
+
+namespace TRACE
+{
+// zero-initialized (false) before traceFile's constructor may set it
+AtomicFlag enabled;
+
+double Now()
+{
+#if defined(_WIN32)
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + 1.0e-9 * ts.tv_nsec;
+#endif
+}
+
+void Record(char const * const name,
+            char const * const detail,
+            double const beginTime,
+            double const endTime)
+{
+  if (threadBuffer == NULL) threadBuffer = traceFile.Register();
+
+  TraceEvent event;
+  event.name = name;
+  if (detail != NULL) event.detail = JsonEscape(detail);
+  event.beginTime = beginTime;
+  event.endTime = endTime;
+
+  // only contended while the trace file is written at unload
+  MutexLock const bufferLock(threadBuffer->lock);
+  if (threadBuffer->closed) return;
+  threadBuffer->events.push_back(event);
+
+  if (threadBuffer->events.size() >= eventsPerFlush)
+    traceFile.Flush(threadBuffer);
+}
+}  // namespace TRACE
+}  // namespace KIM
@@ -0,0 +1,88 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//    Alexander Stukowski
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+
+#ifndef KIM_TRACE_HPP_
+#define KIM_TRACE_HPP_
+
+#ifndef KIM_THREADS_HPP_
+#include "KIM_Threads.hpp"
+#endif
+
+namespace KIM
+{
+namespace TRACE
+{
+// True when the KIM_API_TRACE_FILE environment variable named an output file
+// that could be opened at library load time; cleared at library unload.
+extern AtomicFlag enabled;
+
+double Now();
+void Record(char const * const name,
+            char const * const detail,
+            double const beginTime,
+            double const endTime);
+}  // namespace TRACE
+
+// Scoped span written to the trace file in the Trace Event JSON format read
+// by chrome://tracing and Perfetto.  When tracing is disabled constructing
+// and destroying a TraceSpan costs one branch each.
+//
+// The name must be a string literal and the detail string must outlive the
+// span.
+class TraceSpan
+{
+ public:
+  explicit TraceSpan(char const * const name, char const * const detail = 0) :
+      name_(name),
+      detail_(detail),
+      beginTime_(TRACE::enabled.Get() ? TRACE::Now() : 0.0)
+  {
+  }
+
+  ~TraceSpan()
+  {
+    if (TRACE::enabled.Get())
+      TRACE::Record(name_, detail_, beginTime_, TRACE::Now());
+  }
+
+ private:
+  // do not allow copy constructor or operator=
+  TraceSpan(TraceSpan const &);
+  void operator=(TraceSpan const &);
+
+  char const * const name_;
+  char const * const detail_;
+  double const beginTime_;
+};  // class TraceSpan
+}  // namespace KIM
+
+#endif  // KIM_TRACE_HPP_
@@ -63,7 +63,8 @@ for processdE in false true; do
                 printf "        forces,\n"                                >> $flName
                 printf "        particleEnergy,\n"                        >> $flName
                 printf "        *virial,\n"                               >> $flName
-                printf "        particleVirial);\n"                       >> $flName
+                printf "        particleVirial,\n"                        >> $flName
+                printf "        particleCost);\n"                         >> $flName
                 printf "    break;\n"                                     >> $flName
                 i=`expr $i + 1`
               done  # sshift
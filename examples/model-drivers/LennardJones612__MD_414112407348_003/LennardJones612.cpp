@@ -25,9 +25,14 @@
 //
 
 
+#include "KIM_ComputeEnsemble.hpp"
+#include "KIM_SupportedExtensions.hpp"
 #include "LennardJones612.hpp"
 #include "LennardJones612Implementation.hpp"
 #include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
 
 
 //==============================================================================
@@ -166,3 +171,54 @@ int LennardJones612::ComputeArgumentsDestroy(
   return modelObject->implementation_->ComputeArgumentsDestroy(
       modelComputeArgumentsDestroy);
 }
+
+//******************************************************************************
+// static member function
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelExtension
+//
+int LennardJones612::Extension(KIM::ModelExtension * const modelExtension,
+                               void * const extensionStructure)
+{
+  std::string const * extensionID;
+  modelExtension->GetExtensionID(&extensionID);
+
+  if (*extensionID == KIM_SUPPORTED_EXTENSIONS_ID)
+  {
+    KIM::SupportedExtensions * const supportedExtensions
+        = static_cast<KIM::SupportedExtensions *>(extensionStructure);
+
+    supportedExtensions->numberOfSupportedExtensions = 2;
+    strcpy(supportedExtensions->supportedExtensionID[0],
+           KIM_SUPPORTED_EXTENSIONS_ID);
+    supportedExtensions->supportedExtensionRequired[0] = false;
+    strcpy(supportedExtensions->supportedExtensionID[1],
+           KIM_COMPUTE_ENSEMBLE_ID);
+    supportedExtensions->supportedExtensionRequired[1] = false;
+
+    return false;
+  }
+  else if (*extensionID == KIM_COMPUTE_ENSEMBLE_ID)
+  {
+    KIM::ComputeEnsemble const * const ensemble
+        = static_cast<KIM::ComputeEnsemble const *>(extensionStructure);
+
+    // all members share this driver, so their buffers are LennardJones612
+    std::vector<LennardJones612Implementation *> members(
+        ensemble->numberOfMembers);
+    for (int m = 0; m < ensemble->numberOfMembers; ++m)
+    {
+      LennardJones612 * modelObject;
+      ensemble->modelCompute[m]->GetModelBufferPointer(
+          reinterpret_cast<void **>(&modelObject));
+      members[m] = modelObject->implementation_;
+    }
+
+    return members[0]->ComputeEnsemble(ensemble, &(members[0]));
+  }
+  else
+  {
+    LOG_ERROR("Unknown extension ID '" + *extensionID + "'.");
+    return true;
+  }
+}
@@ -67,6 +67,8 @@ class LennardJones612
   static int ComputeArgumentsDestroy(
       KIM::ModelCompute const * const modelCompute,
       KIM::ModelComputeArgumentsDestroy * const modelComputeArgumentsDestroy);
+  static int Extension(KIM::ModelExtension * const modelExtension,
+                       void * const extensionStructure);
 
  private:
   LennardJones612Implementation * implementation_;
@@ -26,6 +26,7 @@
 //
 
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iostream>  // IWYU pragma: keep  // BUG WORK-AROUND
@@ -68,6 +69,7 @@ LennardJones612Implementation::LennardJones612Implementation(
     sigmas_(NULL),
     influenceDistance_(0.0),
     cutoffsSq2D_(NULL),
+    speciesPairCutoffs2D_(NULL),
     modelWillNotRequestNeighborsOfNoncontributingParticles_(1),
     fourEpsilonSigma6_2D_(NULL),
     fourEpsilonSigma12_2D_(NULL),
@@ -76,6 +78,7 @@ LennardJones612Implementation::LennardJones612Implementation(
     oneSixtyEightEpsilonSigma6_2D_(NULL),
     sixTwentyFourEpsilonSigma12_2D_(NULL),
     shifts2D_(NULL),
+    sharedPairTables_(false),
     cachedNumberOfParticles_(0)
 {
   FILE * parameterFilePointers[MAX_PARAMETER_FILES];
@@ -98,7 +101,11 @@ LennardJones612Implementation::LennardJones612Implementation(
                       requestedTimeUnit);
   if (*ier) return;
 
-  *ier = SetRefreshMutableValues(modelDriverCreate);
+  *ier = SetRefreshMutableValues(
+      modelDriverCreate, std::vector<bool>(numberUniqueSpeciesPairs_, true));
+  if (*ier) return;
+
+  *ier = SharePairTables(modelDriverCreate);
   if (*ier) return;
 
   *ier = RegisterKIMModelSettings(modelDriverCreate);
@@ -120,8 +127,16 @@ LennardJones612Implementation::~LennardJones612Implementation()
 {  // note: it is ok to delete a null pointer and we have ensured that
   // everything is initialized to null
 
+  if (sharedPairTables_)
+  {  // the table data belongs to the shared buffer
+    double *** tables[NUMBER_PAIR_TABLES];
+    GetPairTables(tables);
+    for (int t = 0; t < NUMBER_PAIR_TABLES; ++t) { (*tables[t])[0] = NULL; }
+  }
+
   delete[] cutoffs_;
   Deallocate2DArray(cutoffsSq2D_);
+  Deallocate2DArray(speciesPairCutoffs2D_);
   delete[] epsilons_;
   delete[] sigmas_;
   Deallocate2DArray(fourEpsilonSigma6_2D_);
@@ -142,7 +157,15 @@ int LennardJones612Implementation::Refresh(
 {
   int ier;
 
-  ier = SetRefreshMutableValues(modelRefresh);
+  // only recompute the values of the species pairs whose parameters changed
+  std::vector<bool> changedPairs;
+  ier = GetChangedSpeciesPairs(modelRefresh, &changedPairs);
+  if (ier) return ier;
+
+  // the shared tables are read-only
+  UnsharePairTables();
+
+  ier = SetRefreshMutableValues(modelRefresh, changedPairs);
   if (ier) return ier;
 
   // nothing else to do for this case
@@ -181,6 +204,10 @@ int LennardJones612Implementation::Compute(
   VectorOfSizeDIM * forces = NULL;
   VectorOfSizeSix * virial = NULL;
   VectorOfSizeSix * particleVirial = NULL;
+  double * particleCost = NULL;
+  SparseHessian hessian;
+  SinglePrecisionArrays singlePrecision;
+  ComponentArrays components;
   ier = SetComputeMutableValues(modelComputeArguments,
                                 isComputeProcess_dEdr,
                                 isComputeProcess_d2Edr2,
@@ -196,7 +223,11 @@ int LennardJones612Implementation::Compute(
                                 particleEnergy,
                                 forces,
                                 virial,
-                                particleVirial);
+                                particleVirial,
+                                particleCost,
+                                hessian,
+                                singlePrecision,
+                                components);
   if (ier) return ier;
 
   // Skip this check for efficiency
@@ -206,7 +237,172 @@ int LennardJones612Implementation::Compute(
 
   bool const isShift = (1 == shift_);
 
+  // Single-precision and component coordinates are copied to an interleaved
+  // double-precision array, and the forces for those arguments are
+  // accumulated in another one and stored once at the end.  These O(N)
+  // conversion passes are cheap next to the pair loop, and they let a single
+  // set of Compute() instantiations serve every layout.
+  int const cachedNumParticles = cachedNumberOfParticles_;
+  if ((coordinates == NULL) && (cachedNumParticles > 0))
+  {
+    coordinatesCopy_.resize(DIMENSION * cachedNumParticles);
+    double * const copy = &(coordinatesCopy_[0]);
+    if (singlePrecision.coordinates != NULL)
+    {
+      for (int i = 0; i < cachedNumParticles; ++i)
+      {
+        for (int k = 0; k < DIMENSION; ++k)
+          copy[DIMENSION * i + k] = singlePrecision.coordinates[i][k];
+      }
+    }
+    else
+    {
+      for (int k = 0; k < DIMENSION; ++k)
+      {
+        double const * const coordinatesK = components.coordinates.component[k];
+        for (int i = 0; i < cachedNumParticles; ++i)
+          copy[DIMENSION * i + k] = coordinatesK[i];
+      }
+    }
+    coordinates = reinterpret_cast<VectorOfSizeDIM const *>(copy);
+  }
+  bool const isForcesAccumulated
+      = (singlePrecision.forces != NULL) || (components.forces[0] != NULL);
+  if (isForcesAccumulated && (cachedNumParticles > 0))
+  {
+    forcesAccumulator_.resize(DIMENSION * cachedNumParticles);
+    forces = reinterpret_cast<VectorOfSizeDIM *>(&(forcesAccumulator_[0]));
+  }
+
 #include "LennardJones612ImplementationComputeDispatch.cpp"
+  if (ier) return ier;
+
+  if (singlePrecision.forces != NULL)
+  {
+    for (int i = 0; i < cachedNumParticles; ++i)
+    {
+      for (int k = 0; k < DIMENSION; ++k)
+        singlePrecision.forces[i][k] = static_cast<float>(forces[i][k]);
+    }
+  }
+  else if (components.forces[0] != NULL)
+  {
+    for (int k = 0; k < DIMENSION; ++k)
+    {
+      double * const forcesK = components.forces[k];
+      for (int i = 0; i < cachedNumParticles; ++i) forcesK[i] = forces[i][k];
+    }
+  }
+
+  // the Hessian is rarely requested, so it is computed in a separate pass
+  if (hessian.blocks != NULL)
+  {
+    ier = ComputeSparseHessian(modelCompute,
+                               modelComputeArguments,
+                               particleSpeciesCodes,
+                               particleContributing,
+                               coordinates,
+                               hessian);
+    if (ier) return ier;
+  }
+
+  // particle costs are rarely requested, so they are counted in a separate
+  // pass and the pair loop above does no work for them
+  if (particleCost != NULL)
+  {
+    ier = ComputeParticleCost(modelComputeArguments,
+                              particleSpeciesCodes,
+                              particleContributing,
+                              coordinates,
+                              particleCost);
+  }
+  return ier;
+}
+
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelCompute
+//
+int LennardJones612Implementation::ComputeEnsemble(
+    KIM::ComputeEnsemble const * const ensemble,
+    LennardJones612Implementation * const * const members)
+{
+  int ier;
+
+  int const numberOfMembers = ensemble->numberOfMembers;
+  KIM::ModelCompute const * const modelCompute = ensemble->modelCompute[0];
+  KIM::ModelComputeArguments const * const modelComputeArguments
+      = ensemble->modelComputeArguments[0];
+
+  // KIM API Model Input (the same for all members)
+  int const * particleSpeciesCodes = NULL;
+  int const * particleContributing = NULL;
+  VectorOfSizeDIM const * coordinates = NULL;
+
+  bool isFused = true;
+  std::vector<EnsembleMember> member(numberOfMembers);
+  for (int m = 0; m < numberOfMembers; ++m)
+  {
+    bool isComputeProcess_dEdr = false;
+    bool isComputeProcess_d2Edr2 = false;
+    double * particleCost = NULL;
+    SparseHessian hessian;
+    SinglePrecisionArrays singlePrecision;
+    ComponentArrays components;
+    member[m].model = members[m];
+    ier = members[m]->SetComputeMutableValues(
+        ensemble->modelComputeArguments[m],
+        isComputeProcess_dEdr,
+        isComputeProcess_d2Edr2,
+        member[m].isComputeEnergy,
+        member[m].isComputeForces,
+        member[m].isComputeParticleEnergy,
+        member[m].isComputeVirial,
+        member[m].isComputeParticleVirial,
+        particleSpeciesCodes,
+        particleContributing,
+        coordinates,
+        member[m].energy,
+        member[m].particleEnergy,
+        member[m].forces,
+        member[m].virial,
+        member[m].particleVirial,
+        particleCost,
+        hessian,
+        singlePrecision,
+        components);
+    if (ier) return ier;
+
+    // process terms, particle costs, Hessians, and other array layouts are
+    // only handled by the per-member computation, and the members' species
+    // codes must index the same parameter tables
+    if (isComputeProcess_dEdr || isComputeProcess_d2Edr2
+        || (particleCost != NULL) || (hessian.blocks != NULL)
+        || (singlePrecision.coordinates != NULL)
+        || (singlePrecision.forces != NULL)
+        || (coordinates == NULL) || (components.forces[0] != NULL)
+        || (members[m]->numberModelSpecies_ != numberModelSpecies_))
+      isFused = false;
+  }
+
+  if (!isFused)
+  {
+    for (int m = 0; m < numberOfMembers; ++m)
+    {
+      ier = members[m]->Compute(ensemble->modelCompute[m],
+                                ensemble->modelComputeArguments[m]);
+      if (ier) return ier;
+    }
+    return ier;
+  }
+
+  ier = ComputeEnsembleMembers(modelCompute,
+                               modelComputeArguments,
+                               numberOfMembers,
+                               &(member[0]),
+                               particleSpeciesCodes,
+                               particleContributing,
+                               coordinates);
   return ier;
 }
 
@@ -258,6 +454,8 @@ void LennardJones612Implementation::AllocateParameterMemory()
   cutoffs_ = new double[numberUniqueSpeciesPairs_];
   AllocateAndInitialize2DArray(
       cutoffsSq2D_, numberModelSpecies_, numberModelSpecies_);
+  AllocateAndInitialize2DArray(
+      speciesPairCutoffs2D_, numberModelSpecies_, numberModelSpecies_);
 
   epsilons_ = new double[numberUniqueSpeciesPairs_];
   sigmas_ = new double[numberUniqueSpeciesPairs_];
@@ -647,6 +845,42 @@ int LennardJones612Implementation::RegisterKIMComputeArgumentsSettings(
                   KIM::SUPPORT_STATUS::optional)
               || modelComputeArgumentsCreate->SetArgumentSupportStatus(
                   KIM::COMPUTE_ARGUMENT_NAME::partialParticleVirial,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinatesX,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinatesY,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForcesX,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForcesY,
+                  KIM::SUPPORT_STATUS::optional)
+              || modelComputeArgumentsCreate->SetArgumentSupportStatus(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ,
                   KIM::SUPPORT_STATUS::optional);
 
 
@@ -658,8 +892,21 @@ int LennardJones612Implementation::RegisterKIMComputeArgumentsSettings(
               KIM::SUPPORT_STATUS::optional)
           || modelComputeArgumentsCreate->SetCallbackSupportStatus(
               KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term,
+              KIM::SUPPORT_STATUS::optional)
+          || modelComputeArgumentsCreate->SetCallbackSupportStatus(
+              KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch,
+              KIM::SUPPORT_STATUS::optional)
+          || modelComputeArgumentsCreate->SetCallbackSupportStatus(
+              KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch,
+              KIM::SUPPORT_STATUS::optional)
+          || modelComputeArgumentsCreate->SetCallbackSupportStatus(
+              KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
               KIM::SUPPORT_STATUS::optional);
 
+  // avoid the copy of each neighbor list made by the KIM API when the
+  // simulator uses one-based numbering; Compute() adds the offset itself
+  modelComputeArgumentsCreate->SetNeighborNumberingTranslation(false);
+
   return error;
 }
 
@@ -760,8 +1007,9 @@ int LennardJones612Implementation::RegisterKIMFunctions(
       = LennardJones612::ComputeArgumentsCreate;
   KIM::ModelComputeArgumentsDestroyFunction * CADestroy
       = LennardJones612::ComputeArgumentsDestroy;
+  KIM::ModelExtensionFunction * extension = LennardJones612::Extension;
 
-  // register the destroy() and reinit() functions
+  // register the destroy(), reinit() and extension() functions
   error = modelDriverCreate->SetRoutinePointer(
               KIM::MODEL_ROUTINE_NAME::Destroy,
               KIM::LANGUAGE_NAME::cpp,
@@ -786,18 +1034,121 @@ int LennardJones612Implementation::RegisterKIMFunctions(
               KIM::MODEL_ROUTINE_NAME::ComputeArgumentsDestroy,
               KIM::LANGUAGE_NAME::cpp,
               true,
-              reinterpret_cast<KIM::Function *>(CADestroy));
+              reinterpret_cast<KIM::Function *>(CADestroy))
+          || modelDriverCreate->SetRoutinePointer(
+              KIM::MODEL_ROUTINE_NAME::Extension,
+              KIM::LANGUAGE_NAME::cpp,
+              false,
+              reinterpret_cast<KIM::Function *>(extension));
   return error;
 }
 
+//******************************************************************************
+void LennardJones612Implementation::GetPairTables(
+    double *** tables[NUMBER_PAIR_TABLES])
+{
+  tables[0] = &cutoffsSq2D_;
+  tables[1] = &speciesPairCutoffs2D_;
+  tables[2] = &fourEpsilonSigma6_2D_;
+  tables[3] = &fourEpsilonSigma12_2D_;
+  tables[4] = &twentyFourEpsilonSigma6_2D_;
+  tables[5] = &fortyEightEpsilonSigma12_2D_;
+  tables[6] = &oneSixtyEightEpsilonSigma6_2D_;
+  tables[7] = &sixTwentyFourEpsilonSigma12_2D_;
+  tables[8] = &shifts2D_;
+}
+
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelDriverCreate
+//
+int LennardJones612Implementation::SharePairTables(
+    KIM::ModelDriverCreate * const modelDriverCreate)
+{  // move the 2D tables into a buffer that the Model objects on the node
+  // created from the same parameters may share; with many species they are
+  // by far the largest part of the Model
+  int ier;
+
+  int const tableSize = numberModelSpecies_ * numberModelSpecies_;
+  void * buffer;
+  int mustInitialize;
+  ier = modelDriverCreate->DeclareSharedBuffer(
+      "pairTables",
+      NUMBER_PAIR_TABLES * tableSize * static_cast<long>(sizeof(double)),
+      &buffer,
+      &mustInitialize);
+  if (ier)
+  {
+    LOG_ERROR("Unable to declare shared buffer");
+    return ier;
+  }
+
+  double *** tables[NUMBER_PAIR_TABLES];
+  GetPairTables(tables);
+  double * const data = static_cast<double *>(buffer);
+  if (mustInitialize)
+  {
+    for (int t = 0; t < NUMBER_PAIR_TABLES; ++t)
+    {
+      std::copy((*tables[t])[0],
+                (*tables[t])[0] + tableSize,
+                data + t * tableSize);
+    }
+    ier = modelDriverCreate->SetSharedBufferInitialized(buffer);
+    if (ier)
+    {
+      LOG_ERROR("Unable to initialize shared buffer");
+      return ier;
+    }
+  }
+
+  // otherwise another Model object computed the same values
+  for (int t = 0; t < NUMBER_PAIR_TABLES; ++t)
+  {
+    double ** const table = *tables[t];
+    delete[] table[0];
+    for (int i = 0; i < numberModelSpecies_; ++i)
+    {
+      table[i] = data + t * tableSize + i * numberModelSpecies_;
+    }
+  }
+  sharedPairTables_ = true;
+
+  ier = modelDriverCreate->SetSpeciesPairCutoffsPointer(
+      numberModelSpecies_, speciesPairCutoffs2D_[0]);
+  return ier;
+}
+
+//******************************************************************************
+void LennardJones612Implementation::UnsharePairTables()
+{  // give the Model its own copy of the 2D tables
+  if (!sharedPairTables_) return;
+
+  int const tableSize = numberModelSpecies_ * numberModelSpecies_;
+  double *** tables[NUMBER_PAIR_TABLES];
+  GetPairTables(tables);
+  for (int t = 0; t < NUMBER_PAIR_TABLES; ++t)
+  {
+    double ** const table = *tables[t];
+    double * const data = new double[tableSize];
+    std::copy(table[0], table[0] + tableSize, data);
+    for (int i = 0; i < numberModelSpecies_; ++i)
+    {
+      table[i] = data + i * numberModelSpecies_;
+    }
+  }
+  sharedPairTables_ = false;
+}
+
 //******************************************************************************
 template<class ModelObj>
 int LennardJones612Implementation::SetRefreshMutableValues(
-    ModelObj * const modelObj)
+    ModelObj * const modelObj, std::vector<bool> const & updatePairs)
 {  // use (possibly) new values of parameters to compute other quantities
   // NOTE: This function is templated because it's called with both a
   //       modelDriverCreate object during initialization and with a
   //       modelRefresh object when the Model's parameters have been altered
+  //       (updatePairs selects the species pairs whose values are updated)
   int ier;
 
   // update cutoffsSq, epsilons, and sigmas
@@ -806,8 +1157,12 @@ int LennardJones612Implementation::SetRefreshMutableValues(
     for (int j = 0; j <= i; ++j)
     {
       int const index = j * numberModelSpecies_ + i - (j * j + j) / 2;
+      if (!updatePairs[index]) continue;
+
       cutoffsSq2D_[i][j] = cutoffsSq2D_[j][i]
           = (cutoffs_[index] * cutoffs_[index]);
+      speciesPairCutoffs2D_[i][j] = speciesPairCutoffs2D_[j][i]
+          = cutoffs_[index];
       fourEpsilonSigma6_2D_[i][j] = fourEpsilonSigma6_2D_[j][i]
           = 4.0 * epsilons_[index] * pow(sigmas_[index], 6.0);
       fourEpsilonSigma12_2D_[i][j] = fourEpsilonSigma12_2D_[j][i]
@@ -849,6 +1204,11 @@ int LennardJones612Implementation::SetRefreshMutableValues(
       1,
       &influenceDistance_,
       &modelWillNotRequestNeighborsOfNoncontributingParticles_);
+  // publish the per species pair cutoffs so that simulators can omit pairs
+  // that do not interact from the neighbor list
+  ier = modelObj->SetSpeciesPairCutoffsPointer(numberModelSpecies_,
+                                               speciesPairCutoffs2D_[0]);
+  if (ier) return ier;
 
   // update shifts
   // compute and set shifts2D_ check if minus sign
@@ -863,6 +1223,8 @@ int LennardJones612Implementation::SetRefreshMutableValues(
       {
         int const index = jSpecies * numberModelSpecies_ + iSpecies
                           - (jSpecies * jSpecies + jSpecies) / 2;
+        if (!updatePairs[index]) continue;
+
         double const rij2 = cutoffs_[index] * cutoffs_[index];
         double const r2iv = 1.0 / rij2;
         double const r6iv = r2iv * r2iv * r2iv;
@@ -877,6 +1239,61 @@ int LennardJones612Implementation::SetRefreshMutableValues(
   return ier;
 }
 
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelRefresh
+//
+int LennardJones612Implementation::GetChangedSpeciesPairs(
+    KIM::ModelRefresh const * const modelRefresh,
+    std::vector<bool> * const changedPairs) const
+{
+  int ier;
+
+  // parameter indices are those published in RegisterKIMParameters()
+  int numberChanged;
+  ier = modelRefresh->GetNumberOfChangedParameterElements(0, &numberChanged);
+  if (ier)
+  {
+    LOG_ERROR("GetNumberOfChangedParameterElements");
+    return ier;
+  }
+  // a change of shift affects every species pair
+  changedPairs->assign(numberUniqueSpeciesPairs_, numberChanged != 0);
+
+  for (int parameterIndex = 1; parameterIndex <= 3; ++parameterIndex)
+  {
+    ier = modelRefresh->GetNumberOfChangedParameterElements(parameterIndex,
+                                                            &numberChanged);
+    if (ier)
+    {
+      LOG_ERROR("GetNumberOfChangedParameterElements");
+      return ier;
+    }
+    if (numberChanged == numberUniqueSpeciesPairs_)
+    {  // the whole array was set
+      changedPairs->assign(numberUniqueSpeciesPairs_, true);
+      continue;
+    }
+
+    for (int i = 0; i < numberChanged; ++i)
+    {
+      int arrayIndex;
+      ier = modelRefresh->GetChangedParameterElement(
+          parameterIndex, i, &arrayIndex);
+      if (ier)
+      {
+        LOG_ERROR("GetChangedParameterElement");
+        return ier;
+      }
+      (*changedPairs)[arrayIndex] = true;
+    }
+  }
+
+  // everything is good
+  ier = false;
+  return ier;
+}
+
 //******************************************************************************
 #undef KIM_LOGGER_OBJECT_NAME
 #define KIM_LOGGER_OBJECT_NAME modelComputeArguments
@@ -897,21 +1314,32 @@ int LennardJones612Implementation::SetComputeMutableValues(
     double *& particleEnergy,
     VectorOfSizeDIM *& forces,
     VectorOfSizeSix *& virial,
-    VectorOfSizeSix *& particleVirial)
+    VectorOfSizeSix *& particleVirial,
+    double *& particleCost,
+    SparseHessian & hessian,
+    SinglePrecisionArrays & singlePrecision,
+    ComponentArrays & components)
 {
   int ier = true;
 
   // get compute flags
   int compProcess_dEdr;
   int compProcess_d2Edr2;
+  int compProcess_dEdrBatch;
+  int compProcess_d2Edr2Batch;
 
   modelComputeArguments->IsCallbackPresent(
       KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTerm, &compProcess_dEdr);
   modelComputeArguments->IsCallbackPresent(
       KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2Term, &compProcess_d2Edr2);
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch, &compProcess_dEdrBatch);
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch,
+      &compProcess_d2Edr2Batch);
 
-  isComputeProcess_dEdr = compProcess_dEdr;
-  isComputeProcess_d2Edr2 = compProcess_d2Edr2;
+  isComputeProcess_dEdr = compProcess_dEdr || compProcess_dEdrBatch;
+  isComputeProcess_d2Edr2 = compProcess_d2Edr2 || compProcess_d2Edr2Batch;
 
   int const * numberOfParticles;
   ier = modelComputeArguments->GetArgumentPointer(
@@ -937,16 +1365,76 @@ int LennardJones612Implementation::SetComputeMutableValues(
             (double const **) &virial)
         || modelComputeArguments->GetArgumentPointer(
             KIM::COMPUTE_ARGUMENT_NAME::partialParticleVirial,
-            (double const **) &particleVirial);
+            (double const **) &particleVirial)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost, &particleCost)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+            &hessian.rowOffsets)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+            &hessian.columnIndices)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks, &hessian.blocks)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat,
+            (float const **) &singlePrecision.coordinates)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat,
+            (float const **) &singlePrecision.forces)
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::coordinatesX,
+            &components.coordinates.component[0])
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::coordinatesY,
+            &components.coordinates.component[1])
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ,
+            &components.coordinates.component[2])
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialForcesX, &components.forces[0])
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialForcesY, &components.forces[1])
+        || modelComputeArguments->GetArgumentPointer(
+            KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ, &components.forces[2]);
   if (ier)
   {
     LOG_ERROR("GetArgumentPointer");
     return ier;
   }
 
+  int const numberOfForceComponents = (components.forces[0] != NULL)
+                                      + (components.forces[1] != NULL)
+                                      + (components.forces[2] != NULL);
+  if ((numberOfForceComponents != 0) && (numberOfForceComponents != DIMENSION))
+  {
+    ier = true;
+    LOG_ERROR("All or none of partialForcesX/Y/Z must be provided");
+    return ier;
+  }
+  if ((forces != NULL) + (singlePrecision.forces != NULL)
+          + (numberOfForceComponents != 0)
+      > 1)
+  {
+    ier = true;
+    LOG_ERROR("Only one of partialForces, partialForcesFloat, and "
+              "partialForcesX/Y/Z may be provided");
+    return ier;
+  }
+
+  if ((hessian.blocks != NULL)
+      && ((hessian.rowOffsets == NULL) || (hessian.columnIndices == NULL)))
+  {
+    ier = true;
+    LOG_ERROR("partialHessianBlocks requires hessianBlockRowOffsets and "
+              "hessianBlockColumnIndices");
+    return ier;
+  }
+
   isComputeEnergy = (energy != NULL);
   isComputeParticleEnergy = (particleEnergy != NULL);
-  isComputeForces = (forces != NULL);
+  isComputeForces = (forces != NULL) || (singlePrecision.forces != NULL)
+                    || (numberOfForceComponents != 0);
   isComputeVirial = (virial != NULL);
   isComputeParticleVirial = (particleVirial != NULL);
 
@@ -1081,6 +1569,370 @@ void LennardJones612Implementation::ProcessParticleVirialTerm(
   }
 }
 
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelCompute
+//
+int LennardJones612Implementation::ComputeEnsembleMembers(
+    KIM::ModelCompute const * const modelCompute,
+    KIM::ModelComputeArguments const * const modelComputeArguments,
+    int const numberOfMembers,
+    EnsembleMember const * const members,
+    const int * const particleSpeciesCodes,
+    const int * const particleContributing,
+    const VectorOfSizeDIM * const coordinates) const
+{
+  int ier = false;
+  int const cachedNumParticles = cachedNumberOfParticles_;
+
+  // initialize each member's output
+  for (int m = 0; m < numberOfMembers; ++m)
+  {
+    EnsembleMember const & mem = members[m];
+    if (mem.isComputeEnergy) { *mem.energy = 0.0; }
+    if (mem.isComputeVirial)
+    {
+      for (int k = 0; k < 6; ++k) (*mem.virial)[k] = 0.0;
+    }
+    for (int i = 0; i < cachedNumParticles; ++i)
+    {
+      if (mem.isComputeParticleEnergy) { mem.particleEnergy[i] = 0.0; }
+      if (mem.isComputeForces)
+      {
+        for (int k = 0; k < DIMENSION; ++k) mem.forces[i][k] = 0.0;
+      }
+      if (mem.isComputeParticleVirial)
+      {
+        for (int k = 0; k < 6; ++k) mem.particleVirial[i][k] = 0.0;
+      }
+    }
+  }
+
+  // calculate contribution from pair function; the neighbor lists and
+  // distances are shared and computed once for all members
+  int numnei = 0;
+  int const * n1atom = NULL;
+  double const * n1dx = NULL;
+  double const * n1r2 = NULL;
+  int useDisplacements = false;
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+      &useDisplacements);
+  int neighborNumberingOffset = 0;
+  modelComputeArguments->GetNeighborNumberingOffset(&neighborNumberingOffset);
+  int const neighborOffset = neighborNumberingOffset;
+  for (int i = 0; i < cachedNumParticles; ++i)
+  {
+    if (!particleContributing[i]) continue;
+
+    if (useDisplacements)
+    {
+      ier = modelComputeArguments->GetNeighborListWithDisplacements(
+          0, i, &numnei, &n1atom, &n1dx, &n1r2);
+      if (ier)
+      {
+        LOG_ERROR("GetNeighborListWithDisplacements");
+        return ier;
+      }
+    }
+    else { modelComputeArguments->GetNeighborList(0, i, &numnei, &n1atom); }
+    int const iSpecies = particleSpeciesCodes[i];
+
+    for (int jj = 0; jj < numnei; ++jj)
+    {
+      int const j = n1atom[jj] + neighborOffset;
+      int const jContrib = particleContributing[j];
+      if (jContrib && (j < i)) continue;  // effective half-list
+
+      int const jSpecies = particleSpeciesCodes[j];
+      double r_ijValue[DIMENSION];
+      double const * r_ij;
+      if (n1dx != NULL) { r_ij = &n1dx[DIMENSION * jj]; }
+      else
+      {
+        for (int k = 0; k < DIMENSION; ++k)
+          r_ijValue[k] = coordinates[j][k] - coordinates[i][k];
+        r_ij = r_ijValue;
+      }
+      double const rij2
+          = (n1r2 != NULL)
+                ? n1r2[jj]
+                : (r_ij[0] * r_ij[0] + r_ij[1] * r_ij[1] + r_ij[2] * r_ij[2]);
+      double const r2iv = 1.0 / rij2;
+      double const r6iv = r2iv * r2iv * r2iv;
+      double const weight = (jContrib == 1) ? 1.0 : 0.5;
+
+      for (int m = 0; m < numberOfMembers; ++m)
+      {
+        EnsembleMember const & mem = members[m];
+        LennardJones612Implementation const & model = *mem.model;
+        if (rij2 > model.cutoffsSq2D_[iSpecies][jSpecies]) continue;
+
+        if (mem.isComputeEnergy || mem.isComputeParticleEnergy)
+        {
+          double phi
+              = r6iv
+                * (model.fourEpsilonSigma12_2D_[iSpecies][jSpecies] * r6iv
+                   - model.fourEpsilonSigma6_2D_[iSpecies][jSpecies]);
+          if (model.shift_ == 1) phi -= model.shifts2D_[iSpecies][jSpecies];
+
+          if (mem.isComputeEnergy) { *mem.energy += weight * phi; }
+          if (mem.isComputeParticleEnergy)
+          {
+            double const halfPhi = 0.5 * phi;
+            mem.particleEnergy[i] += halfPhi;
+            if (jContrib == 1) { mem.particleEnergy[j] += halfPhi; }
+          }
+        }
+
+        if (mem.isComputeForces || mem.isComputeVirial
+            || mem.isComputeParticleVirial)
+        {
+          double const dEidrByR
+              = weight * r6iv
+                * (model.twentyFourEpsilonSigma6_2D_[iSpecies][jSpecies]
+                   - model.fortyEightEpsilonSigma12_2D_[iSpecies][jSpecies]
+                         * r6iv)
+                * r2iv;
+
+          if (mem.isComputeForces)
+          {
+            for (int k = 0; k < DIMENSION; ++k)
+            {
+              double const contrib = dEidrByR * r_ij[k];
+              mem.forces[i][k] += contrib;
+              mem.forces[j][k] -= contrib;
+            }
+          }
+
+          if (mem.isComputeVirial || mem.isComputeParticleVirial)
+          {
+            double const rij = sqrt(rij2);
+            double const dEidr = dEidrByR * rij;
+            if (mem.isComputeVirial)
+            { ProcessVirialTerm(dEidr, rij, r_ij, i, j, *mem.virial); }
+            if (mem.isComputeParticleVirial)
+            {
+              ProcessParticleVirialTerm(
+                  dEidr, rij, r_ij, i, j, mem.particleVirial);
+            }
+          }
+        }
+      }  // loop over members
+    }  // loop over neighbors
+  }  // loop over contributing particles
+
+  // everything is good
+  ier = false;
+  return ier;
+}
+
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelCompute
+//
+int LennardJones612Implementation::ComputeSparseHessian(
+    KIM::ModelCompute const * const modelCompute,
+    KIM::ModelComputeArguments const * const modelComputeArguments,
+    const int * const particleSpeciesCodes,
+    const int * const particleContributing,
+    const VectorOfSizeDIM * const coordinates,
+    SparseHessian const & hessian) const
+{
+  int ier = false;
+
+  int const numberOfBlocks = hessian.rowOffsets[cachedNumberOfParticles_];
+  for (int k = 0; k < DIMENSION * DIMENSION * numberOfBlocks; ++k)
+    hessian.blocks[k] = 0.0;
+
+  int useDisplacements = false;
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+      &useDisplacements);
+  int neighborOffset = 0;
+  modelComputeArguments->GetNeighborNumberingOffset(&neighborOffset);
+
+  for (int i = 0; i < cachedNumberOfParticles_; ++i)
+  {
+    if (!particleContributing[i]) continue;
+
+    int numNei = 0;
+    int const * n1Atom = NULL;
+    double const * n1Dx = NULL;
+    double const * n1R2 = NULL;
+    if (useDisplacements)
+    {
+      ier = modelComputeArguments->GetNeighborListWithDisplacements(
+          0, i, &numNei, &n1Atom, &n1Dx, &n1R2);
+      if (ier)
+      {
+        LOG_ERROR("GetNeighborListWithDisplacements");
+        return ier;
+      }
+    }
+    else { modelComputeArguments->GetNeighborList(0, i, &numNei, &n1Atom); }
+    int const iSpecies = particleSpeciesCodes[i];
+
+    for (int jj = 0; jj < numNei; ++jj)
+    {
+      int const j = n1Atom[jj] + neighborOffset;
+      int const jContrib = particleContributing[j];
+      if (jContrib && (j < i)) continue;  // effective half-list
+
+      int const jSpecies = particleSpeciesCodes[j];
+      double r_ij[DIMENSION];
+      for (int k = 0; k < DIMENSION; ++k)
+      {
+        r_ij[k] = (n1Dx != NULL) ? n1Dx[DIMENSION * jj + k]
+                                 : coordinates[j][k] - coordinates[i][k];
+      }
+      double const rij2
+          = r_ij[0] * r_ij[0] + r_ij[1] * r_ij[1] + r_ij[2] * r_ij[2];
+      if (rij2 > cutoffsSq2D_[iSpecies][jSpecies]) continue;
+
+      double const r2iv = 1.0 / rij2;
+      double const r6iv = r2iv * r2iv * r2iv;
+      double const dphiByR
+          = r6iv
+            * (twentyFourEpsilonSigma6_2D_[iSpecies][jSpecies]
+               - fortyEightEpsilonSigma12_2D_[iSpecies][jSpecies] * r6iv)
+            * r2iv;
+      double const d2phi
+          = r6iv
+            * (sixTwentyFourEpsilonSigma12_2D_[iSpecies][jSpecies] * r6iv
+               - oneSixtyEightEpsilonSigma6_2D_[iSpecies][jSpecies])
+            * r2iv;
+      // pairs with a non-contributing particle add half their energy
+      double const weight = (jContrib == 1) ? 1.0 : 0.5;
+
+      // pair block: weight * (d2phi e e^T + dphi/r (I - e e^T)), e = r_ij/r
+      double const radial = weight * (d2phi - dphiByR) * r2iv;
+      double const tangential = weight * dphiByR;
+
+      double * const blockII = FindHessianBlock(hessian, i, i);
+      double * const blockJJ = FindHessianBlock(hessian, j, j);
+      double * const blockIJ = (i < j) ? FindHessianBlock(hessian, i, j)
+                                       : FindHessianBlock(hessian, j, i);
+      if ((blockII == NULL) || (blockJJ == NULL) || (blockIJ == NULL))
+      {
+        ier = true;
+        LOG_ERROR("hessianBlockColumnIndices is missing a block required for "
+                  "particles "
+                  + SNUM(i) + " and " + SNUM(j));
+        return ier;
+      }
+
+      for (int a = 0; a < DIMENSION; ++a)
+      {
+        for (int b = 0; b < DIMENSION; ++b)
+        {
+          double const k_ab
+              = radial * r_ij[a] * r_ij[b] + ((a == b) ? tangential : 0.0);
+          blockII[DIMENSION * a + b] += k_ab;
+          blockJJ[DIMENSION * a + b] += k_ab;
+          blockIJ[DIMENSION * a + b] -= k_ab;
+        }
+      }
+    }  // loop over neighbors
+  }  // loop over contributing particles
+
+  // everything is good
+  ier = false;
+  return ier;
+}
+
+//******************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelComputeArguments
+//
+int LennardJones612Implementation::ComputeParticleCost(
+    KIM::ModelComputeArguments const * const modelComputeArguments,
+    const int * const particleSpeciesCodes,
+    const int * const particleContributing,
+    const VectorOfSizeDIM * const coordinates,
+    double * const particleCost) const
+{
+  int ier = false;
+
+  for (int i = 0; i < cachedNumberOfParticles_; ++i) particleCost[i] = 0.0;
+
+  int useDisplacements = false;
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+      &useDisplacements);
+  int neighborOffset = 0;
+  modelComputeArguments->GetNeighborNumberingOffset(&neighborOffset);
+
+  for (int i = 0; i < cachedNumberOfParticles_; ++i)
+  {
+    if (!particleContributing[i]) continue;
+
+    int numNei = 0;
+    int const * n1Atom = NULL;
+    double const * n1Dx = NULL;
+    double const * n1R2 = NULL;
+    if (useDisplacements)
+    {
+      ier = modelComputeArguments->GetNeighborListWithDisplacements(
+          0, i, &numNei, &n1Atom, &n1Dx, &n1R2);
+      if (ier)
+      {
+        LOG_ERROR("GetNeighborListWithDisplacements");
+        return ier;
+      }
+    }
+    else { modelComputeArguments->GetNeighborList(0, i, &numNei, &n1Atom); }
+    int const iSpecies = particleSpeciesCodes[i];
+
+    for (int jj = 0; jj < numNei; ++jj)
+    {
+      int const j = n1Atom[jj] + neighborOffset;
+      int const jContrib = particleContributing[j];
+      if (jContrib && (j < i)) continue;  // effective half-list
+
+      int const jSpecies = particleSpeciesCodes[j];
+      double rij2 = 0.0;
+      if (n1R2 != NULL) { rij2 = n1R2[jj]; }
+      else
+      {
+        for (int k = 0; k < DIMENSION; ++k)
+        {
+          double const r_ijK = (n1Dx != NULL)
+                                   ? n1Dx[DIMENSION * jj + k]
+                                   : coordinates[j][k] - coordinates[i][k];
+          rij2 += r_ijK * r_ijK;
+        }
+      }
+      if (rij2 > cutoffsSq2D_[iSpecies][jSpecies]) continue;
+
+      // one pair evaluation, shared like the energy
+      if (jContrib == 1)
+      {
+        particleCost[i] += 0.5;
+        particleCost[j] += 0.5;
+      }
+      else { particleCost[i] += 1.0; }
+    }  // loop over neighbors
+  }  // loop over contributing particles
+
+  // everything is good
+  ier = false;
+  return ier;
+}
+
+//******************************************************************************
+double * LennardJones612Implementation::FindHessianBlock(
+    SparseHessian const & hessian, int const row, int const column)
+{  // the column indices of each row are sorted
+  int const * const begin = hessian.columnIndices + hessian.rowOffsets[row];
+  int const * const end = hessian.columnIndices + hessian.rowOffsets[row + 1];
+  int const * const position = std::lower_bound(begin, end, column);
+  if ((position == end) || (*position != column)) return NULL;
+
+  return hessian.blocks
+         + DIMENSION * DIMENSION * (position - hessian.columnIndices);
+}
+
 //==============================================================================
 //
 // Implementation of helper functions
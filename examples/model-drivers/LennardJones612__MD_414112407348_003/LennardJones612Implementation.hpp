@@ -28,6 +28,7 @@
 #ifndef LENNARD_JONES_612_IMPLEMENTATION_HPP_
 #define LENNARD_JONES_612_IMPLEMENTATION_HPP_
 
+#include "KIM_ComputeEnsemble.hpp"
 #include "KIM_LogMacros.hpp"
 #include "KIM_ModelDriverHeaders.hpp"
 #include <cmath>
@@ -40,11 +41,18 @@
 
 #define MAX_PARAMETER_FILES 1
 
+// the batches live on the stack of each Compute() instantiation, so keep
+// them small (about 4 KB in all)
+#define PROCESS_TERM_BATCH_SIZE 32
+
 #define PARAM_SHIFT_INDEX 0
 #define PARAM_CUTOFFS_INDEX 1
 #define PARAM_EPSILONS_INDEX 2
 #define PARAM_SIGMAS_INDEX 3
 
+// the 2D species pair tables kept in the "pairTables" shared buffer
+#define NUMBER_PAIR_TABLES 9
+
 
 //==============================================================================
 //
@@ -59,8 +67,15 @@ typedef int(GetNeighborFunction)(void const * const,
                                  int const ** const);
 // type declaration for vector of constant dimension
 typedef double VectorOfSizeDIM[DIMENSION];
+typedef float VectorOfSizeDIMFloat[DIMENSION];
 typedef double VectorOfSizeSix[6];
 
+// type declaration for structure-of-arrays coordinates
+struct CoordinateComponents
+{
+  double const * component[DIMENSION];
+};
+
 // helper routine declarations
 void AllocateAndInitialize2DArray(double **& arrayPtr,
                                   int const extentZero,
@@ -90,6 +105,8 @@ class LennardJones612Implementation
   int Refresh(KIM::ModelRefresh * const modelRefresh);
   int Compute(KIM::ModelCompute const * const modelCompute,
               KIM::ModelComputeArguments const * const modelComputeArguments);
+  int ComputeEnsemble(KIM::ComputeEnsemble const * const ensemble,
+                      LennardJones612Implementation * const * const members);
   int ComputeArgumentsCreate(KIM::ModelComputeArgumentsCreate * const
                                  modelComputeArgumentsCreate) const;
   int ComputeArgumentsDestroy(KIM::ModelComputeArgumentsDestroy * const
@@ -136,6 +153,7 @@ class LennardJones612Implementation
   // LennardJones612Implementation: values (changed only by Refresh())
   double influenceDistance_;
   double ** cutoffsSq2D_;
+  double ** speciesPairCutoffs2D_;
   int modelWillNotRequestNeighborsOfNoncontributingParticles_;
   double ** fourEpsilonSigma6_2D_;
   double ** fourEpsilonSigma12_2D_;
@@ -144,6 +162,8 @@ class LennardJones612Implementation
   double ** oneSixtyEightEpsilonSigma6_2D_;
   double ** sixTwentyFourEpsilonSigma12_2D_;
   double ** shifts2D_;
+  // true while the 2D tables above live in the "pairTables" shared buffer
+  bool sharedPairTables_;
 
 
   // Mutable values that can change with each call to Refresh() and Compute()
@@ -152,6 +172,11 @@ class LennardJones612Implementation
   //
   // LennardJones612Implementation: values that change
   int cachedNumberOfParticles_;
+  // interleaved double-precision copies of the coordinatesFloat and
+  // coordinatesX/Y/Z arguments, and accumulator for the partialForcesFloat
+  // and partialForcesX/Y/Z arguments
+  std::vector<double> coordinatesCopy_;
+  std::vector<double> forcesAccumulator_;
 
 
   // Helper methods
@@ -189,13 +214,41 @@ class LennardJones612Implementation
   int RegisterKIMParameters(KIM::ModelDriverCreate * const modelDriverCreate);
   int RegisterKIMFunctions(
       KIM::ModelDriverCreate * const modelDriverCreate) const;
+  void GetPairTables(double *** tables[NUMBER_PAIR_TABLES]);
+  int SharePairTables(KIM::ModelDriverCreate * const modelDriverCreate);
   //
   // Related to Refresh()
+  void UnsharePairTables();
   template<class ModelObj>
-  int SetRefreshMutableValues(ModelObj * const modelObj);
+  int SetRefreshMutableValues(ModelObj * const modelObj,
+                              std::vector<bool> const & updatePairs);
+  int GetChangedSpeciesPairs(KIM::ModelRefresh const * const modelRefresh,
+                             std::vector<bool> * const changedPairs) const;
 
   //
   // Related to Compute()
+  // the partialHessianBlocks compute argument and its CSR pattern
+  struct SparseHessian
+  {
+    int const * rowOffsets;
+    int const * columnIndices;
+    double * blocks;
+  };
+  static double * FindHessianBlock(SparseHessian const & hessian,
+                                   int const row,
+                                   int const column);
+  // the coordinatesFloat and partialForcesFloat compute arguments
+  struct SinglePrecisionArrays
+  {
+    VectorOfSizeDIMFloat const * coordinates;
+    VectorOfSizeDIMFloat * forces;
+  };
+  // the coordinatesX/Y/Z and partialForcesX/Y/Z compute arguments
+  struct ComponentArrays
+  {
+    CoordinateComponents coordinates;
+    double * forces[DIMENSION];
+  };
   int SetComputeMutableValues(
       KIM::ModelComputeArguments const * const modelComputeArguments,
       bool & isComputeProcess_dEdr,
@@ -212,7 +265,11 @@ class LennardJones612Implementation
       double *& particleEnergy,
       VectorOfSizeDIM *& forces,
       VectorOfSizeSix *& virial,
-      VectorOfSizeSix *& particleViral);
+      VectorOfSizeSix *& particleViral,
+      double *& particleCost,
+      SparseHessian & hessian,
+      SinglePrecisionArrays & singlePrecision,
+      ComponentArrays & components);
   int CheckParticleSpeciesCodes(KIM::ModelCompute const * const modelCompute,
                                 int const * const particleSpeciesCodes) const;
   int GetComputeIndex(const bool & isComputeProcess_dEdr,
@@ -236,6 +293,22 @@ class LennardJones612Implementation
                                  const int & j,
                                  VectorOfSizeSix * const particleVirial) const;
 
+  // one member of a ComputeEnsemble() call
+  struct EnsembleMember
+  {
+    LennardJones612Implementation const * model;
+    bool isComputeEnergy;
+    bool isComputeForces;
+    bool isComputeParticleEnergy;
+    bool isComputeVirial;
+    bool isComputeParticleVirial;
+    double * energy;
+    double * particleEnergy;
+    VectorOfSizeDIM * forces;
+    VectorOfSizeSix * virial;
+    VectorOfSizeSix * particleVirial;
+  };
+
   // compute functions
   template<bool isComputeProcess_dEdr,
            bool isComputeProcess_d2Edr2,
@@ -255,6 +328,27 @@ class LennardJones612Implementation
               double * const particleEnergy,
               VectorOfSizeSix virial,
               VectorOfSizeSix * const particleVirial) const;
+  int ComputeEnsembleMembers(
+      KIM::ModelCompute const * const modelCompute,
+      KIM::ModelComputeArguments const * const modelComputeArguments,
+      int const numberOfMembers,
+      EnsembleMember const * const members,
+      const int * const particleSpeciesCodes,
+      const int * const particleContributing,
+      const VectorOfSizeDIM * const coordinates) const;
+  int ComputeSparseHessian(
+      KIM::ModelCompute const * const modelCompute,
+      KIM::ModelComputeArguments const * const modelComputeArguments,
+      const int * const particleSpeciesCodes,
+      const int * const particleContributing,
+      const VectorOfSizeDIM * const coordinates,
+      SparseHessian const & hessian) const;
+  int ComputeParticleCost(
+      KIM::ModelComputeArguments const * const modelComputeArguments,
+      const int * const particleSpeciesCodes,
+      const int * const particleContributing,
+      const VectorOfSizeDIM * const coordinates,
+      double * const particleCost) const;
 };
 
 //==============================================================================
@@ -343,6 +437,19 @@ int LennardJones612Implementation::Compute(
   int ii = 0;
   int numnei = 0;
   int const * n1atom = NULL;
+  double const * n1dx = NULL;
+  double const * n1r2 = NULL;
+  // use the simulator's displacements, if provided, to avoid gathering the
+  // neighbor coordinates
+  int useDisplacements = false;
+  modelComputeArguments->IsCallbackPresent(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+      &useDisplacements);
+  // neighbor numbers are received untranslated (see
+  // RegisterKIMComputeArgumentsSettings), so add the offset here
+  int neighborNumberingOffset = 0;
+  modelComputeArguments->GetNeighborNumberingOffset(&neighborNumberingOffset);
+  int const neighborOffset = neighborNumberingOffset;
   double const * const * const constCutoffsSq2D = cutoffsSq2D_;
   double const * const * const constFourEpsSig6_2D = fourEpsilonSigma6_2D_;
   double const * const * const constFourEpsSig12_2D = fourEpsilonSigma12_2D_;
@@ -355,37 +462,73 @@ int LennardJones612Implementation::Compute(
   double const * const * const constSixTwentyFourEpsSig12_2D
       = sixTwentyFourEpsilonSigma12_2D_;
   double const * const * const constShifts2D = shifts2D_;
+  // process terms are collected and passed to the simulator in batches
+  int numberOf_dEdrTerms = 0;
+  double dEdrBatchDe[PROCESS_TERM_BATCH_SIZE];
+  double dEdrBatchR[PROCESS_TERM_BATCH_SIZE];
+  double dEdrBatchDx[DIMENSION * PROCESS_TERM_BATCH_SIZE];
+  int dEdrBatchI[PROCESS_TERM_BATCH_SIZE];
+  int dEdrBatchJ[PROCESS_TERM_BATCH_SIZE];
+  int numberOf_d2Edr2Terms = 0;
+  double d2Edr2BatchDe[PROCESS_TERM_BATCH_SIZE];
+  double d2Edr2BatchR[2 * PROCESS_TERM_BATCH_SIZE];
+  double d2Edr2BatchDx[2 * DIMENSION * PROCESS_TERM_BATCH_SIZE];
+  int d2Edr2BatchI[2 * PROCESS_TERM_BATCH_SIZE];
+  int d2Edr2BatchJ[2 * PROCESS_TERM_BATCH_SIZE];
   for (ii = 0; ii < cachedNumberOfParticles_; ++ii)
   {
     if (particleContributing[ii])
     {
-      modelComputeArguments->GetNeighborList(0, ii, &numnei, &n1atom);
+      if (useDisplacements)
+      {
+        ier = modelComputeArguments->GetNeighborListWithDisplacements(
+            0, ii, &numnei, &n1atom, &n1dx, &n1r2);
+        if (ier)
+        {
+          LOG_ERROR("GetNeighborListWithDisplacements");
+          return ier;
+        }
+      }
+      else
+      {
+        modelComputeArguments->GetNeighborList(0, ii, &numnei, &n1atom);
+      }
       int const numNei = numnei;
       int const * const n1Atom = n1atom;
+      double const * const n1Dx = n1dx;
+      double const * const n1R2 = n1r2;
       int const i = ii;
       int const iSpecies = particleSpeciesCodes[i];
 
       // Setup loop over neighbors of current particle
       for (int jj = 0; jj < numNei; ++jj)
       {
-        int const j = n1Atom[jj];
+        int const j = n1Atom[jj] + neighborOffset;
         int const jContrib = particleContributing[j];
 
         if (!(jContrib && (j < i)))  // effective half-list
         {
           int const jSpecies = particleSpeciesCodes[j];
-          double * r_ij;
           double r_ijValue[DIMENSION];
-          // Compute r_ij
-          r_ij = r_ijValue;
-          for (int k = 0; k < DIMENSION; ++k)
-            r_ij[k] = coordinates[j][k] - coordinates[i][k];
-          double const * const r_ij_const = const_cast<double *>(r_ij);
+          double const * r_ij;
+          if (n1Dx != NULL)
+          {  // Use r_ij provided by the simulator
+            r_ij = &n1Dx[DIMENSION * jj];
+          }
+          else
+          {  // Compute r_ij
+            for (int k = 0; k < DIMENSION; ++k)
+              r_ijValue[k] = coordinates[j][k] - coordinates[i][k];
+            r_ij = r_ijValue;
+          }
+          double const * const r_ij_const = r_ij;
 
           // compute distance squared
-          double const rij2 = r_ij_const[0] * r_ij_const[0]
-                              + r_ij_const[1] * r_ij_const[1]
-                              + r_ij_const[2] * r_ij_const[2];
+          double const rij2 = (n1R2 != NULL)
+                                  ? n1R2[jj]
+                                  : (r_ij_const[0] * r_ij_const[0]
+                                     + r_ij_const[1] * r_ij_const[1]
+                                     + r_ij_const[2] * r_ij_const[2]);
 
           if (rij2 <= constCutoffsSq2D[iSpecies][jSpecies])
           {  // compute contribution to energy, force, etc.
@@ -465,12 +608,30 @@ int LennardJones612Implementation::Compute(
 
               if (isComputeProcess_dEdr == true)
               {
-                ier = modelComputeArguments->ProcessDEDrTerm(
-                    dEidr, rij, r_ij_const, i, j);
-                if (ier)
+                int const n = numberOf_dEdrTerms;
+                dEdrBatchDe[n] = dEidr;
+                dEdrBatchR[n] = rij;
+                for (int k = 0; k < DIMENSION; ++k)
+                  dEdrBatchDx[DIMENSION * n + k] = r_ij_const[k];
+                dEdrBatchI[n] = i;
+                dEdrBatchJ[n] = j;
+                ++numberOf_dEdrTerms;
+
+                if (numberOf_dEdrTerms == PROCESS_TERM_BATCH_SIZE)
                 {
-                  LOG_ERROR("process_dEdr");
-                  return ier;
+                  ier = modelComputeArguments->ProcessDEDrTermBatch(
+                      numberOf_dEdrTerms,
+                      dEdrBatchDe,
+                      dEdrBatchR,
+                      dEdrBatchDx,
+                      dEdrBatchI,
+                      dEdrBatchJ);
+                  if (ier)
+                  {
+                    LOG_ERROR("process_dEdr");
+                    return ier;
+                  }
+                  numberOf_dEdrTerms = 0;
                 }
               }
 
@@ -490,26 +651,33 @@ int LennardJones612Implementation::Compute(
             if (isComputeProcess_d2Edr2 == true)
             {
               double const rij = sqrt(rij2);
-              double const R_pairs[2] = {rij, rij};
-              double const * const pRs = &R_pairs[0];
-              double const Rij_pairs[6] = {r_ij_const[0],
-                                           r_ij_const[1],
-                                           r_ij_const[2],
-                                           r_ij_const[0],
-                                           r_ij_const[1],
-                                           r_ij_const[2]};
-              double const * const pRijConsts = &Rij_pairs[0];
-              int const i_pairs[2] = {i, i};
-              int const j_pairs[2] = {j, j};
-              int const * const pis = &i_pairs[0];
-              int const * const pjs = &j_pairs[0];
-
-              ier = modelComputeArguments->ProcessD2EDr2Term(
-                  d2Eidr2, pRs, pRijConsts, pis, pjs);
-              if (ier)
+              int const n = numberOf_d2Edr2Terms;
+              d2Edr2BatchDe[n] = d2Eidr2;
+              for (int p = 0; p < 2; ++p)
               {
-                LOG_ERROR("process_d2Edr2");
-                return ier;
+                d2Edr2BatchR[2 * n + p] = rij;
+                for (int k = 0; k < DIMENSION; ++k)
+                  d2Edr2BatchDx[DIMENSION * (2 * n + p) + k] = r_ij_const[k];
+                d2Edr2BatchI[2 * n + p] = i;
+                d2Edr2BatchJ[2 * n + p] = j;
+              }
+              ++numberOf_d2Edr2Terms;
+
+              if (numberOf_d2Edr2Terms == PROCESS_TERM_BATCH_SIZE)
+              {
+                ier = modelComputeArguments->ProcessD2EDr2TermBatch(
+                    numberOf_d2Edr2Terms,
+                    d2Edr2BatchDe,
+                    d2Edr2BatchR,
+                    d2Edr2BatchDx,
+                    d2Edr2BatchI,
+                    d2Edr2BatchJ);
+                if (ier)
+                {
+                  LOG_ERROR("process_d2Edr2");
+                  return ier;
+                }
+                numberOf_d2Edr2Terms = 0;
               }
             }
           }  // if particleContributing
@@ -518,6 +686,36 @@ int LennardJones612Implementation::Compute(
     }  // end of first neighbor loop
   }  // end of loop over contributing particles
 
+  // pass on the remaining process terms
+  if ((isComputeProcess_dEdr == true) && (numberOf_dEdrTerms > 0))
+  {
+    ier = modelComputeArguments->ProcessDEDrTermBatch(numberOf_dEdrTerms,
+                                                      dEdrBatchDe,
+                                                      dEdrBatchR,
+                                                      dEdrBatchDx,
+                                                      dEdrBatchI,
+                                                      dEdrBatchJ);
+    if (ier)
+    {
+      LOG_ERROR("process_dEdr");
+      return ier;
+    }
+  }
+  if ((isComputeProcess_d2Edr2 == true) && (numberOf_d2Edr2Terms > 0))
+  {
+    ier = modelComputeArguments->ProcessD2EDr2TermBatch(numberOf_d2Edr2Terms,
+                                                        d2Edr2BatchDe,
+                                                        d2Edr2BatchR,
+                                                        d2Edr2BatchDx,
+                                                        d2Edr2BatchI,
+                                                        d2Edr2BatchJ);
+    if (ier)
+    {
+      LOG_ERROR("process_d2Edr2");
+      return ier;
+    }
+  }
+
   // everything is good
   ier = false;
   return ier;
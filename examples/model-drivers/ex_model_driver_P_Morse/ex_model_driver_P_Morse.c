@@ -200,6 +200,7 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
   int comp_energy;
   int comp_force;
   int comp_particleEnergy;
+  int comp_particleCost;
 
   int * nParts;
   int * particleSpeciesCodes;
@@ -214,6 +215,7 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
   double * energy;
   double * force;
   double * particleEnergy;
+  double * particleCost;
   int numOfPartNeigh;
 
   /* get buffer from KIM object */
@@ -254,7 +256,11 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
         || KIM_ModelComputeArguments_GetArgumentPointerDouble(
             modelComputeArguments,
             KIM_COMPUTE_ARGUMENT_NAME_partialParticleEnergy,
-            &particleEnergy);
+            &particleEnergy)
+        || KIM_ModelComputeArguments_GetArgumentPointerDouble(
+            modelComputeArguments,
+            KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost,
+            &particleCost);
   if (ier)
   {
     LOG_ERROR("GetArgumentPointer");
@@ -264,6 +270,7 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
   comp_energy = (energy != NULL);
   comp_force = (force != NULL);
   comp_particleEnergy = (particleEnergy != NULL);
+  comp_particleCost = (particleCost != NULL);
 
   /* Check to be sure that the species are correct */
   /**/
@@ -285,6 +292,12 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
   }
   if (comp_energy) { *energy = 0.0; }
 
+  /* cost is the number of pair evaluations within the cutoff */
+  if (comp_particleCost)
+  {
+    for (i = 0; i < *nParts; ++i) { particleCost[i] = 0.0; }
+  }
+
   if (comp_force)
   {
     for (i = 0; i < *nParts; ++i)
@@ -349,6 +362,7 @@ compute_routine(KIM_ModelCompute const * const modelCompute,
           /* contribution to energy */
           if (comp_particleEnergy) { particleEnergy[i] += 0.5 * phi; }
           if (comp_energy) { *energy += 0.5 * phi; }
+          if (comp_particleCost) { particleCost[i] += 1.0; }
 
           /* contribution to forces */
           if (comp_force)
@@ -692,6 +706,10 @@ static int compute_arguments_create(
             modelComputeArgumentsCreate,
             KIM_COMPUTE_ARGUMENT_NAME_partialParticleEnergy,
             KIM_SUPPORT_STATUS_optional)
+        || KIM_ModelComputeArgumentsCreate_SetArgumentSupportStatus(
+            modelComputeArgumentsCreate,
+            KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost,
+            KIM_SUPPORT_STATUS_optional)
         || KIM_ModelComputeArgumentsCreate_SetArgumentSupportStatus(
             modelComputeArgumentsCreate,
             KIM_COMPUTE_ARGUMENT_NAME_partialForces,
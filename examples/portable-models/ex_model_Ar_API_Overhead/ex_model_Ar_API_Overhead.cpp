@@ -0,0 +1,308 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include "KIM_LogMacros.hpp"
+#include "KIM_ModelHeaders.hpp"
+#include <cstddef>
+
+#define DIMENSION 3
+
+// Values of the "operation" parameter; shared by all API-overhead models
+#define OPERATION_NONE 0
+#define OPERATION_GET_NEIGHBOR_LIST 1
+#define OPERATION_GET_ARGUMENT_POINTER 2
+#define OPERATION_PROCESS_DEDR_TERM 3
+#define OPERATION_LOG_ENTRY 4
+#define NUMBER_OF_OPERATIONS 5
+
+
+namespace
+{
+//******************************************************************************
+// A model that computes nothing.  Each Compute() call performs the KIM-API
+// operation selected by the "operation" parameter "repetitions" times, so
+// that a simulator can time the cost the API itself adds to a model.
+class ex_model_Ar_API_Overhead
+{
+ public:
+  //****************************************************************************
+  ex_model_Ar_API_Overhead(KIM::ModelCreate * const modelCreate,
+                           int * const error) :
+      operation_(OPERATION_NONE),
+      repetitions_(1),
+      influenceDistance_(4.0),
+      cutoff_(influenceDistance_),
+      modelWillNotRequestNeighborsOfNoncontributingParticles_(1)
+  {
+    *error = modelCreate->SetUnits(KIM::LENGTH_UNIT::A,
+                                   KIM::ENERGY_UNIT::eV,
+                                   KIM::CHARGE_UNIT::unused,
+                                   KIM::TEMPERATURE_UNIT::unused,
+                                   KIM::TIME_UNIT::unused)
+             || modelCreate->SetModelNumbering(KIM::NUMBERING::zeroBased)
+             || modelCreate->SetSpeciesCode(KIM::SPECIES_NAME::Ar, 0);
+    if (*error) return;
+
+    modelCreate->SetInfluenceDistancePointer(&influenceDistance_);
+    modelCreate->SetNeighborListPointers(
+        1, &cutoff_, &modelWillNotRequestNeighborsOfNoncontributingParticles_);
+
+    *error = modelCreate->SetParameterPointer(
+                 1,
+                 &operation_,
+                 "operation",
+                 "KIM-API operation performed by Compute(): 0 none, "
+                 "1 GetNeighborList, 2 GetArgumentPointer, "
+                 "3 ProcessDEDrTerm, 4 LogEntry")
+             || modelCreate->SetParameterPointer(
+                 1,
+                 &repetitions_,
+                 "repetitions",
+                 "Number of times the operation is performed per Compute()");
+    if (*error) return;
+
+    // use function pointer declarations to verify prototypes
+    KIM::ModelComputeArgumentsCreateFunction * CACreate
+        = ex_model_Ar_API_Overhead::ComputeArgumentsCreate;
+    KIM::ModelComputeFunction * compute = ex_model_Ar_API_Overhead::Compute;
+    KIM::ModelRefreshFunction * refresh = ex_model_Ar_API_Overhead::Refresh;
+    KIM::ModelComputeArgumentsDestroyFunction * CADestroy
+        = ex_model_Ar_API_Overhead::ComputeArgumentsDestroy;
+    KIM::ModelDestroyFunction * destroy = ex_model_Ar_API_Overhead::Destroy;
+
+    *error = modelCreate->SetRoutinePointer(
+                 KIM::MODEL_ROUTINE_NAME::ComputeArgumentsCreate,
+                 KIM::LANGUAGE_NAME::cpp,
+                 true,
+                 reinterpret_cast<KIM::Function *>(CACreate))
+             || modelCreate->SetRoutinePointer(
+                 KIM::MODEL_ROUTINE_NAME::Compute,
+                 KIM::LANGUAGE_NAME::cpp,
+                 true,
+                 reinterpret_cast<KIM::Function *>(compute))
+             || modelCreate->SetRoutinePointer(
+                 KIM::MODEL_ROUTINE_NAME::Refresh,
+                 KIM::LANGUAGE_NAME::cpp,
+                 true,
+                 reinterpret_cast<KIM::Function *>(refresh))
+             || modelCreate->SetRoutinePointer(
+                 KIM::MODEL_ROUTINE_NAME::ComputeArgumentsDestroy,
+                 KIM::LANGUAGE_NAME::cpp,
+                 true,
+                 reinterpret_cast<KIM::Function *>(CADestroy))
+             || modelCreate->SetRoutinePointer(
+                 KIM::MODEL_ROUTINE_NAME::Destroy,
+                 KIM::LANGUAGE_NAME::cpp,
+                 true,
+                 reinterpret_cast<KIM::Function *>(destroy));
+  };
+
+  //****************************************************************************
+  ~ex_model_Ar_API_Overhead() {};
+
+  //****************************************************************************
+  static int Destroy(KIM::ModelDestroy * const modelDestroy)
+  {
+    ex_model_Ar_API_Overhead * model;
+    modelDestroy->GetModelBufferPointer(reinterpret_cast<void **>(&model));
+
+    if (model != NULL) { delete model; }
+
+    return false;
+  }
+
+  //****************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelRefresh
+  //
+  static int Refresh(KIM::ModelRefresh * const modelRefresh)
+  {
+    ex_model_Ar_API_Overhead * model;
+    modelRefresh->GetModelBufferPointer(reinterpret_cast<void **>(&model));
+
+    if ((model->operation_ < 0) || (model->operation_ >= NUMBER_OF_OPERATIONS)
+        || (model->repetitions_ < 1))
+    {
+      LOG_ERROR("Invalid operation or repetitions parameter");
+      return true;
+    }
+
+    modelRefresh->SetInfluenceDistancePointer(&model->influenceDistance_);
+    modelRefresh->SetNeighborListPointers(
+        1,
+        &model->cutoff_,
+        &model->modelWillNotRequestNeighborsOfNoncontributingParticles_);
+
+    return false;
+  }
+
+  //****************************************************************************
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelComputeArguments
+  //
+  static int
+  Compute(KIM::ModelCompute const * const modelCompute,
+          KIM::ModelComputeArguments const * const modelComputeArguments)
+  {
+    ex_model_Ar_API_Overhead * model;
+    modelCompute->GetModelBufferPointer(reinterpret_cast<void **>(&model));
+
+    int const * numberOfParticles;
+    double * partialEnergy;
+    int error = modelComputeArguments->GetArgumentPointer(
+                    KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                    &numberOfParticles)
+                || modelComputeArguments->GetArgumentPointer(
+                    KIM::COMPUTE_ARGUMENT_NAME::partialEnergy,
+                    &partialEnergy);
+    if (error)
+    {
+      LOG_ERROR("Unable to get argument pointers");
+      return error;
+    }
+    if (partialEnergy != NULL) *partialEnergy = 0.0;
+    if (*numberOfParticles < 1) return false;
+
+    int const repetitions = model->repetitions_;
+    switch (model->operation_)
+    {
+      case OPERATION_GET_NEIGHBOR_LIST:
+      {
+        int numberOfNeighbors;
+        int const * neighbors;
+        for (int n = 0; n < repetitions; ++n)
+        {
+          error = modelComputeArguments->GetNeighborList(
+              0, n % *numberOfParticles, &numberOfNeighbors, &neighbors);
+          if (error) break;
+        }
+        break;
+      }
+      case OPERATION_GET_ARGUMENT_POINTER:
+      {
+        double const * coordinates;
+        for (int n = 0; n < repetitions; ++n)
+        {
+          error = modelComputeArguments->GetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::coordinates, &coordinates);
+          if (error) break;
+        }
+        break;
+      }
+      case OPERATION_PROCESS_DEDR_TERM:
+      {
+        double const dx[DIMENSION] = {1.0, 0.0, 0.0};
+        int const j = (*numberOfParticles > 1) ? 1 : 0;
+        for (int n = 0; n < repetitions; ++n)
+        {
+          error = modelComputeArguments->ProcessDEDrTerm(1.0, 1.0, dx, 0, j);
+          if (error) break;
+        }
+        break;
+      }
+      case OPERATION_LOG_ENTRY:
+      {
+        // debug entries are filtered out by the simulator's verbosity, so
+        // this times the dispatch rather than the formatting of the entry
+        for (int n = 0; n < repetitions; ++n)
+        {
+          modelComputeArguments->LogEntry(
+              KIM::LOG_VERBOSITY::debug, "overhead", __LINE__, __FILE__);
+        }
+        break;
+      }
+      default: break;
+    }
+    if (error) LOG_ERROR("KIM-API operation failed");
+
+    return error;
+  };
+
+  //****************************************************************************
+  static int ComputeArgumentsCreate(
+      KIM::ModelCompute const * const /* modelCompute */,
+      KIM::ModelComputeArgumentsCreate * const modelComputeArgumentsCreate)
+  {
+    return modelComputeArgumentsCreate->SetArgumentSupportStatus(
+               KIM::COMPUTE_ARGUMENT_NAME::partialEnergy,
+               KIM::SUPPORT_STATUS::optional)
+           || modelComputeArgumentsCreate->SetCallbackSupportStatus(
+               KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTerm,
+               KIM::SUPPORT_STATUS::optional);
+  }
+
+  //****************************************************************************
+  static int
+  ComputeArgumentsDestroy(KIM::ModelCompute const * const /* modelCompute */,
+                          KIM::ModelComputeArgumentsDestroy * const
+                          /* modelComputeArgumentsDestroy */)
+  {
+    return false;
+  }
+
+ private:
+  //****************************************************************************
+  // Member variables
+  int operation_;
+  int repetitions_;
+  double influenceDistance_;
+  double cutoff_;
+  int const modelWillNotRequestNeighborsOfNoncontributingParticles_;
+};
+
+}  // namespace
+
+extern "C" {
+//******************************************************************************
+int model_create(KIM::ModelCreate * const modelCreate,
+                 KIM::LengthUnit const /* requestedLengthUnit */,
+                 KIM::EnergyUnit const /* requestedEnergyUnit */,
+                 KIM::ChargeUnit const /* requestedChargeUnit */,
+                 KIM::TemperatureUnit const /* requestedTemperatureUnit */,
+                 KIM::TimeUnit const /* requestedTimeUnit */)
+{
+  int error;
+
+  ex_model_Ar_API_Overhead * const model
+      = new ex_model_Ar_API_Overhead(modelCreate, &error);
+  if (error)
+  {
+    // constructor already reported the error
+    delete model;
+    return error;
+  }
+
+  // register pointer to model buffer in KIM object
+  modelCreate->SetModelBufferPointer(static_cast<void *>(model));
+
+  return false;
+}
+}  // extern "C"
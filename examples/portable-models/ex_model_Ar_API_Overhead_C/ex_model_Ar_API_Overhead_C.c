@@ -0,0 +1,381 @@
+/*                                                                            */
+/* KIM-API: An API for interatomic models                                     */
+/* Copyright (c) 2013--2022, Regents of the University of Minnesota.          */
+/* All rights reserved.                                                       */
+/*                                                                            */
+/* Contributors:                                                              */
+/*    Ryan S. Elliott                                                         */
+/*    Ellad B. Tadmor                                                         */
+/*    Stephen M. Whalen                                                       */
+/*                                                                            */
+/* SPDX-License-Identifier: LGPL-2.1-or-later                                 */
+/*                                                                            */
+/* This library is free software; you can redistribute it and/or              */
+/* modify it under the terms of the GNU Lesser General Public                 */
+/* License as published by the Free Software Foundation; either               */
+/* version 2.1 of the License, or (at your option) any later version.         */
+/*                                                                            */
+/* This library is distributed in the hope that it will be useful,            */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of             */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU          */
+/* Lesser General Public License for more details.                            */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with this library; if not, write to the Free Software Foundation,    */
+/* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA         */
+
+/*                                                                            */
+/* Release: This file is part of the kim-api-2.4.1 package.                   */
+/*                                                                            */
+
+/******************************************************************************/
+/*                                                                            */
+/* ex_model_Ar_API_Overhead_C  KIM-API overhead measurement Model             */
+/*                                                                            */
+/* Each Compute() call performs the KIM-API operation selected by the         */
+/* "operation" parameter "repetitions" times and computes nothing else.       */
+/*                                                                            */
+/* Language: C                                                                */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include "KIM_LogMacros.h"
+#include "KIM_ModelHeaders.h"
+#include <stdlib.h>
+
+#define TRUE 1
+#define FALSE 0
+
+#define DIM 3 /* dimensionality of space */
+#define SPECCODE 1 /* internal species code */
+#define CUTOFF 4.0 /* Angstroms */
+
+/* Values of the "operation" parameter */
+#define OPERATION_NONE 0
+#define OPERATION_GET_NEIGHBOR_LIST 1
+#define OPERATION_GET_ARGUMENT_POINTER 2
+#define OPERATION_PROCESS_DEDR_TERM 3
+#define OPERATION_LOG_ENTRY 4
+#define NUMBER_OF_OPERATIONS 5
+
+/* Model buffer definition */
+struct buffer
+{
+  int operation;
+  int repetitions;
+  double influenceDistance;
+  double cutoff;
+  int modelWillNotRequestNeighborsOfNoncontributingParticles;
+};
+typedef struct buffer buffer;
+
+/* Define prototype for Model create */
+int model_create(KIM_ModelCreate * const modelCreate,
+                 KIM_LengthUnit const requestedLengthUnit,
+                 KIM_EnergyUnit const requestedEnergyUnit,
+                 KIM_ChargeUnit const requestedChargeUnit,
+                 KIM_TemperatureUnit const requestedTemperatureUnit,
+                 KIM_TimeUnit const requestedTimeUnit);
+
+/* Define prototype for other routines */
+
+static int compute_arguments_create(
+    KIM_ModelCompute const * const modelCompute,
+    KIM_ModelComputeArgumentsCreate * const modelComputeArgumentsCreate);
+static int
+model_compute(KIM_ModelCompute const * const modelCompute,
+              KIM_ModelComputeArguments const * const modelComputeArguments);
+static int model_refresh(KIM_ModelRefresh * const modelRefresh);
+static int compute_arguments_destroy(
+    KIM_ModelCompute const * const modelCompute,
+    KIM_ModelComputeArgumentsDestroy * const modelComputeArgumentsDestroy);
+static int model_destroy(KIM_ModelDestroy * const modelDestroy);
+
+/* compute function */
+#undef KIM_LOGGER_FUNCTION_NAME
+#define KIM_LOGGER_FUNCTION_NAME KIM_ModelComputeArguments_LogEntry
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelComputeArguments
+/**/
+static int
+model_compute(KIM_ModelCompute const * const modelCompute,
+              KIM_ModelComputeArguments const * const modelComputeArguments)
+{
+  buffer * bufferPointer;
+  int const * numberOfParticles;
+  double * partialEnergy;
+  double const dx[DIM] = {1.0, 0.0, 0.0};
+  double const * coordinates;
+  int numberOfNeighbors;
+  int const * neighbors;
+  int n;
+  int error;
+
+  KIM_ModelCompute_GetModelBufferPointer(modelCompute,
+                                         (void **) &bufferPointer);
+
+  error = KIM_ModelComputeArguments_GetArgumentPointerInteger(
+              modelComputeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_numberOfParticles,
+              (int **) &numberOfParticles)
+          || KIM_ModelComputeArguments_GetArgumentPointerDouble(
+              modelComputeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_partialEnergy,
+              &partialEnergy);
+  if (error)
+  {
+    LOG_ERROR("Unable to get argument pointers");
+    return error;
+  }
+  if (partialEnergy != NULL) *partialEnergy = 0.0;
+  if (*numberOfParticles < 1) return FALSE;
+
+  switch (bufferPointer->operation)
+  {
+    case OPERATION_GET_NEIGHBOR_LIST:
+      for (n = 0; (n < bufferPointer->repetitions) && (!error); ++n)
+      {
+        error = KIM_ModelComputeArguments_GetNeighborList(
+            modelComputeArguments,
+            0,
+            n % *numberOfParticles,
+            &numberOfNeighbors,
+            &neighbors);
+      }
+      break;
+    case OPERATION_GET_ARGUMENT_POINTER:
+      for (n = 0; (n < bufferPointer->repetitions) && (!error); ++n)
+      {
+        error = KIM_ModelComputeArguments_GetArgumentPointerDouble(
+            modelComputeArguments,
+            KIM_COMPUTE_ARGUMENT_NAME_coordinates,
+            (double **) &coordinates);
+      }
+      break;
+    case OPERATION_PROCESS_DEDR_TERM:
+      for (n = 0; (n < bufferPointer->repetitions) && (!error); ++n)
+      {
+        error = KIM_ModelComputeArguments_ProcessDEDrTerm(
+            modelComputeArguments,
+            1.0,
+            1.0,
+            dx,
+            0,
+            (*numberOfParticles > 1) ? 1 : 0);
+      }
+      break;
+    case OPERATION_LOG_ENTRY:
+      /* debug entries are filtered out by the simulator's verbosity */
+      for (n = 0; n < bufferPointer->repetitions; ++n)
+      {
+        KIM_ModelComputeArguments_LogEntry(modelComputeArguments,
+                                           KIM_LOG_VERBOSITY_debug,
+                                           "overhead",
+                                           __LINE__,
+                                           __FILE__);
+      }
+      break;
+    default:
+      break;
+  }
+  if (error) LOG_ERROR("KIM-API operation failed");
+
+  return error;
+}
+
+/* Create function */
+#undef KIM_LOGGER_FUNCTION_NAME
+#define KIM_LOGGER_FUNCTION_NAME KIM_ModelCreate_LogEntry
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelCreate
+/**/
+int model_create(KIM_ModelCreate * const modelCreate,
+                 KIM_LengthUnit const requestedLengthUnit,
+                 KIM_EnergyUnit const requestedEnergyUnit,
+                 KIM_ChargeUnit const requestedChargeUnit,
+                 KIM_TemperatureUnit const requestedTemperatureUnit,
+                 KIM_TimeUnit const requestedTimeUnit)
+{
+  buffer * bufferPointer;
+  int error;
+
+  /* use function pointer definitions to verify prototypes */
+  KIM_ModelCreateFunction * create = model_create;
+  KIM_ModelComputeArgumentsCreateFunction * CACreate = compute_arguments_create;
+  KIM_ModelComputeFunction * compute = model_compute;
+  KIM_ModelRefreshFunction * refresh = model_refresh;
+  KIM_ModelComputeArgumentsDestroyFunction * CADestroy
+      = compute_arguments_destroy;
+  KIM_ModelDestroyFunction * destroy = model_destroy;
+
+  (void) create; /* avoid unused parameter warnings */
+  (void) requestedLengthUnit;
+  (void) requestedEnergyUnit;
+  (void) requestedChargeUnit;
+  (void) requestedTemperatureUnit;
+  (void) requestedTimeUnit;
+
+  error = KIM_ModelCreate_SetUnits(modelCreate, /* ignoring requested units */
+                                   KIM_LENGTH_UNIT_A,
+                                   KIM_ENERGY_UNIT_eV,
+                                   KIM_CHARGE_UNIT_unused,
+                                   KIM_TEMPERATURE_UNIT_unused,
+                                   KIM_TIME_UNIT_unused)
+          || KIM_ModelCreate_SetSpeciesCode(
+              modelCreate, KIM_SPECIES_NAME_Ar, SPECCODE)
+          || KIM_ModelCreate_SetModelNumbering(modelCreate,
+                                               KIM_NUMBERING_zeroBased);
+
+  /* register function pointers */
+  error = error
+          || KIM_ModelCreate_SetRoutinePointer(
+              modelCreate,
+              KIM_MODEL_ROUTINE_NAME_ComputeArgumentsCreate,
+              KIM_LANGUAGE_NAME_c,
+              TRUE,
+              (KIM_Function *) CACreate)
+          || KIM_ModelCreate_SetRoutinePointer(modelCreate,
+                                               KIM_MODEL_ROUTINE_NAME_Compute,
+                                               KIM_LANGUAGE_NAME_c,
+                                               TRUE,
+                                               (KIM_Function *) compute)
+          || KIM_ModelCreate_SetRoutinePointer(modelCreate,
+                                               KIM_MODEL_ROUTINE_NAME_Refresh,
+                                               KIM_LANGUAGE_NAME_c,
+                                               TRUE,
+                                               (KIM_Function *) refresh)
+          || KIM_ModelCreate_SetRoutinePointer(
+              modelCreate,
+              KIM_MODEL_ROUTINE_NAME_ComputeArgumentsDestroy,
+              KIM_LANGUAGE_NAME_c,
+              TRUE,
+              (KIM_Function *) CADestroy)
+          || KIM_ModelCreate_SetRoutinePointer(modelCreate,
+                                               KIM_MODEL_ROUTINE_NAME_Destroy,
+                                               KIM_LANGUAGE_NAME_c,
+                                               TRUE,
+                                               (KIM_Function *) destroy);
+
+  /* allocate buffer */
+  bufferPointer = (buffer *) malloc(sizeof(buffer));
+  if (bufferPointer == NULL)
+  {
+    LOG_ERROR("Unable to allocate model buffer");
+    return TRUE;
+  }
+  KIM_ModelCreate_SetModelBufferPointer(modelCreate, bufferPointer);
+
+  /* set buffer values */
+  bufferPointer->operation = OPERATION_NONE;
+  bufferPointer->repetitions = 1;
+  bufferPointer->influenceDistance = CUTOFF;
+  bufferPointer->cutoff = CUTOFF;
+  bufferPointer->modelWillNotRequestNeighborsOfNoncontributingParticles = 1;
+
+  KIM_ModelCreate_SetInfluenceDistancePointer(
+      modelCreate, &(bufferPointer->influenceDistance));
+  KIM_ModelCreate_SetNeighborListPointers(
+      modelCreate,
+      1,
+      &(bufferPointer->cutoff),
+      &(bufferPointer->modelWillNotRequestNeighborsOfNoncontributingParticles));
+
+  /* register parameters */
+  error = error
+          || KIM_ModelCreate_SetParameterPointerInteger(
+              modelCreate,
+              1,
+              &(bufferPointer->operation),
+              "operation",
+              "KIM-API operation performed by Compute(): 0 none, "
+              "1 GetNeighborList, 2 GetArgumentPointer, "
+              "3 ProcessDEDrTerm, 4 LogEntry")
+          || KIM_ModelCreate_SetParameterPointerInteger(
+              modelCreate,
+              1,
+              &(bufferPointer->repetitions),
+              "repetitions",
+              "Number of times the operation is performed per Compute()");
+
+  if (error)
+  {
+    free(bufferPointer);
+    LOG_ERROR("Unable to successfully initialize model");
+    return TRUE;
+  }
+  else
+    return FALSE;
+}
+
+/* Refresh function */
+#undef KIM_LOGGER_FUNCTION_NAME
+#define KIM_LOGGER_FUNCTION_NAME KIM_ModelRefresh_LogEntry
+#undef KIM_LOGGER_OBJECT_NAME
+#define KIM_LOGGER_OBJECT_NAME modelRefresh
+/**/
+static int model_refresh(KIM_ModelRefresh * const modelRefresh)
+{
+  buffer * bufferPointer;
+
+  KIM_ModelRefresh_GetModelBufferPointer(modelRefresh,
+                                         (void **) &bufferPointer);
+
+  if ((bufferPointer->operation < 0)
+      || (bufferPointer->operation >= NUMBER_OF_OPERATIONS)
+      || (bufferPointer->repetitions < 1))
+  {
+    LOG_ERROR("Invalid operation or repetitions parameter");
+    return TRUE;
+  }
+
+  KIM_ModelRefresh_SetInfluenceDistancePointer(
+      modelRefresh, &(bufferPointer->influenceDistance));
+  KIM_ModelRefresh_SetNeighborListPointers(
+      modelRefresh,
+      1,
+      &(bufferPointer->cutoff),
+      &(bufferPointer->modelWillNotRequestNeighborsOfNoncontributingParticles));
+
+  return FALSE;
+}
+
+/* Destroy function */
+static int model_destroy(KIM_ModelDestroy * const modelDestroy)
+{
+  buffer * bufferPointer;
+
+  KIM_ModelDestroy_GetModelBufferPointer(modelDestroy,
+                                         (void **) &bufferPointer);
+  free(bufferPointer);
+
+  return FALSE;
+}
+
+/* compute arguments create routine */
+static int compute_arguments_create(
+    KIM_ModelCompute const * const modelCompute,
+    KIM_ModelComputeArgumentsCreate * const modelComputeArgumentsCreate)
+{
+  (void) modelCompute; /* avoid unused parameter warning */
+
+  return KIM_ModelComputeArgumentsCreate_SetArgumentSupportStatus(
+             modelComputeArgumentsCreate,
+             KIM_COMPUTE_ARGUMENT_NAME_partialEnergy,
+             KIM_SUPPORT_STATUS_optional)
+         || KIM_ModelComputeArgumentsCreate_SetCallbackSupportStatus(
+             modelComputeArgumentsCreate,
+             KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTerm,
+             KIM_SUPPORT_STATUS_optional);
+}
+
+/* compute arguments destroy routine */
+static int compute_arguments_destroy(
+    KIM_ModelCompute const * const modelCompute,
+    KIM_ModelComputeArgumentsDestroy * const modelComputeArgumentsDestroy)
+{
+  (void) modelCompute; /* avoid unused parameter warning */
+  (void) modelComputeArgumentsDestroy;
+
+  return FALSE;
+}
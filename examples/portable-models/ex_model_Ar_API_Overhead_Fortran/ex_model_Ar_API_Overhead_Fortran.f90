@@ -0,0 +1,423 @@
+!
+! KIM-API: An API for interatomic models
+! Copyright (c) 2013--2022, Regents of the University of Minnesota.
+! All rights reserved.
+!
+! Contributors:
+!    Ryan S. Elliott
+!
+! SPDX-License-Identifier: LGPL-2.1-or-later
+!
+! This library is free software; you can redistribute it and/or
+! modify it under the terms of the GNU Lesser General Public
+! License as published by the Free Software Foundation; either
+! version 2.1 of the License, or (at your option) any later version.
+!
+! This library is distributed in the hope that it will be useful,
+! but WITHOUT ANY WARRANTY; without even the implied warranty of
+! MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+! Lesser General Public License for more details.
+!
+! You should have received a copy of the GNU Lesser General Public License
+! along with this library; if not, write to the Free Software Foundation,
+! Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+!
+
+!
+! Release: This file is part of the kim-api-2.4.1 package.
+!
+
+!****************************************************************************
+!**
+!**  MODULE ex_model_Ar_API_Overhead_F03
+!**
+!**  KIM-API overhead measurement model.  Each Compute() call performs the
+!**  KIM-API operation selected by the "operation" parameter "repetitions"
+!**  times and computes nothing else.
+!**
+!**  Language: Fortran 2003
+!**
+!****************************************************************************
+
+module ex_model_Ar_API_Overhead_F03
+
+  use, intrinsic :: iso_c_binding
+  use kim_model_headers_module
+  implicit none
+
+  save
+  private
+  public model_compute, &
+    model_refresh, &
+    model_destroy_func, &
+    model_compute_arguments_create, &
+    model_compute_arguments_destroy, &
+    model_cutoff, &
+    speccode, &
+    buffer_type
+
+  integer(c_int), parameter :: cd = c_double  ! used for literal constants
+  integer(c_int), parameter :: DIM = 3  ! dimensionality of space
+  integer(c_int), parameter :: speccode = 1  ! internal species code
+  real(c_double), parameter :: model_cutoff = 4.0_cd ! cutoff radius
+  ! in angstroms
+
+  ! values of the "operation" parameter
+  integer(c_int), parameter :: operation_none = 0
+  integer(c_int), parameter :: operation_get_neighbor_list = 1
+  integer(c_int), parameter :: operation_get_argument_pointer = 2
+  integer(c_int), parameter :: operation_process_dedr_term = 3
+  integer(c_int), parameter :: operation_log_entry = 4
+  integer(c_int), parameter :: number_of_operations = 5
+
+  type, bind(c) :: buffer_type
+    integer(c_int) :: operation(1)
+    integer(c_int) :: repetitions(1)
+    real(c_double) :: influence_distance
+    real(c_double) :: cutoff(1)
+    integer(c_int) :: &
+      model_will_not_request_neighbors_of_noncontributing_particles(1)
+  end type buffer_type
+
+contains
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Perform the selected KIM-API operation
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine model_compute( &
+    model_compute_handle, model_compute_arguments_handle, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(kim_model_compute_handle_type), intent(in) :: model_compute_handle
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(out) :: ierr
+
+    !-- Local variables
+    integer(c_int) :: n, j, numnei, ierr2
+    real(c_double), parameter :: dx(DIM) = (/1.0_cd, 0.0_cd, 0.0_cd/)
+    type(buffer_type), pointer :: buf; type(c_ptr) :: pbuf
+
+    !-- KIM variables
+    integer(c_int), pointer :: number_of_particles
+    real(c_double), pointer :: energy
+    real(c_double), pointer :: coor(:, :)
+    integer(c_int), pointer :: nei1part(:)
+
+    call kim_get_model_buffer_pointer(model_compute_handle, pbuf)
+    call c_f_pointer(pbuf, buf)
+
+    ierr = 0
+    call kim_get_argument_pointer( &
+      model_compute_arguments_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_NUMBER_OF_PARTICLES, number_of_particles, &
+      ierr2)
+    ierr = ierr + ierr2
+    call kim_get_argument_pointer( &
+      model_compute_arguments_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_ENERGY, energy, ierr2)
+    ierr = ierr + ierr2
+    if (ierr /= 0) then
+      call kim_log_entry(model_compute_arguments_handle, &
+                         KIM_LOG_VERBOSITY_ERROR, "get data")
+      ierr = 1
+      return
+    end if
+    if (associated(energy)) energy = 0.0_cd
+    if (number_of_particles < 1) return
+
+    select case (buf%operation(1))
+    case (operation_get_neighbor_list)
+      do n = 1, buf%repetitions(1)
+        call kim_get_neighbor_list( &
+          model_compute_arguments_handle, 1, &
+          mod(n - 1, number_of_particles) + 1, numnei, nei1part, ierr)
+        if (ierr /= 0) exit
+      end do
+    case (operation_get_argument_pointer)
+      do n = 1, buf%repetitions(1)
+        call kim_get_argument_pointer( &
+          model_compute_arguments_handle, &
+          KIM_COMPUTE_ARGUMENT_NAME_COORDINATES, DIM, number_of_particles, &
+          coor, ierr)
+        if (ierr /= 0) exit
+      end do
+    case (operation_process_dedr_term)
+      j = min(2, number_of_particles)
+      do n = 1, buf%repetitions(1)
+        call kim_process_dedr_term( &
+          model_compute_arguments_handle, 1.0_cd, 1.0_cd, dx, 1, j, ierr)
+        if (ierr /= 0) exit
+      end do
+    case (operation_log_entry)
+      ! debug entries are filtered out by the simulator's verbosity
+      do n = 1, buf%repetitions(1)
+        call kim_log_entry(model_compute_arguments_handle, &
+                           KIM_LOG_VERBOSITY_DEBUG, "overhead")
+      end do
+    end select
+
+    if (ierr /= 0) then
+      call kim_log_entry(model_compute_arguments_handle, &
+                         KIM_LOG_VERBOSITY_ERROR, "KIM-API operation failed")
+      ierr = 1
+    end if
+    return
+
+  end subroutine model_compute
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Model refresh routine (REQUIRED, since the model has parameters)
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine model_refresh(model_refresh_handle, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(kim_model_refresh_handle_type), intent(in) :: model_refresh_handle
+    integer(c_int), intent(out) :: ierr
+
+    type(buffer_type), pointer :: buf; type(c_ptr) :: pbuf
+
+    call kim_get_model_buffer_pointer(model_refresh_handle, pbuf)
+    call c_f_pointer(pbuf, buf)
+
+    if ((buf%operation(1) < 0) &
+        .or. (buf%operation(1) >= number_of_operations) &
+        .or. (buf%repetitions(1) < 1)) then
+      call kim_log_entry(model_refresh_handle, KIM_LOG_VERBOSITY_ERROR, &
+                         "Invalid operation or repetitions parameter")
+      ierr = 1
+      return
+    end if
+
+    call kim_set_influence_distance_pointer(model_refresh_handle, &
+                                            buf%influence_distance)
+    call kim_set_neighbor_list_pointers( &
+      model_refresh_handle, 1, buf%cutoff, &
+      buf%model_will_not_request_neighbors_of_noncontributing_particles)
+
+    ierr = 0
+    return
+  end subroutine model_refresh
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Model destroy routine (REQUIRED)
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine model_destroy_func(model_destroy_handle, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(kim_model_destroy_handle_type), intent(inout) :: model_destroy_handle
+    integer(c_int), intent(out) :: ierr
+
+    type(buffer_type), pointer :: buf; type(c_ptr) :: pbuf
+
+    call kim_get_model_buffer_pointer(model_destroy_handle, pbuf)
+    call c_f_pointer(pbuf, buf)
+    deallocate (buf)
+    ierr = 0  ! everything is good
+  end subroutine model_destroy_func
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Model compute arguments create routine (REQUIRED)
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine model_compute_arguments_create( &
+    model_compute_handle, model_compute_arguments_create_handle, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(kim_model_compute_handle_type), intent(in) :: model_compute_handle
+    type(kim_model_compute_arguments_create_handle_type), intent(inout) :: &
+      model_compute_arguments_create_handle
+    integer(c_int), intent(out) :: ierr
+
+    integer(c_int) :: ierr2
+
+    ! avoid unused dummy argument warnings
+    if (model_compute_handle == KIM_MODEL_COMPUTE_NULL_HANDLE) continue
+
+    ierr = 0
+    call kim_set_argument_support_status( &
+      model_compute_arguments_create_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_ENERGY, &
+      KIM_SUPPORT_STATUS_OPTIONAL, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_callback_support_status( &
+      model_compute_arguments_create_handle, &
+      KIM_COMPUTE_CALLBACK_NAME_PROCESS_DEDR_TERM, &
+      KIM_SUPPORT_STATUS_OPTIONAL, ierr2)
+    ierr = ierr + ierr2
+
+    if (ierr /= 0) then
+      ierr = 1
+      call kim_log_entry( &
+        model_compute_arguments_create_handle, KIM_LOG_VERBOSITY_ERROR, &
+        "Unable to successfully create compute_arguments object")
+    end if
+    return
+  end subroutine model_compute_arguments_create
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Model compute arguments destroy routine (REQUIRED)
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine model_compute_arguments_destroy( &
+    model_compute_handle, model_compute_arguments_destroy_handle, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(kim_model_compute_handle_type), intent(in) :: model_compute_handle
+    type(kim_model_compute_arguments_destroy_handle_type), intent(inout) :: &
+      model_compute_arguments_destroy_handle
+    integer(c_int), intent(out) :: ierr
+
+    ! avoid unused dummy argument warnings
+    if (model_compute_handle == KIM_MODEL_COMPUTE_NULL_HANDLE) continue
+    if (model_compute_arguments_destroy_handle == &
+        KIM_MODEL_COMPUTE_ARGUMENTS_DESTROY_NULL_HANDLE) continue
+
+    ierr = 0
+    return
+  end subroutine model_compute_arguments_destroy
+
+end module ex_model_Ar_API_Overhead_F03
+
+!-------------------------------------------------------------------------------
+!
+! Model create routine (REQUIRED)
+!
+!-------------------------------------------------------------------------------
+recursive subroutine model_create_routine( &
+  model_create_handle, requested_length_unit, requested_energy_unit, &
+  requested_charge_unit, requested_temperature_unit, requested_time_unit, &
+  ierr) bind(c)
+  use, intrinsic :: iso_c_binding
+  use ex_model_Ar_API_Overhead_F03
+  use kim_model_headers_module
+  implicit none
+
+  !-- Transferred variables
+  type(kim_model_create_handle_type), intent(inout) :: model_create_handle
+  type(kim_length_unit_type), intent(in), value :: requested_length_unit
+  type(kim_energy_unit_type), intent(in), value :: requested_energy_unit
+  type(kim_charge_unit_type), intent(in), value :: requested_charge_unit
+  type(kim_temperature_unit_type), intent(in), value :: &
+    requested_temperature_unit
+  type(kim_time_unit_type), intent(in), value :: requested_time_unit
+  integer(c_int), intent(out) :: ierr
+
+  !-- KIM variables
+  integer(c_int) :: ierr2
+  type(buffer_type), pointer :: buf
+
+  ierr = 0
+  ierr2 = 0
+
+  ! avoid unsed dummy argument warnings
+  if (requested_length_unit == KIM_LENGTH_UNIT_UNUSED) continue
+  if (requested_energy_unit == KIM_ENERGY_UNIT_UNUSED) continue
+  if (requested_charge_unit == KIM_CHARGE_UNIT_UNUSED) continue
+  if (requested_temperature_unit == KIM_TEMPERATURE_UNIT_UNUSED) continue
+  if (requested_time_unit == KIM_TIME_UNIT_UNUSED) continue
+
+  ! set units
+  call kim_set_units(model_create_handle, &
+                     KIM_LENGTH_UNIT_A, &
+                     KIM_ENERGY_UNIT_EV, &
+                     KIM_CHARGE_UNIT_UNUSED, &
+                     KIM_TEMPERATURE_UNIT_UNUSED, &
+                     KIM_TIME_UNIT_UNUSED, &
+                     ierr2)
+  ierr = ierr + ierr2
+
+  ! register species
+  call kim_set_species_code(model_create_handle, &
+                            KIM_SPECIES_NAME_AR, speccode, ierr2)
+  ierr = ierr + ierr2
+
+  ! register numbering
+  call kim_set_model_numbering(model_create_handle, &
+                               KIM_NUMBERING_ONE_BASED, ierr2)
+  ierr = ierr + ierr2
+
+  ! register function pointers
+  call kim_set_routine_pointer( &
+    model_create_handle, &
+    KIM_MODEL_ROUTINE_NAME_COMPUTE, KIM_LANGUAGE_NAME_FORTRAN, &
+    1, c_funloc(model_compute), ierr2)
+  ierr = ierr + ierr2
+  call kim_set_routine_pointer( &
+    model_create_handle, &
+    KIM_MODEL_ROUTINE_NAME_REFRESH, KIM_LANGUAGE_NAME_FORTRAN, &
+    1, c_funloc(model_refresh), ierr2)
+  ierr = ierr + ierr2
+  call kim_set_routine_pointer( &
+    model_create_handle, KIM_MODEL_ROUTINE_NAME_COMPUTE_ARGUMENTS_CREATE, &
+    KIM_LANGUAGE_NAME_FORTRAN, 1, c_funloc(model_compute_arguments_create), &
+    ierr2)
+  ierr = ierr + ierr2
+  call kim_set_routine_pointer( &
+    model_create_handle, KIM_MODEL_ROUTINE_NAME_COMPUTE_ARGUMENTS_DESTROY, &
+    KIM_LANGUAGE_NAME_FORTRAN, 1, c_funloc(model_compute_arguments_destroy), &
+    ierr2)
+  ierr = ierr + ierr2
+  call kim_set_routine_pointer( &
+    model_create_handle, &
+    KIM_MODEL_ROUTINE_NAME_DESTROY, KIM_LANGUAGE_NAME_FORTRAN, &
+    1, c_funloc(model_destroy_func), ierr2)
+  ierr = ierr + ierr2
+
+  ! allocate buffer
+  allocate (buf)
+
+  ! store model buffer in KIM object
+  call kim_set_model_buffer_pointer(model_create_handle, &
+                                    c_loc(buf))
+
+  ! set buffer values
+  buf%operation = 0
+  buf%repetitions = 1
+  buf%influence_distance = model_cutoff
+  buf%cutoff = model_cutoff
+  buf%model_will_not_request_neighbors_of_noncontributing_particles = 1
+
+  ! register influence distance
+  call kim_set_influence_distance_pointer( &
+    model_create_handle, buf%influence_distance)
+
+  ! register cutoff
+  call kim_set_neighbor_list_pointers( &
+    model_create_handle, 1, buf%cutoff, &
+    buf%model_will_not_request_neighbors_of_noncontributing_particles)
+
+  ! register parameters
+  call kim_set_parameter_pointer( &
+    model_create_handle, buf%operation, "operation", &
+    "KIM-API operation performed by Compute(): 0 none, " &
+    //"1 GetNeighborList, 2 GetArgumentPointer, " &
+    //"3 ProcessDEDrTerm, 4 LogEntry", ierr2)
+  ierr = ierr + ierr2
+  call kim_set_parameter_pointer( &
+    model_create_handle, buf%repetitions, "repetitions", &
+    "Number of times the operation is performed per Compute()", ierr2)
+  ierr = ierr + ierr2
+
+  if (ierr /= 0) then
+    ierr = 1
+    deallocate (buf)
+    call kim_log_entry(model_create_handle, KIM_LOG_VERBOSITY_ERROR, &
+                       "Unable to successfully initialize model")
+  end if
+  return
+
+end subroutine model_create_routine
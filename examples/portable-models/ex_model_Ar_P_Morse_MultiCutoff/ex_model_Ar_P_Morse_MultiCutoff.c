@@ -240,6 +240,9 @@ int loops(KIM_ModelCompute const * const modelCompute,
   int i;
   int numOfPartNeigh;
   int const * neighListOfCurrentPart;
+  double const * dxOfCurrentPartNeigh;
+  double const * rsqOfCurrentPartNeigh;
+  int useDisplacements;
   int jj;
   int j;
   double Rsqij;
@@ -261,17 +264,42 @@ int loops(KIM_ModelCompute const * const modelCompute,
   double R_pairs[2];
   double * pR_pairs = &(R_pairs[0]);
 
+  /* use the simulator's displacements, if provided, to avoid gathering */
+  /* the neighbor coordinates for each list */
+  ier = KIM_ModelComputeArguments_IsCallbackPresent(
+      modelComputeArguments,
+      KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements,
+      &useDisplacements);
+  if (ier) useDisplacements = FALSE;
+  dxOfCurrentPartNeigh = NULL;
+  rsqOfCurrentPartNeigh = NULL;
+
   /* loop over particles and compute enregy and forces */
   LOG_INFORMATION("Starting main compute loop");
   for (i = 0; i < *nParts; ++i)
   {
     if (particleContributing[i])
     {
-      ier = KIM_ModelComputeArguments_GetNeighborList(modelComputeArguments,
-                                                      neighborListIndex,
-                                                      i,
-                                                      &numOfPartNeigh,
-                                                      &neighListOfCurrentPart);
+      if (useDisplacements)
+      {
+        ier = KIM_ModelComputeArguments_GetNeighborListWithDisplacements(
+            modelComputeArguments,
+            neighborListIndex,
+            i,
+            &numOfPartNeigh,
+            &neighListOfCurrentPart,
+            &dxOfCurrentPartNeigh,
+            &rsqOfCurrentPartNeigh);
+      }
+      else
+      {
+        ier = KIM_ModelComputeArguments_GetNeighborList(
+            modelComputeArguments,
+            neighborListIndex,
+            i,
+            &numOfPartNeigh,
+            &neighListOfCurrentPart);
+      }
       if (ier)
       {
         /* some sort of problem, exit */
@@ -293,11 +321,15 @@ int loops(KIM_ModelCompute const * const modelCompute,
           Rsqij = 0.0;
           for (k = 0; k < DIM; ++k)
           {
-            Rij[k] = coords[j * DIM + k] - coords[i * DIM + k];
+            if (dxOfCurrentPartNeigh != NULL)
+              Rij[k] = dxOfCurrentPartNeigh[jj * DIM + k];
+            else
+              Rij[k] = coords[j * DIM + k] - coords[i * DIM + k];
 
             /* compute squared distance */
             Rsqij += Rij[k] * Rij[k];
           }
+          if (rsqOfCurrentPartNeigh != NULL) Rsqij = rsqOfCurrentPartNeigh[jj];
 
           /* compute energy and force */
           if (Rsqij < cutsq)
@@ -789,6 +821,11 @@ static int compute_arguments_create(
               modelComputeArgumentsCreate,
               KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2Term,
               KIM_SUPPORT_STATUS_optional);
+  error = error
+          || KIM_ModelComputeArgumentsCreate_SetCallbackSupportStatus(
+              modelComputeArgumentsCreate,
+              KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements,
+              KIM_SUPPORT_STATUS_optional);
 
   if (error)
   {
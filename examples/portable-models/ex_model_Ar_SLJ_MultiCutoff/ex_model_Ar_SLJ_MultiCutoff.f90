@@ -550,7 +550,14 @@ contains
     !  ierr = ierr + ierr2
 
     ! register call backs
-    ! NONE
+    !
+    ! both neighbor lists are used for the same particles, so accept them
+    ! as prefixes of a single distance-sorted list, if the simulator has one
+    call kim_set_callback_support_status( &
+      model_compute_arguments_create_handle, &
+      KIM_COMPUTE_CALLBACK_NAME_GET_NESTED_NEIGHBOR_LISTS, &
+      KIM_SUPPORT_STATUS_OPTIONAL, ierr2)
+    ierr = ierr + ierr2
 
     if (ierr /= 0) then
       ierr = 1
@@ -0,0 +1,420 @@
+/*                                                                            */
+/* KIM-API: An API for interatomic models                                     */
+/* Copyright (c) 2013--2022, Regents of the University of Minnesota.          */
+/* All rights reserved.                                                       */
+/*                                                                            */
+/* Contributors:                                                              */
+/*    Ryan S. Elliott                                                         */
+/*    Ellad B. Tadmor                                                         */
+/*    Stephen M. Whalen                                                       */
+/*                                                                            */
+/* SPDX-License-Identifier: LGPL-2.1-or-later                                 */
+/*                                                                            */
+/* This library is free software; you can redistribute it and/or              */
+/* modify it under the terms of the GNU Lesser General Public                 */
+/* License as published by the Free Software Foundation; either               */
+/* version 2.1 of the License, or (at your option) any later version.         */
+/*                                                                            */
+/* This library is distributed in the hope that it will be useful,            */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of             */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU          */
+/* Lesser General Public License for more details.                            */
+/*                                                                            */
+/* You should have received a copy of the GNU Lesser General Public License   */
+/* along with this library; if not, write to the Free Software Foundation,    */
+/* Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA         */
+
+/*                                                                            */
+/* Release: This file is part of the kim-api-2.4.1 package.                   */
+/*                                                                            */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L /* clock_gettime */
+#endif
+
+#include "KIM_SimulatorHeaders.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TRUE 1
+#define FALSE 0
+
+#define DIM 3
+#define NUMBER_OF_PARTICLES 2
+#define NUMBER_OF_MODELS 3
+#define NUMBER_OF_OPERATIONS 5
+#define NUMBER_OF_TRIALS 5
+#define MAX_REPETITIONS 1000000
+
+#define MY_ERROR(message)                                            \
+  {                                                                  \
+    printf("* Error : \"%s\" %d:%s\n", message, __LINE__, __FILE__); \
+    exit(1);                                                         \
+  }
+
+static char const * const modelNames[NUMBER_OF_MODELS]
+    = {"ex_model_Ar_API_Overhead",
+       "ex_model_Ar_API_Overhead_C",
+       "ex_model_Ar_API_Overhead_Fortran"};
+
+/* index is the value of the models' "operation" parameter */
+static char const * const operationNames[NUMBER_OF_OPERATIONS]
+    = {"Compute",
+       "GetNeighborList",
+       "GetArgumentPointer",
+       "ProcessDEDrTerm",
+       "LogEntry"};
+
+/* Define simulator data structure */
+typedef struct
+{
+  int neighbors[NUMBER_OF_PARTICLES];
+  double sumOfDEDr;
+} SimulatorData;
+
+/* Define prototypes */
+static int get_neigh(void * const dataObject,
+                     int const numberOfNeighborLists,
+                     double const * const cutoffs,
+                     int const neighborListIndex,
+                     int const particleNumber,
+                     int * const numberOfNeighbors,
+                     int const ** const neighborsOfParticle);
+
+static int process_dEdr(void * const dataObject,
+                        double const de,
+                        double const r,
+                        double const * const dx,
+                        int const i,
+                        int const j);
+
+static double wall_time(void);
+
+static double seconds_per_compute(
+    KIM_Model * const model,
+    KIM_ComputeArguments const * const computeArguments,
+    int const operationIndex,
+    int const repetitionsIndex,
+    int const operation,
+    int const repetitions,
+    int const numberOfComputes);
+
+static int find_parameter(KIM_Model const * const model,
+                          char const * const name);
+
+static double benchmark_model(char const * const modelName,
+                              int const numberOfComputes,
+                              int const repetitions);
+
+static void usage(char const * const name);
+
+
+/* Main program */
+int main(int argc, char * argv[])
+{
+  int numberOfComputes = 1000;
+  int repetitions = 100;
+  double maxNsPerCall = -1.0; /* no limit */
+  double worst = 0.0;
+  double ns;
+  int i;
+
+  for (i = 1; i < argc; ++i)
+  {
+    if (i + 1 >= argc) usage(argv[0]);
+    if (!strcmp(argv[i], "--computes"))
+      numberOfComputes = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--repetitions"))
+      repetitions = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--max-ns-per-call"))
+      maxNsPerCall = atof(argv[++i]);
+    else
+      usage(argv[0]);
+  }
+  if ((numberOfComputes < 1) || (repetitions < 1)) usage(argv[0]);
+
+  printf("KIM API overhead from a C simulator (ns per call, %d computes x %d "
+         "repetitions)\n",
+         numberOfComputes,
+         repetitions);
+  printf("%-34s%-20s%12s\n", "Model", "Operation", "ns/call");
+
+  for (i = 0; i < NUMBER_OF_MODELS; ++i)
+  {
+    ns = benchmark_model(modelNames[i], numberOfComputes, repetitions);
+    if (ns > worst) worst = ns;
+  }
+
+  if ((maxNsPerCall > 0.0) && (worst > maxNsPerCall))
+  {
+    printf("* Error : slowest operation took %.1f ns per call, more than the "
+           "limit of %.1f ns\n",
+           worst,
+           maxNsPerCall);
+    return 1;
+  }
+
+  return 0;
+}
+
+/* Measure the per-call cost of each operation for one model; returns the */
+/* largest value measured                                                 */
+static double benchmark_model(char const * const modelName,
+                              int const numberOfComputes,
+                              int const repetitions)
+{
+  KIM_Model * model;
+  KIM_ComputeArguments * computeArguments;
+  int requestedUnitsAccepted;
+  int speciesIsSupported;
+  int speciesCode;
+  int operationIndex;
+  int repetitionsIndex;
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  int particleContributing[NUMBER_OF_PARTICLES];
+  double coordinates[NUMBER_OF_PARTICLES * DIM];
+  double energy;
+  SimulatorData data;
+  double computeSeconds;
+  double seconds;
+  double ns;
+  double worst = 0.0;
+  int operation;
+  int computes;
+  int calls;
+  int i;
+  int k;
+  int error;
+
+  error = KIM_Model_Create(KIM_NUMBERING_zeroBased,
+                           KIM_LENGTH_UNIT_A,
+                           KIM_ENERGY_UNIT_eV,
+                           KIM_CHARGE_UNIT_e,
+                           KIM_TEMPERATURE_UNIT_K,
+                           KIM_TIME_UNIT_ps,
+                           modelName,
+                           &requestedUnitsAccepted,
+                           &model);
+  if (error) MY_ERROR("KIM_Model_Create()");
+
+  error = KIM_Model_GetSpeciesSupportAndCode(
+      model, KIM_SPECIES_NAME_Ar, &speciesIsSupported, &speciesCode);
+  if ((error) || (!speciesIsSupported)) MY_ERROR("Species Ar not supported");
+
+  operationIndex = find_parameter(model, "operation");
+  repetitionsIndex = find_parameter(model, "repetitions");
+
+  error = KIM_Model_ComputeArgumentsCreate(model, &computeArguments);
+  if (error) MY_ERROR("KIM_Model_ComputeArgumentsCreate");
+  /* debug entries issued by the model must be filtered, not printed */
+  KIM_ComputeArguments_PushLogVerbosity(computeArguments,
+                                        KIM_LOG_VERBOSITY_error);
+
+  for (i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    particleSpeciesCodes[i] = speciesCode;
+    particleContributing[i] = 1;
+    for (k = 0; k < DIM; ++k) coordinates[i * DIM + k] = 0.0;
+    data.neighbors[i] = (i + 1) % NUMBER_OF_PARTICLES;
+  }
+  coordinates[DIM] = 1.0;
+  data.sumOfDEDr = 0.0;
+
+  error = KIM_ComputeArguments_SetArgumentPointerInteger(
+              computeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_numberOfParticles,
+              &numberOfParticles)
+          || KIM_ComputeArguments_SetArgumentPointerInteger(
+              computeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_particleSpeciesCodes,
+              particleSpeciesCodes)
+          || KIM_ComputeArguments_SetArgumentPointerInteger(
+              computeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_particleContributing,
+              particleContributing)
+          || KIM_ComputeArguments_SetArgumentPointerDouble(
+              computeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_coordinates,
+              coordinates)
+          || KIM_ComputeArguments_SetArgumentPointerDouble(
+              computeArguments,
+              KIM_COMPUTE_ARGUMENT_NAME_partialEnergy,
+              &energy)
+          || KIM_ComputeArguments_SetCallbackPointer(
+              computeArguments,
+              KIM_COMPUTE_CALLBACK_NAME_GetNeighborList,
+              KIM_LANGUAGE_NAME_c,
+              (KIM_Function *) &get_neigh,
+              &data)
+          || KIM_ComputeArguments_SetCallbackPointer(
+              computeArguments,
+              KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTerm,
+              KIM_LANGUAGE_NAME_c,
+              (KIM_Function *) &process_dEdr,
+              &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  /* operation 0 is the cost of a Compute() call; the others are the cost */
+  /* of a single call with the empty Compute() subtracted                 */
+  computeSeconds = seconds_per_compute(model,
+                                       computeArguments,
+                                       operationIndex,
+                                       repetitionsIndex,
+                                       0,
+                                       repetitions,
+                                       numberOfComputes);
+  for (operation = 0; operation < NUMBER_OF_OPERATIONS; ++operation)
+  {
+    ns = 1.0e9 * computeSeconds;
+    if (operation > 0)
+    {
+      /* raise the repetitions until the calls take at least as long as  */
+      /* the Compute() around them, so its (e.g. Debug build) cost and   */
+      /* noise do not swamp the difference                               */
+      computes = numberOfComputes;
+      calls = repetitions;
+      while (TRUE)
+      {
+        seconds = seconds_per_compute(model,
+                                      computeArguments,
+                                      operationIndex,
+                                      repetitionsIndex,
+                                      operation,
+                                      calls,
+                                      computes);
+        if ((seconds >= 2.0 * computeSeconds) || (calls >= MAX_REPETITIONS))
+          break;
+        calls *= 10;
+        computes = (computes > 10) ? computes / 10 : 1;
+      }
+      ns = 1.0e9 * (seconds - computeSeconds) / calls;
+    }
+    if (ns > worst) worst = ns;
+
+    printf("%-34s%-20s%12.1f\n", modelName, operationNames[operation], ns);
+  }
+
+  error = KIM_Model_ComputeArgumentsDestroy(model, &computeArguments);
+  if (error) MY_ERROR("Unable to destroy compute arguments");
+  KIM_Model_Destroy(&model);
+
+  return worst;
+}
+
+/* Best of several trials of the wall time per Compute() call, with the */
+/* models performing the given operation the given number of times      */
+static double seconds_per_compute(
+    KIM_Model * const model,
+    KIM_ComputeArguments const * const computeArguments,
+    int const operationIndex,
+    int const repetitionsIndex,
+    int const operation,
+    int const repetitions,
+    int const numberOfComputes)
+{
+  double best = -1.0;
+  double start;
+  double elapsed;
+  int trial;
+  int n;
+  int error;
+
+  error = KIM_Model_SetParameterInteger(model, operationIndex, 0, operation)
+          || KIM_Model_SetParameterInteger(
+              model, repetitionsIndex, 0, repetitions)
+          || KIM_Model_ClearThenRefresh(model);
+  if (error) MY_ERROR("Unable to select operation");
+
+  for (trial = 0; trial < NUMBER_OF_TRIALS; ++trial)
+  {
+    start = wall_time();
+    for (n = 0; n < numberOfComputes; ++n)
+    {
+      if (KIM_Model_Compute(model, computeArguments)) MY_ERROR("Compute");
+    }
+    elapsed = wall_time() - start;
+    if ((best < 0.0) || (elapsed < best)) best = elapsed;
+  }
+  return best / numberOfComputes;
+}
+
+static int find_parameter(KIM_Model const * const model,
+                          char const * const name)
+{
+  int numberOfParameters;
+  KIM_DataType dataType;
+  int extent;
+  char const * parameterName;
+  char const * description;
+  int i;
+
+  KIM_Model_GetNumberOfParameters(model, &numberOfParameters);
+  for (i = 0; i < numberOfParameters; ++i)
+  {
+    if (KIM_Model_GetParameterMetadata(
+            model, i, &dataType, &extent, &parameterName, &description))
+      MY_ERROR("KIM_Model_GetParameterMetadata");
+    if (!strcmp(parameterName, name)) return i;
+  }
+  MY_ERROR("Unable to find parameter");
+  return -1;
+}
+
+static double wall_time(void)
+{
+#if defined(_WIN32)
+  return (double) clock() / CLOCKS_PER_SEC;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+#endif
+}
+
+/* each particle's single neighbor is the other particle */
+static int get_neigh(void * const dataObject,
+                     int const numberOfNeighborLists,
+                     double const * const cutoffs,
+                     int const neighborListIndex,
+                     int const particleNumber,
+                     int * const numberOfNeighbors,
+                     int const ** const neighborsOfParticle)
+{
+  SimulatorData * data = (SimulatorData *) dataObject;
+
+  (void) numberOfNeighborLists; /* avoid unused parameter warnings */
+  (void) cutoffs;
+  (void) neighborListIndex;
+
+  *numberOfNeighbors = 1;
+  *neighborsOfParticle = &(data->neighbors[particleNumber]);
+  return FALSE;
+}
+
+static int process_dEdr(void * const dataObject,
+                        double const de,
+                        double const r,
+                        double const * const dx,
+                        int const i,
+                        int const j)
+{
+  (void) r; /* avoid unused parameter warnings */
+  (void) dx;
+  (void) i;
+  (void) j;
+
+  ((SimulatorData *) dataObject)->sumOfDEDr += de;
+  return FALSE;
+}
+
+static void usage(char const * const name)
+{
+  fprintf(stderr,
+          "Usage: %s [--computes <n>] [--repetitions <n>] "
+          "[--max-ns-per-call <ns>]\n",
+          name);
+  exit(1);
+}
@@ -0,0 +1,448 @@
+!
+! KIM-API: An API for interatomic models
+! Copyright (c) 2013--2022, Regents of the University of Minnesota.
+! All rights reserved.
+!
+! Contributors:
+!    Ryan S. Elliott
+!
+! SPDX-License-Identifier: LGPL-2.1-or-later
+!
+! This library is free software; you can redistribute it and/or
+! modify it under the terms of the GNU Lesser General Public
+! License as published by the Free Software Foundation; either
+! version 2.1 of the License, or (at your option) any later version.
+!
+! This library is distributed in the hope that it will be useful,
+! but WITHOUT ANY WARRANTY; without even the implied warranty of
+! MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+! Lesser General Public License for more details.
+!
+! You should have received a copy of the GNU Lesser General Public License
+! along with this library; if not, write to the Free Software Foundation,
+! Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+!
+
+!
+! Release: This file is part of the kim-api-2.4.1 package.
+!
+
+module error
+  use, intrinsic :: iso_c_binding
+  implicit none
+
+  public
+
+contains
+  recursive subroutine my_error(message)
+    implicit none
+    character(len=*, kind=c_char), intent(in) :: message
+
+    print *, "* Error : ", trim(message)
+    stop 1
+  end subroutine my_error
+end module error
+
+!-------------------------------------------------------------------------------
+!
+! module mod_callbacks :
+!
+!    Module contains the simulator data and the callback routines
+!
+!-------------------------------------------------------------------------------
+
+module mod_callbacks
+
+  use, intrinsic :: iso_c_binding
+  implicit none
+
+  public get_neigh, process_dedr
+
+  integer(c_int), parameter :: number_of_particles = 2
+
+  type, bind(c) :: simulator_data_type
+    integer(c_int) :: neighbors(number_of_particles)
+    real(c_double) :: sum_of_dedr
+  end type simulator_data_type
+contains
+
+  !-----------------------------------------------------------------------------
+  !
+  ! get_neigh neighbor list access function; each particle's single neighbor
+  ! is the other particle
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine get_neigh(data_object, number_of_neighbor_lists, &
+                                 cutoffs, neighbor_list_index, request, &
+                                 numnei, pnei1part, ierr) bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(c_ptr), value, intent(in) :: data_object
+    integer(c_int), value, intent(in) :: number_of_neighbor_lists
+    real(c_double), intent(in) :: cutoffs(*)
+    integer(c_int), value, intent(in) :: neighbor_list_index
+    integer(c_int), value, intent(in)  :: request
+    integer(c_int), intent(out) :: numnei
+    type(c_ptr), intent(out) :: pnei1part
+    integer(c_int), intent(out) :: ierr
+
+    type(simulator_data_type), pointer :: sim_data
+
+    ! avoid unused dummy argument warnings
+    if (number_of_neighbor_lists == 0) continue
+    if (cutoffs(1) < 0.0) continue
+    if (neighbor_list_index == 0) continue
+
+    call c_f_pointer(data_object, sim_data)
+    numnei = 1
+    pnei1part = c_loc(sim_data%neighbors(request))
+    ierr = 0
+  end subroutine get_neigh
+
+  !-----------------------------------------------------------------------------
+  !
+  ! process_dedr accumulates dE/dr so the call cannot be optimized away
+  !
+  !-----------------------------------------------------------------------------
+  recursive subroutine process_dedr(data_object, de, r, dx, i, j, ierr) &
+    bind(c)
+    implicit none
+
+    !-- Transferred variables
+    type(c_ptr), value, intent(in) :: data_object
+    real(c_double), value, intent(in) :: de
+    real(c_double), value, intent(in) :: r
+    real(c_double), intent(in) :: dx(3)
+    integer(c_int), value, intent(in) :: i
+    integer(c_int), value, intent(in) :: j
+    integer(c_int), intent(out) :: ierr
+
+    type(simulator_data_type), pointer :: sim_data
+
+    ! avoid unused dummy argument warnings
+    if ((r < 0.0) .or. (dx(1) < 0.0) .or. (i == j)) continue
+
+    call c_f_pointer(data_object, sim_data)
+    sim_data%sum_of_dedr = sim_data%sum_of_dedr + de
+    ierr = 0
+  end subroutine process_dedr
+
+end module mod_callbacks
+
+!-------------------------------------------------------------------------------
+!
+! module mod_benchmark :
+!
+!    Module contains the timing routines
+!
+!-------------------------------------------------------------------------------
+
+module mod_benchmark
+
+  use, intrinsic :: iso_c_binding
+  use error
+  use kim_simulator_headers_module
+  use mod_callbacks
+  implicit none
+
+  public benchmark_model
+
+  integer(c_int), parameter :: DIM = 3
+  integer(c_int), parameter :: number_of_operations = 5
+  integer(c_int), parameter :: number_of_trials = 5
+  integer(c_int), parameter :: max_repetitions = 1000000
+  integer, parameter :: clock_kind = selected_int_kind(18)
+
+  ! index is one more than the value of the models' "operation" parameter
+  character(len=20), parameter :: operation_names(number_of_operations) = &
+    (/"Compute           ", "GetNeighborList   ", "GetArgumentPointer", &
+      "ProcessDEDrTerm   ", "LogEntry          "/)
+contains
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Best of several trials of the wall time per Compute() call, with the
+  ! models performing the given operation the given number of times
+  !
+  !-----------------------------------------------------------------------------
+  recursive function seconds_per_compute(model_handle, &
+                                         compute_arguments_handle, &
+                                         operation_index, repetitions_index, &
+                                         operation, repetitions, &
+                                         number_of_computes) result(best)
+    implicit none
+    type(kim_model_handle_type), intent(in) :: model_handle
+    type(kim_compute_arguments_handle_type), intent(in) :: &
+      compute_arguments_handle
+    integer(c_int), intent(in) :: operation_index
+    integer(c_int), intent(in) :: repetitions_index
+    integer(c_int), intent(in) :: operation
+    integer(c_int), intent(in) :: repetitions
+    integer(c_int), intent(in) :: number_of_computes
+    real(c_double) :: best
+
+    integer(kind=clock_kind) :: start, finish, rate
+    integer(c_int) :: trial, n, ierr, ierr2
+    real(c_double) :: elapsed
+
+    ierr = 0
+    call kim_set_parameter(model_handle, operation_index, 1, operation, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_parameter(model_handle, repetitions_index, 1, &
+                           repetitions, ierr2)
+    ierr = ierr + ierr2
+    call kim_clear_then_refresh(model_handle, ierr2)
+    ierr = ierr + ierr2
+    if (ierr /= 0) call my_error("Unable to select operation")
+
+    best = -1.0_c_double
+    do trial = 1, number_of_trials
+      call system_clock(start, rate)
+      do n = 1, number_of_computes
+        call kim_compute(model_handle, compute_arguments_handle, ierr)
+        if (ierr /= 0) call my_error("kim_compute")
+      end do
+      call system_clock(finish)
+      elapsed = real(finish - start, c_double) / real(rate, c_double)
+      if ((best < 0.0_c_double) .or. (elapsed < best)) best = elapsed
+    end do
+    best = best / number_of_computes
+  end function seconds_per_compute
+
+  recursive function find_parameter(model_handle, name) &
+    result(parameter_index)
+    implicit none
+    type(kim_model_handle_type), intent(in) :: model_handle
+    character(len=*, kind=c_char), intent(in) :: name
+    integer(c_int) :: parameter_index
+
+    integer(c_int) :: number_of_parameters, extent, ierr
+    type(kim_data_type_type) :: data_type
+    character(len=1024, kind=c_char) :: parameter_name, description
+
+    call kim_get_number_of_parameters(model_handle, number_of_parameters)
+    do parameter_index = 1, number_of_parameters
+      call kim_get_parameter_metadata(model_handle, parameter_index, &
+                                      data_type, extent, parameter_name, &
+                                      description, ierr)
+      if (ierr /= 0) call my_error("kim_get_parameter_metadata")
+      if (trim(parameter_name) == name) return
+    end do
+    call my_error("Unable to find parameter "//name)
+  end function find_parameter
+
+  !-----------------------------------------------------------------------------
+  !
+  ! Measure the per-call cost of each operation for one model; returns the
+  ! largest value measured
+  !
+  !-----------------------------------------------------------------------------
+  recursive function benchmark_model(model_name, number_of_computes, &
+                                     repetitions) result(worst)
+    implicit none
+    character(len=*, kind=c_char), intent(in) :: model_name
+    integer(c_int), intent(in) :: number_of_computes
+    integer(c_int), intent(in) :: repetitions
+    real(c_double) :: worst
+
+    type(kim_model_handle_type) :: model_handle
+    type(kim_compute_arguments_handle_type) :: compute_arguments_handle
+    type(simulator_data_type), target :: sim_data
+    integer(c_int), target :: particle_species_codes(number_of_particles)
+    integer(c_int), target :: particle_contributing(number_of_particles)
+    real(c_double), target :: coords(DIM, number_of_particles)
+    real(c_double), target :: energy
+    real(c_double) :: compute_seconds, seconds
+    real(c_double) :: ns
+    integer(c_int) :: requested_units_accepted
+    integer(c_int) :: species_is_supported, species_code
+    integer(c_int) :: operation_index, repetitions_index
+    integer(c_int) :: computes, calls
+    integer(c_int) :: i, operation, ierr, ierr2
+
+    call kim_model_create(KIM_NUMBERING_ONE_BASED, &
+                          KIM_LENGTH_UNIT_A, &
+                          KIM_ENERGY_UNIT_EV, &
+                          KIM_CHARGE_UNIT_E, &
+                          KIM_TEMPERATURE_UNIT_K, &
+                          KIM_TIME_UNIT_PS, &
+                          model_name, &
+                          requested_units_accepted, &
+                          model_handle, ierr)
+    if (ierr /= 0) call my_error("kim_model_create")
+
+    call kim_get_species_support_and_code( &
+      model_handle, KIM_SPECIES_NAME_AR, species_is_supported, &
+      species_code, ierr)
+    if ((ierr /= 0) .or. (species_is_supported /= 1)) then
+      call my_error("Model does not support Ar")
+    end if
+
+    operation_index = find_parameter(model_handle, "operation")
+    repetitions_index = find_parameter(model_handle, "repetitions")
+
+    call kim_compute_arguments_create( &
+      model_handle, compute_arguments_handle, ierr)
+    if (ierr /= 0) call my_error("kim_compute_arguments_create")
+    ! debug entries issued by the model must be filtered, not printed
+    call kim_push_log_verbosity(compute_arguments_handle, &
+                                KIM_LOG_VERBOSITY_ERROR)
+
+    do i = 1, number_of_particles
+      particle_species_codes(i) = species_code
+      particle_contributing(i) = 1
+      sim_data%neighbors(i) = mod(i, number_of_particles) + 1
+    end do
+    coords = 0.0_c_double
+    coords(1, 2) = 1.0_c_double
+    sim_data%sum_of_dedr = 0.0_c_double
+
+    ierr = 0
+    call kim_set_argument_pointer( &
+      compute_arguments_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_NUMBER_OF_PARTICLES, number_of_particles, &
+      ierr2)
+    ierr = ierr + ierr2
+    call kim_set_argument_pointer( &
+      compute_arguments_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_PARTICLE_SPECIES_CODES, &
+      particle_species_codes, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_argument_pointer( &
+      compute_arguments_handle, &
+      KIM_COMPUTE_ARGUMENT_NAME_PARTICLE_CONTRIBUTING, &
+      particle_contributing, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_argument_pointer( &
+      compute_arguments_handle, KIM_COMPUTE_ARGUMENT_NAME_COORDINATES, &
+      coords, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_argument_pointer( &
+      compute_arguments_handle, KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_ENERGY, &
+      energy, ierr2)
+    ierr = ierr + ierr2
+    call kim_set_callback_pointer( &
+      compute_arguments_handle, KIM_COMPUTE_CALLBACK_NAME_GET_NEIGHBOR_LIST, &
+      KIM_LANGUAGE_NAME_FORTRAN, c_funloc(get_neigh), c_loc(sim_data), ierr2)
+    ierr = ierr + ierr2
+    call kim_set_callback_pointer( &
+      compute_arguments_handle, KIM_COMPUTE_CALLBACK_NAME_PROCESS_DEDR_TERM, &
+      KIM_LANGUAGE_NAME_FORTRAN, c_funloc(process_dedr), c_loc(sim_data), ierr2)
+    ierr = ierr + ierr2
+    if (ierr /= 0) call my_error("Unable to set compute arguments")
+
+    ! the first operation is the cost of a Compute() call; the others are
+    ! the cost of a single call with the empty Compute() subtracted
+    compute_seconds = seconds_per_compute(model_handle, &
+                                          compute_arguments_handle, &
+                                          operation_index, repetitions_index, &
+                                          0, repetitions, number_of_computes)
+    worst = 0.0_c_double
+    do operation = 1, number_of_operations
+      ns = 1.0e9_c_double * compute_seconds
+      if (operation > 1) then
+        ! raise the repetitions until the calls take at least as long as the
+        ! Compute() around them, so its (e.g. Debug build) cost and noise do
+        ! not swamp the difference
+        computes = number_of_computes
+        calls = repetitions
+        do
+          seconds = seconds_per_compute(model_handle, &
+                                        compute_arguments_handle, &
+                                        operation_index, repetitions_index, &
+                                        operation - 1, calls, computes)
+          if ((seconds >= 2.0_c_double * compute_seconds) &
+              .or. (calls >= max_repetitions)) exit
+          calls = calls * 10
+          computes = max(1, computes / 10)
+        end do
+        ns = 1.0e9_c_double * (seconds - compute_seconds) / calls
+      end if
+      worst = max(worst, ns)
+
+      print '(A,T35,A,T55,F12.1)', model_name, operation_names(operation), ns
+    end do
+
+    call kim_compute_arguments_destroy( &
+      model_handle, compute_arguments_handle, ierr)
+    if (ierr /= 0) call my_error("kim_compute_arguments_destroy")
+    call kim_model_destroy(model_handle)
+  end function benchmark_model
+
+end module mod_benchmark
+
+!-------------------------------------------------------------------------------
+!
+! Main program
+!
+!-------------------------------------------------------------------------------
+program api_overhead_benchmark_fortran
+  use, intrinsic :: iso_c_binding
+  use error
+  use mod_benchmark
+  implicit none
+
+  integer(c_int), parameter :: number_of_models = 3
+  character(len=34, kind=c_char), parameter :: &
+    model_names(number_of_models) = &
+    (/"ex_model_Ar_API_Overhead          ", &
+      "ex_model_Ar_API_Overhead_C        ", &
+      "ex_model_Ar_API_Overhead_Fortran  "/)
+
+  integer(c_int) :: number_of_computes = 1000
+  integer(c_int) :: repetitions = 100
+  real(c_double) :: max_ns_per_call = -1.0_c_double  ! no limit
+  real(c_double) :: worst
+  character(len=64) :: option, option_value
+  integer :: i, io_status
+  integer(c_int) :: m
+
+  i = 1
+  do while (i <= command_argument_count())
+    call get_command_argument(i, option)
+    call get_command_argument(i + 1, option_value)
+    if (i + 1 > command_argument_count()) call usage()
+    select case (trim(option))
+    case ("--computes")
+      read (option_value, *, iostat=io_status) number_of_computes
+    case ("--repetitions")
+      read (option_value, *, iostat=io_status) repetitions
+    case ("--max-ns-per-call")
+      read (option_value, *, iostat=io_status) max_ns_per_call
+    case default
+      call usage()
+    end select
+    if (io_status /= 0) call usage()
+    i = i + 2
+  end do
+  if ((number_of_computes < 1) .or. (repetitions < 1)) call usage()
+
+  print '(A,I0,A,I0,A)', &
+    "KIM API overhead from a Fortran simulator (ns per call, ", &
+    number_of_computes, " computes x ", repetitions, " repetitions)"
+  print '(A,T35,A,T55,A12)', "Model", "Operation", "ns/call"
+
+  worst = 0.0_c_double
+  do m = 1, number_of_models
+    worst = max(worst, benchmark_model(trim(model_names(m)), &
+                                       number_of_computes, repetitions))
+  end do
+
+  if ((max_ns_per_call > 0.0_c_double) .and. (worst > max_ns_per_call)) then
+    print '(A,F0.1,A,F0.1,A)', "* Error : slowest operation took ", worst, &
+      " ns per call, more than the limit of ", max_ns_per_call, " ns"
+    stop 1
+  end if
+
+contains
+
+  recursive subroutine usage()
+    implicit none
+
+    print '(A)', "Usage: api-overhead-benchmark-fortran [--computes <n>] " &
+      //"[--repetitions <n>] [--max-ns-per-call <ns>]"
+    stop 1
+  end subroutine usage
+
+end program api_overhead_benchmark_fortran
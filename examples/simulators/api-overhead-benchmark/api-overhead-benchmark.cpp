@@ -0,0 +1,338 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#define DIM 3
+#define NUMBER_OF_PARTICLES 2
+#define NUMBER_OF_OPERATIONS 5
+#define NUMBER_OF_TRIALS 5
+#define MAX_REPETITIONS 1000000
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+char const * const modelNames[] = {"ex_model_Ar_API_Overhead",
+                                   "ex_model_Ar_API_Overhead_C",
+                                   "ex_model_Ar_API_Overhead_Fortran"};
+int const numberOfModels = sizeof(modelNames) / sizeof(modelNames[0]);
+
+// index is the value of the models' "operation" parameter
+char const * const operationNames[NUMBER_OF_OPERATIONS]
+    = {"Compute", "GetNeighborList", "GetArgumentPointer", "ProcessDEDrTerm",
+       "LogEntry"};
+
+struct SimulatorData
+{
+  int neighbors[NUMBER_OF_PARTICLES];
+  double sumOfDEDr;
+};
+
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const /* cutoffs */,
+                    int const /* neighborListIndex */,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+
+  // each particle's single neighbor is the other particle
+  *numberOfNeighbors = 1;
+  *neighborsOfParticle = &(data->neighbors[particleNumber]);
+  return false;
+}
+
+int ProcessDEDrTerm(void * const dataObject,
+                    double const de,
+                    double const /* r */,
+                    double const * const /* dx */,
+                    int const /* i */,
+                    int const /* j */)
+{
+  static_cast<SimulatorData *>(dataObject)->sumOfDEDr += de;
+  return false;
+}
+
+double WallTime()
+{
+#if defined(_WIN32)
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) + 1.0e-9 * ts.tv_nsec;
+#endif
+}
+
+// Best of several trials of the wall time per Compute() call, with the
+// models performing the given operation the given number of times
+double SecondsPerCompute(KIM::Model * const model,
+                         KIM::ComputeArguments const * const computeArguments,
+                         int const operationIndex,
+                         int const repetitionsIndex,
+                         int const operation,
+                         int const repetitions,
+                         int const numberOfComputes)
+{
+  int error = model->SetParameter(operationIndex, 0, operation)
+              || model->SetParameter(repetitionsIndex, 0, repetitions)
+              || model->ClearThenRefresh();
+  if (error) MY_ERROR("Unable to select operation");
+
+  double best = -1.0;
+  for (int trial = 0; trial < NUMBER_OF_TRIALS; ++trial)
+  {
+    double const start = WallTime();
+    for (int n = 0; n < numberOfComputes; ++n)
+    {
+      if (model->Compute(computeArguments)) MY_ERROR("Compute");
+    }
+    double const elapsed = WallTime() - start;
+    if ((best < 0.0) || (elapsed < best)) best = elapsed;
+  }
+  return best / numberOfComputes;
+}
+
+int FindParameter(KIM::Model const * const model, std::string const & name)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    int extent;
+    std::string const * parameterName;
+    std::string const * description;
+    if (model->GetParameterMetadata(
+            i, &dataType, &extent, &parameterName, &description))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName == name) return i;
+  }
+  MY_ERROR("Unable to find parameter " + name);
+  return -1;
+}
+
+// Measure the per-call cost of each operation for one model; returns the
+// largest value measured
+double BenchmarkModel(std::string const & modelName,
+                      int const numberOfComputes,
+                      int const repetitions)
+{
+  KIM::Model * model;
+  int requestedUnitsAccepted;
+  int error = KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                                 KIM::LENGTH_UNIT::A,
+                                 KIM::ENERGY_UNIT::eV,
+                                 KIM::CHARGE_UNIT::e,
+                                 KIM::TEMPERATURE_UNIT::K,
+                                 KIM::TIME_UNIT::ps,
+                                 modelName,
+                                 &requestedUnitsAccepted,
+                                 &model);
+  if (error) MY_ERROR("KIM::Model::Create()");
+
+  int speciesIsSupported;
+  int speciesCode;
+  error = model->GetSpeciesSupportAndCode(
+      KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode);
+  if ((error) || (!speciesIsSupported)) MY_ERROR("Species Ar not supported");
+
+  int const operationIndex = FindParameter(model, "operation");
+  int const repetitionsIndex = FindParameter(model, "repetitions");
+
+  KIM::ComputeArguments * computeArguments;
+  if (model->ComputeArgumentsCreate(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+  // debug entries issued by the model must be filtered, not printed
+  computeArguments->PushLogVerbosity(KIM::LOG_VERBOSITY::error);
+
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  int particleContributing[NUMBER_OF_PARTICLES];
+  double coordinates[NUMBER_OF_PARTICLES * DIM];
+  double energy;
+  SimulatorData data;
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    particleSpeciesCodes[i] = speciesCode;
+    particleContributing[i] = 1;
+    for (int k = 0; k < DIM; ++k) coordinates[i * DIM + k] = 0.0;
+    data.neighbors[i] = (i + 1) % NUMBER_OF_PARTICLES;
+  }
+  coordinates[DIM] = 1.0;
+  data.sumOfDEDr = 0.0;
+
+  error = computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+              &numberOfParticles)
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+              particleSpeciesCodes)
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+              particleContributing)
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::coordinates, coordinates)
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energy)
+          || computeArguments->SetCallbackPointer(
+              KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+              KIM::LANGUAGE_NAME::cpp,
+              reinterpret_cast<KIM::Function *>(GetNeighborList),
+              &data)
+          || computeArguments->SetCallbackPointer(
+              KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTerm,
+              KIM::LANGUAGE_NAME::cpp,
+              reinterpret_cast<KIM::Function *>(ProcessDEDrTerm),
+              &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  // operation 0 is the cost of a Compute() call; the others are the cost
+  // of a single call with the empty Compute() subtracted
+  double const computeSeconds = SecondsPerCompute(model,
+                                                  computeArguments,
+                                                  operationIndex,
+                                                  repetitionsIndex,
+                                                  0,
+                                                  repetitions,
+                                                  numberOfComputes);
+  double worst = 0.0;
+  for (int operation = 0; operation < NUMBER_OF_OPERATIONS; ++operation)
+  {
+    double ns = 1.0e9 * computeSeconds;
+    if (operation > 0)
+    {
+      // raise the repetitions until the calls take at least as long as the
+      // Compute() around them, so its (e.g. Debug build) cost and noise do
+      // not swamp the difference
+      int computes = numberOfComputes;
+      int calls = repetitions;
+      double seconds;
+      while (true)
+      {
+        seconds = SecondsPerCompute(model,
+                                    computeArguments,
+                                    operationIndex,
+                                    repetitionsIndex,
+                                    operation,
+                                    calls,
+                                    computes);
+        if ((seconds >= 2.0 * computeSeconds) || (calls >= MAX_REPETITIONS))
+          break;
+        calls *= 10;
+        computes = std::max(1, computes / 10);
+      }
+      ns = 1.0e9 * (seconds - computeSeconds) / calls;
+    }
+    worst = std::max(worst, ns);
+
+    std::cout << std::setw(34) << std::left << modelName << std::setw(20)
+              << operationNames[operation] << std::setw(12) << std::right
+              << std::fixed << std::setprecision(1) << ns << std::endl;
+  }
+
+  if (model->ComputeArgumentsDestroy(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  KIM::Model::Destroy(&model);
+
+  return worst;
+}
+
+void Usage(char const * const name)
+{
+  std::cerr << "Usage: " << name
+            << " [--computes <n>] [--repetitions <n>]"
+               " [--max-ns-per-call <ns>]"
+            << std::endl;
+  exit(1);
+}
+}  // namespace
+
+
+int main(int argc, char * argv[])
+{
+  int numberOfComputes = 1000;
+  int repetitions = 100;
+  double maxNsPerCall = -1.0;  // no limit
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (i + 1 >= argc) Usage(argv[0]);
+    if (!strcmp(argv[i], "--computes"))
+      numberOfComputes = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--repetitions"))
+      repetitions = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--max-ns-per-call"))
+      maxNsPerCall = atof(argv[++i]);
+    else
+      Usage(argv[0]);
+  }
+  if ((numberOfComputes < 1) || (repetitions < 1)) Usage(argv[0]);
+
+  std::cout << "KIM API overhead from a C++ simulator (ns per call, "
+            << numberOfComputes << " computes x " << repetitions
+            << " repetitions)" << std::endl;
+  std::cout << std::setw(34) << std::left << "Model" << std::setw(20)
+            << "Operation" << std::setw(12) << std::right << "ns/call"
+            << std::endl;
+
+  double worst = 0.0;
+  for (int m = 0; m < numberOfModels; ++m)
+  {
+    worst = std::max(
+        worst, BenchmarkModel(modelNames[m], numberOfComputes, repetitions));
+  }
+
+  if ((maxNsPerCall > 0.0) && (worst > maxNsPerCall))
+  {
+    std::cout << "* Error : slowest operation took " << worst
+              << " ns per call, more than the limit of " << maxNsPerCall
+              << " ns" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
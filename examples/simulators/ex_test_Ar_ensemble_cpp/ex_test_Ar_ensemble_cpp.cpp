@@ -0,0 +1,352 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DIM 3
+#define CELLS 3  // fcc unit cells along each direction
+#define NUMBER_OF_PARTICLES (4 * CELLS * CELLS * CELLS)
+#define NUMBER_OF_NONCONTRIBUTING 4
+#define LATTICE_CONSTANT 5.26
+#define TOLERANCE 1.0e-10
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+char const * const modelName
+    = "LennardJones612_UniversalShifted__MO_959249795837_003";
+
+// The neighbor list is computed on request for the cutoff the Model asks
+// for, so a Model that walks another member's list sees the wrong pairs.
+struct SimulatorData
+{
+  double const * coordinates;
+  std::vector<int> neighbors;
+  long calls;
+};
+
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const cutoffs,
+                    int const neighborListIndex,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+  double const cutoffSquared
+      = cutoffs[neighborListIndex] * cutoffs[neighborListIndex];
+  double const * const xi = &(data->coordinates[DIM * particleNumber]);
+
+  ++(data->calls);
+  data->neighbors.clear();
+  for (int j = 0; j < NUMBER_OF_PARTICLES; ++j)
+  {
+    if (j == particleNumber) continue;
+    double r2 = 0.0;
+    for (int k = 0; k < DIM; ++k)
+    {
+      double const dx = data->coordinates[DIM * j + k] - xi[k];
+      r2 += dx * dx;
+    }
+    if (r2 <= cutoffSquared) data->neighbors.push_back(j);
+  }
+  *numberOfNeighbors = static_cast<int>(data->neighbors.size());
+  *neighborsOfParticle = (*numberOfNeighbors > 0) ? &(data->neighbors[0]) : 0;
+  return false;
+}
+
+struct Results
+{
+  double energy;
+  double forces[DIM * NUMBER_OF_PARTICLES];
+  double particleEnergy[NUMBER_OF_PARTICLES];
+  double virial[6];
+};
+
+struct Member
+{
+  KIM::Model * model;
+  KIM::ComputeArguments * computeArguments;
+  Results results;
+};
+
+// Multiply every element of a double parameter by factor
+void ScaleParameter(KIM::Model * const model,
+                    std::string const & name,
+                    double const factor)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    int extent;
+    std::string const * parameterName;
+    if (model->GetParameterMetadata(
+            i, &dataType, &extent, &parameterName, NULL))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName != name) continue;
+
+    for (int j = 0; j < extent; ++j)
+    {
+      double value;
+      if (model->GetParameter(i, j, &value)
+          || model->SetParameter(i, j, factor * value))
+        MY_ERROR("Unable to scale parameter " + name);
+    }
+    if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+    return;
+  }
+  MY_ERROR("Unable to find parameter " + name);
+}
+
+void CreateMember(Member * const member,
+                  SimulatorData * const data,
+                  int * const numberOfParticles,
+                  int * const particleSpeciesCodes,
+                  int * const particleContributing,
+                  double * const coordinates)
+{
+  int requestedUnitsAccepted;
+  if (KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                         KIM::LENGTH_UNIT::A,
+                         KIM::ENERGY_UNIT::eV,
+                         KIM::CHARGE_UNIT::unused,
+                         KIM::TEMPERATURE_UNIT::unused,
+                         KIM::TIME_UNIT::unused,
+                         modelName,
+                         &requestedUnitsAccepted,
+                         &(member->model)))
+    MY_ERROR("KIM::Model::Create()");
+
+  int speciesIsSupported;
+  int speciesCode;
+  if (member->model->GetSpeciesSupportAndCode(
+          KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode)
+      || (!speciesIsSupported))
+    MY_ERROR("Species Ar not supported");
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+    particleSpeciesCodes[i] = speciesCode;
+
+  if (member->model->ComputeArgumentsCreate(&(member->computeArguments)))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+
+  // all members share the inputs; each has its own outputs
+  Results & results = member->results;
+  int error = member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                  numberOfParticles)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                  particleSpeciesCodes)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                  particleContributing)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinates, coordinates)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialEnergy,
+                  &(results.energy))
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForces, results.forces)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialParticleEnergy,
+                  results.particleEnergy)
+              || member->computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialVirial, results.virial)
+              || member->computeArguments->SetCallbackPointer(
+                  KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+                  KIM::LANGUAGE_NAME::cpp,
+                  reinterpret_cast<KIM::Function *>(GetNeighborList),
+                  data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+}
+
+void DestroyMember(Member * const member)
+{
+  if (member->model->ComputeArgumentsDestroy(&(member->computeArguments)))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  KIM::Model::Destroy(&(member->model));
+}
+
+double Difference(double const * const a,
+                  double const * const b,
+                  int const length)
+{
+  double worst = 0.0;
+  for (int i = 0; i < length; ++i)
+  {
+    double const scale = std::max(1.0, std::fabs(b[i]));
+    worst = std::max(worst, std::fabs(a[i] - b[i]) / scale);
+  }
+  return worst;
+}
+
+// Compare Model::ComputeEnsemble() with Model::Compute() of each member;
+// returns the number of neighbor list calls made by the ensemble compute
+long CheckEnsemble(std::string const & label,
+                   int const numberOfMembers,
+                   Member * const members,
+                   SimulatorData * const data)
+{
+  std::vector<Results> expected(numberOfMembers);
+  for (int m = 0; m < numberOfMembers; ++m)
+  {
+    if (members[m].model->Compute(members[m].computeArguments))
+      MY_ERROR("Compute");
+    expected[m] = members[m].results;
+  }
+
+  std::vector<KIM::Model *> models(numberOfMembers);
+  std::vector<KIM::ComputeArguments const *> computeArguments(
+      numberOfMembers);
+  for (int m = 0; m < numberOfMembers; ++m)
+  {
+    models[m] = members[m].model;
+    computeArguments[m] = members[m].computeArguments;
+  }
+  data->calls = 0;
+  std::cout << std::fixed;
+  if (KIM::Model::ComputeEnsemble(
+          numberOfMembers, &(models[0]), &(computeArguments[0])))
+    MY_ERROR("ComputeEnsemble");
+
+  for (int m = 0; m < numberOfMembers; ++m)
+  {
+    Results const & result = members[m].results;
+    double const worst = std::max(
+        std::max(Difference(&result.energy, &expected[m].energy, 1),
+                 Difference(result.forces,
+                            expected[m].forces,
+                            DIM * NUMBER_OF_PARTICLES)),
+        std::max(Difference(result.particleEnergy,
+                            expected[m].particleEnergy,
+                            NUMBER_OF_PARTICLES),
+                 Difference(result.virial, expected[m].virial, 6)));
+    std::cout << std::setw(24) << std::left << label << "member " << m
+              << "  energy " << std::setprecision(10) << std::setw(16)
+              << result.energy << "  largest difference " << std::scientific
+              << std::setprecision(2) << worst << std::fixed << std::endl;
+    if (worst > TOLERANCE)
+      MY_ERROR(label + ": ComputeEnsemble differs from Compute");
+  }
+  return data->calls;
+}
+}  // namespace
+
+
+int main()
+{
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  int particleContributing[NUMBER_OF_PARTICLES];
+  double coordinates[DIM * NUMBER_OF_PARTICLES];
+
+  // perturbed fcc block; the last few particles are padding
+  double const basis[4][DIM]
+      = {{0.0, 0.0, 0.0}, {0.5, 0.5, 0.0}, {0.5, 0.0, 0.5}, {0.0, 0.5, 0.5}};
+  unsigned int seed = 12345;
+  int n = 0;
+  for (int i = 0; i < CELLS; ++i)
+  {
+    for (int j = 0; j < CELLS; ++j)
+    {
+      for (int k = 0; k < CELLS; ++k)
+      {
+        for (int b = 0; b < 4; ++b)
+        {
+          int const cell[DIM] = {i, j, k};
+          for (int d = 0; d < DIM; ++d)
+          {
+            seed = 1103515245u * seed + 12345u;
+            double const jitter = 0.1 * ((seed >> 16) % 1000) / 1000.0 - 0.05;
+            coordinates[DIM * n + d]
+                = LATTICE_CONSTANT * (cell[d] + basis[b][d] + jitter);
+          }
+          particleContributing[n]
+              = (n < NUMBER_OF_PARTICLES - NUMBER_OF_NONCONTRIBUTING);
+          ++n;
+        }
+      }
+    }
+  }
+
+  SimulatorData data;
+  data.coordinates = coordinates;
+  data.calls = 0;
+
+  std::vector<Member> members(3);
+  for (int m = 0; m < 3; ++m)
+  {
+    CreateMember(&(members[m]),
+                 &data,
+                 &numberOfParticles,
+                 particleSpeciesCodes,
+                 particleContributing,
+                 coordinates);
+  }
+  // member 1 has other parameters but the same cutoffs; member 2's Ar-Ar
+  // cutoff is longer than the neighbor list cutoff of the others (the
+  // largest cutoff of all the model's species pairs), so it needs its own
+  // neighbor list
+  ScaleParameter(members[1].model, "epsilons", 1.5);
+  ScaleParameter(members[1].model, "sigmas", 0.9);
+  ScaleParameter(members[2].model, "cutoffs", 3.0);
+
+  long const fusedCalls
+      = CheckEnsemble("same cutoffs", 2, &(members[0]), &data);
+  // a fused evaluation asks once per contributing particle for all members
+  if (fusedCalls != NUMBER_OF_PARTICLES - NUMBER_OF_NONCONTRIBUTING)
+    MY_ERROR("ComputeEnsemble did not evaluate the members together");
+
+  CheckEnsemble("different cutoffs", 3, &(members[0]), &data);
+
+  // an empty ensemble is an error
+  if (!KIM::Model::ComputeEnsemble(0, NULL, NULL))
+    MY_ERROR("ComputeEnsemble accepted an empty ensemble");
+
+  for (int m = 0; m < 3; ++m) DestroyMember(&(members[m]));
+
+  return 0;
+}
@@ -39,6 +39,7 @@
 #define FCCSPACING 5.260
 #define DIM 3
 #define NCELLSPERSIDE 2
+#define MAX_NUMBER_OF_NEIGHBOR_LISTS 10
 #define NCLUSTERPARTS                                  \
   (4 * (NCELLSPERSIDE * NCELLSPERSIDE * NCELLSPERSIDE) \
    + 6 * (NCELLSPERSIDE * NCELLSPERSIDE) + 3 * (NCELLSPERSIDE) + 1)
@@ -57,20 +58,37 @@
   }
 
 
-/* Define neighborlist structure */
+/* Define neighborlist structure                                        */
+/* A single master list, sorted by distance, is stored for each particle. */
+/* The list for each cutoff is a prefix of the master list whose length   */
+/* is NNeighbors[i * numberOfNeighborLists + k].                          */
 typedef struct
 {
-  double cutoff;
+  int numberOfNeighborLists;
+  double cutoffs[MAX_NUMBER_OF_NEIGHBOR_LISTS];
   int numberOfParticles;
   int * NNeighbors;
   int * neighborList;
+  double * displacements;
+  double * squaredDistances;
 } NeighList;
 
+/* Define species pair cutoffs structure (optionally provided by the model) */
+typedef struct
+{
+  int numberOfSpeciesCodes;
+  double const * cutoffs;
+  int const * particleSpecies;
+} SpeciesPairCutoffs;
+
 /* Define prototypes */
 void fcc_cluster_neighborlist(int half,
                               int numberOfParticles,
                               double * coords,
-                              double cutoff,
+                              int numberOfNeighborLists,
+                              double const * cutoffs,
+                              double cutpad,
+                              SpeciesPairCutoffs const * spc,
                               NeighList * nl);
 
 int get_cluster_neigh(void * const dataObject,
@@ -81,6 +99,24 @@ int get_cluster_neigh(void * const dataObject,
                       int * const numberOfNeighbors,
                       int const ** const neighborsOfParticle);
 
+int get_cluster_neigh_with_displacements(
+    void * const dataObject,
+    int const numberOfNeighborLists,
+    double const * const cutoffs,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors);
+
+int get_cluster_nested_neigh(void * const dataObject,
+                             int const numberOfNeighborLists,
+                             double const * const cutoffs,
+                             int const particleNumber,
+                             int * const numberOfNeighbors,
+                             int const ** const neighborsOfParticle);
+
 void create_FCC_cluster(double FCCspacing, int nCellsPerSide, double * coords);
 
 void compute_loop(double const MinSpacing,
@@ -88,7 +124,9 @@ void compute_loop(double const MinSpacing,
                   double const SpacingIncr,
                   int const numberOfParticles_cluster,
                   double * const coords_cluster,
-                  double const cutoff,
+                  int const numberOfNeighborLists,
+                  double const * const cutoffs,
+                  SpeciesPairCutoffs const * const spc,
                   NeighList * nl,
                   KIM::Model const * const kim_cluster_model,
                   KIM::ComputeArguments const * const computeArguments,
@@ -117,6 +155,7 @@ int main()
   double influence_distance_cluster_model;
   int number_of_neighbor_lists;
   double const * cutoff_cluster_model;
+  SpeciesPairCutoffs spc_cluster_model;
   double energy_cluster_model;
   double forces_cluster[NCLUSTERPARTS * DIM];
 
@@ -346,6 +385,38 @@ int main()
       &nl_cluster_model);
   if (error) MY_ERROR("set_call_back");
 
+  /* provide the pair displacements, if the model can use them */
+  KIM::SupportStatus displacementsSupportStatus;
+  error = computeArguments->GetCallbackSupportStatus(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+      &displacementsSupportStatus);
+  if (error) MY_ERROR("get_callback_support_status");
+  if (displacementsSupportStatus != KIM::SUPPORT_STATUS::notSupported)
+  {
+    error = computeArguments->SetCallbackPointer(
+        KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+        KIM::LANGUAGE_NAME::cpp,
+        (KIM::Function *) &get_cluster_neigh_with_displacements,
+        &nl_cluster_model);
+    if (error) MY_ERROR("set_call_back");
+  }
+
+  /* provide all lists at once, if the model can use them */
+  KIM::SupportStatus nestedSupportStatus;
+  error = computeArguments->GetCallbackSupportStatus(
+      KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists,
+      &nestedSupportStatus);
+  if (error) MY_ERROR("get_callback_support_status");
+  if (nestedSupportStatus != KIM::SUPPORT_STATUS::notSupported)
+  {
+    error = computeArguments->SetCallbackPointer(
+        KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists,
+        KIM::LANGUAGE_NAME::cpp,
+        (KIM::Function *) &get_cluster_nested_neigh,
+        &nl_cluster_model);
+    if (error) MY_ERROR("set_call_back");
+  }
+
   kim_cluster_model->GetInfluenceDistance(&influence_distance_cluster_model);
   int const * modelWillNotRequestNeighborsOfNoncontributingParticles;
   kim_cluster_model->GetNeighborListPointers(
@@ -367,7 +438,19 @@ int main()
               << std::endl;
   }
   // ignoring hints from here on...
-  if (number_of_neighbor_lists != 1) MY_ERROR("too many neighbor lists");
+  if (number_of_neighbor_lists > MAX_NUMBER_OF_NEIGHBOR_LISTS)
+    MY_ERROR("too many neighbor lists");
+
+  // use species pair cutoffs, if provided, to omit noninteracting pairs
+  kim_cluster_model->GetSpeciesPairCutoffsPointer(
+      &spc_cluster_model.numberOfSpeciesCodes, &spc_cluster_model.cutoffs);
+  spc_cluster_model.particleSpecies = particleSpecies_cluster_model;
+  if (spc_cluster_model.cutoffs != NULL)
+  {
+    std::cout << "Model has species pair cutoffs for "
+              << spc_cluster_model.numberOfSpeciesCodes << " species codes"
+              << std::endl;
+  }
 
   /* setup particleSpecies */
   int isSpeciesSupported;
@@ -385,12 +468,21 @@ int main()
   /* setup neighbor lists */
   /* allocate memory for list */
   nl_cluster_model.numberOfParticles = NCLUSTERPARTS;
-  nl_cluster_model.NNeighbors = new int[NCLUSTERPARTS];
+  nl_cluster_model.NNeighbors
+      = new int[NCLUSTERPARTS * MAX_NUMBER_OF_NEIGHBOR_LISTS];
   if (NULL == nl_cluster_model.NNeighbors) MY_ERROR("new unsuccessful");
 
   nl_cluster_model.neighborList = new int[NCLUSTERPARTS * NCLUSTERPARTS];
   if (NULL == nl_cluster_model.neighborList) MY_ERROR("new unsuccessful");
 
+  nl_cluster_model.displacements
+      = new double[NCLUSTERPARTS * NCLUSTERPARTS * DIM];
+  if (NULL == nl_cluster_model.displacements) MY_ERROR("new unsuccessful");
+
+  nl_cluster_model.squaredDistances = new double[NCLUSTERPARTS * NCLUSTERPARTS];
+  if (NULL == nl_cluster_model.squaredDistances)
+    MY_ERROR("new unsuccessful");
+
   /* ready to compute */
   std::ios oldState(NULL);
   oldState.copyfmt(std::cout);
@@ -405,7 +497,9 @@ int main()
                SpacingIncr,
                numberOfParticles_cluster,
                &(coords_cluster[0][0]),
-               *cutoff_cluster_model,
+               number_of_neighbor_lists,
+               cutoff_cluster_model,
+               &spc_cluster_model,
                &nl_cluster_model,
                kim_cluster_model,
                computeArguments,
@@ -445,13 +539,17 @@ int main()
           &number_of_neighbor_lists,
           &cutoff_cluster_model,
           &modelWillNotRequestNeighborsOfNoncontributingParticles);
+      kim_cluster_model->GetSpeciesPairCutoffsPointer(
+          &spc_cluster_model.numberOfSpeciesCodes, &spc_cluster_model.cutoffs);
 
       compute_loop(MinSpacing,
                    MaxSpacing,
                    SpacingIncr,
                    numberOfParticles_cluster,
                    &(coords_cluster[0][0]),
-                   *cutoff_cluster_model,
+                   number_of_neighbor_lists,
+                   cutoff_cluster_model,
+                   &spc_cluster_model,
                    &nl_cluster_model,
                    kim_cluster_model,
                    computeArguments,
@@ -480,6 +578,8 @@ int main()
   /* free memory of neighbor lists */
   delete[] nl_cluster_model.NNeighbors;
   delete[] nl_cluster_model.neighborList;
+  delete[] nl_cluster_model.displacements;
+  delete[] nl_cluster_model.squaredDistances;
 
   /* everything is great */
   std::cout.copyfmt(oldState);
@@ -491,7 +591,9 @@ void compute_loop(double const MinSpacing,
                   double const SpacingIncr,
                   int const numberOfParticles_cluster,
                   double * const coords_cluster,
-                  double const cutoff,
+                  int const numberOfNeighborLists,
+                  double const * const cutoffs,
+                  SpeciesPairCutoffs const * const spc,
                   NeighList * nl,
                   KIM::Model const * const kim_cluster_model,
                   KIM::ComputeArguments const * const computeArguments,
@@ -508,8 +610,14 @@ void compute_loop(double const MinSpacing,
     /* update coordinates for cluster */
     create_FCC_cluster(CurrentSpacing, NCELLSPERSIDE, coords_cluster);
     /* compute neighbor lists */
-    fcc_cluster_neighborlist(
-        0, NCLUSTERPARTS, coords_cluster, (cutoff + cutpad), nl);
+    fcc_cluster_neighborlist(0,
+                             NCLUSTERPARTS,
+                             coords_cluster,
+                             numberOfNeighborLists,
+                             cutoffs,
+                             cutpad,
+                             spc,
+                             nl);
 
     /* call compute functions */
     int error = kim_cluster_model->Compute(computeArguments);
@@ -640,25 +748,43 @@ void create_FCC_cluster(double FCCspacing, int nCellsPerSide, double * coords)
 void fcc_cluster_neighborlist(int half,
                               int numberOfParticles,
                               double * coords,
-                              double cutoff,
+                              int numberOfNeighborLists,
+                              double const * cutoffs,
+                              double cutpad,
+                              SpeciesPairCutoffs const * spc,
                               NeighList * nl)
 {
   /* local variables */
   int i;
   int j;
   int k;
+  int l;
   int a;
+  int b;
 
   double dx[DIM];
   double r2;
   double cutoff2;
+  double maxCutoff;
+  double listCutoff2[MAX_NUMBER_OF_NEIGHBOR_LISTS];
 
-  nl->cutoff = cutoff;
+  nl->numberOfNeighborLists = numberOfNeighborLists;
+  maxCutoff = 0.0;
+  for (l = 0; l < numberOfNeighborLists; ++l)
+  {
+    nl->cutoffs[l] = cutoffs[l] + cutpad;
+    listCutoff2[l] = nl->cutoffs[l] * nl->cutoffs[l];
+    if (cutoffs[l] > maxCutoff) maxCutoff = cutoffs[l];
+  }
 
-  cutoff2 = cutoff * cutoff;
+  cutoff2 = (maxCutoff + cutpad) * (maxCutoff + cutpad);
 
   for (i = 0; i < numberOfParticles; ++i)
   {
+    int * const list = &((*nl).neighborList[i * NCLUSTERPARTS]);
+    double * const dxs = &((*nl).displacements[i * NCLUSTERPARTS * DIM]);
+    double * const r2s = &((*nl).squaredDistances[i * NCLUSTERPARTS]);
+
     a = 0;
     for (j = 0; j < numberOfParticles; ++j)
     {
@@ -669,18 +795,47 @@ void fcc_cluster_neighborlist(int half,
         r2 += dx[k] * dx[k];
       }
 
+      if ((spc != NULL) && (spc->cutoffs != NULL))
+      {
+        /* use the largest of the model's cutoffs for this pair of species */
+        int const n = spc->numberOfSpeciesCodes;
+        double pairCutoff = 0.0;
+        for (l = 0; l < numberOfNeighborLists; ++l)
+        {
+          double const c = spc->cutoffs[(l * n + spc->particleSpecies[i]) * n
+                                        + spc->particleSpecies[j]];
+          if (c > pairCutoff) pairCutoff = c;
+        }
+        pairCutoff += cutpad;
+        cutoff2 = pairCutoff * pairCutoff;
+      }
+
       if (r2 < cutoff2)
       {
         if ((half && i < j) || (!half && i != j))
         {
-          /* part j is a neighbor of part i */
-          (*nl).neighborList[i * NCLUSTERPARTS + a] = j;
+          /* part j is a neighbor of part i; insert it by distance */
+          for (b = a; (b > 0) && (r2s[b - 1] > r2); --b)
+          {
+            list[b] = list[b - 1];
+            for (k = 0; k < DIM; ++k)
+              dxs[b * DIM + k] = dxs[(b - 1) * DIM + k];
+            r2s[b] = r2s[b - 1];
+          }
+          list[b] = j;
+          for (k = 0; k < DIM; ++k) dxs[b * DIM + k] = dx[k];
+          r2s[b] = r2;
           a++;
         }
       }
     }
-    /* part i has `a' neighbors */
-    (*nl).NNeighbors[i] = a;
+
+    /* the list for each cutoff is the prefix of neighbors within it */
+    for (l = 0; l < numberOfNeighborLists; ++l)
+    {
+      for (b = 0; (b < a) && (r2s[b] < listCutoff2[l]); ++b) {}
+      (*nl).NNeighbors[i * numberOfNeighborLists + l] = b;
+    }
   }
 
   return;
@@ -699,9 +854,13 @@ int get_cluster_neigh(void * const dataObject,
   NeighList * nl = (NeighList *) dataObject;
   int numberOfParticles = nl->numberOfParticles;
 
-  if ((numberOfNeighborLists != 1) || (cutoffs[0] > nl->cutoff)) return error;
+  if ((numberOfNeighborLists != nl->numberOfNeighborLists)
+      || (neighborListIndex < 0)
+      || (neighborListIndex >= numberOfNeighborLists))
+    return error;
 
-  if (neighborListIndex != 0) return error;
+  if (cutoffs[neighborListIndex] > nl->cutoffs[neighborListIndex])
+    return error;
 
   /* initialize numNeigh */
   *numberOfNeighbors = 0;
@@ -714,7 +873,8 @@ int get_cluster_neigh(void * const dataObject,
   }
 
   /* set the returned number of neighbors for the returned part */
-  *numberOfNeighbors = (*nl).NNeighbors[particleNumber];
+  *numberOfNeighbors = (*nl).NNeighbors[particleNumber * numberOfNeighborLists
+                                        + neighborListIndex];
 
   /* set the location for the returned neighbor list */
   *neighborsOfParticle
@@ -722,3 +882,62 @@ int get_cluster_neigh(void * const dataObject,
 
   return false;
 }
+
+int get_cluster_neigh_with_displacements(
+    void * const dataObject,
+    int const numberOfNeighborLists,
+    double const * const cutoffs,
+    int const neighborListIndex,
+    int const particleNumber,
+    int * const numberOfNeighbors,
+    int const ** const neighborsOfParticle,
+    double const ** const displacementsOfNeighbors,
+    double const ** const squaredDistancesOfNeighbors)
+{
+  NeighList * nl = (NeighList *) dataObject;
+
+  int error = get_cluster_neigh(dataObject,
+                                numberOfNeighborLists,
+                                cutoffs,
+                                neighborListIndex,
+                                particleNumber,
+                                numberOfNeighbors,
+                                neighborsOfParticle);
+  if (error) return error;
+
+  /* the displacements and squared distances are stored alongside the list */
+  *displacementsOfNeighbors
+      = &((*nl).displacements[particleNumber * nl->numberOfParticles * DIM]);
+  *squaredDistancesOfNeighbors
+      = &((*nl).squaredDistances[particleNumber * nl->numberOfParticles]);
+
+  return false;
+}
+
+int get_cluster_nested_neigh(void * const dataObject,
+                             int const numberOfNeighborLists,
+                             double const * const cutoffs,
+                             int const particleNumber,
+                             int * const numberOfNeighbors,
+                             int const ** const neighborsOfParticle)
+{
+  NeighList * nl = (NeighList *) dataObject;
+
+  /* every list is a prefix of the master list returned for list 0 */
+  for (int l = 0; l < numberOfNeighborLists; ++l)
+  {
+    int error = get_cluster_neigh(dataObject,
+                                  numberOfNeighborLists,
+                                  cutoffs,
+                                  l,
+                                  particleNumber,
+                                  &(numberOfNeighbors[l]),
+                                  neighborsOfParticle);
+    if (error) return error;
+  }
+  if (numberOfNeighborLists == 0)
+    *neighborsOfParticle
+        = &((*nl).neighborList[particleNumber * nl->numberOfParticles]);
+
+  return false;
+}
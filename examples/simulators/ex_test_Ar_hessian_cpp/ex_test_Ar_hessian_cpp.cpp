@@ -0,0 +1,333 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DIM 3
+#define CELLS 2  // fcc unit cells along each direction
+#define NUMBER_OF_PARTICLES (4 * CELLS * CELLS * CELLS)
+#define NUMBER_OF_NONCONTRIBUTING 3
+#define LATTICE_CONSTANT 5.26
+#define LJ_CUTOFF 5.0
+#define STEP 1.0e-4
+#define TOLERANCE 1.0e-6
+#define MODEL_NAME "LennardJones612_UniversalShifted__MO_959249795837_003"
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+struct SimulatorData
+{
+  double const * coordinates;
+  std::vector<int> neighbors;
+};
+
+double DistanceSquared(double const * const coordinates,
+                       int const i,
+                       int const j)
+{
+  double r2 = 0.0;
+  for (int k = 0; k < DIM; ++k)
+  {
+    double const dx = coordinates[DIM * j + k] - coordinates[DIM * i + k];
+    r2 += dx * dx;
+  }
+  return r2;
+}
+
+// full neighbor list of all particles within the requested cutoff
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const cutoffs,
+                    int const neighborListIndex,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+  double const cutoffSquared
+      = cutoffs[neighborListIndex] * cutoffs[neighborListIndex];
+
+  data->neighbors.clear();
+  for (int j = 0; j < NUMBER_OF_PARTICLES; ++j)
+  {
+    if ((j != particleNumber)
+        && (DistanceSquared(data->coordinates, particleNumber, j)
+            <= cutoffSquared))
+      data->neighbors.push_back(j);
+  }
+  *numberOfNeighbors = static_cast<int>(data->neighbors.size());
+  *neighborsOfParticle = (*numberOfNeighbors > 0) ? &(data->neighbors[0]) : 0;
+  return false;
+}
+
+// Set every element of a double parameter to value
+void SetParameter(KIM::Model * const model,
+                  std::string const & name,
+                  double const value)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    int extent;
+    std::string const * parameterName;
+    if (model->GetParameterMetadata(
+            i, &dataType, &extent, &parameterName, NULL))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName != name) continue;
+
+    for (int j = 0; j < extent; ++j)
+    {
+      if (model->SetParameter(i, j, value))
+        MY_ERROR("Unable to set parameter " + name);
+    }
+    if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+    return;
+  }
+  MY_ERROR("Unable to find parameter " + name);
+}
+}  // namespace
+
+
+int main()
+{
+  int particleContributing[NUMBER_OF_PARTICLES];
+  double coordinates[DIM * NUMBER_OF_PARTICLES];
+
+  // perturbed fcc block; the last few particles are padding
+  double const basis[4][DIM]
+      = {{0.0, 0.0, 0.0}, {0.5, 0.5, 0.0}, {0.5, 0.0, 0.5}, {0.0, 0.5, 0.5}};
+  unsigned int seed = 12345;
+  int n = 0;
+  for (int i = 0; i < CELLS; ++i)
+  {
+    for (int j = 0; j < CELLS; ++j)
+    {
+      for (int k = 0; k < CELLS; ++k)
+      {
+        for (int b = 0; b < 4; ++b)
+        {
+          int const cell[DIM] = {i, j, k};
+          for (int d = 0; d < DIM; ++d)
+          {
+            seed = 1103515245u * seed + 12345u;
+            double const jitter = 0.1 * ((seed >> 16) % 1000) / 1000.0 - 0.05;
+            coordinates[DIM * n + d]
+                = LATTICE_CONSTANT * (cell[d] + basis[b][d] + jitter);
+          }
+          particleContributing[n]
+              = (n < NUMBER_OF_PARTICLES - NUMBER_OF_NONCONTRIBUTING);
+          ++n;
+        }
+      }
+    }
+  }
+
+  KIM::Model * model;
+  int requestedUnitsAccepted;
+  if (KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                         KIM::LENGTH_UNIT::A,
+                         KIM::ENERGY_UNIT::eV,
+                         KIM::CHARGE_UNIT::unused,
+                         KIM::TEMPERATURE_UNIT::unused,
+                         KIM::TIME_UNIT::unused,
+                         MODEL_NAME,
+                         &requestedUnitsAccepted,
+                         &model))
+    MY_ERROR("KIM::Model::Create()");
+  // a cutoff shorter than the block, so that the pattern is sparse
+  SetParameter(model, "cutoffs", LJ_CUTOFF);
+
+  int speciesIsSupported;
+  int speciesCode;
+  if (model->GetSpeciesSupportAndCode(
+          KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode)
+      || (!speciesIsSupported))
+    MY_ERROR("Species Ar not supported");
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+    particleSpeciesCodes[i] = speciesCode;
+
+  // upper blocks of the pairs within the cutoff, and the diagonal
+  std::vector<int> rowOffsets(1, 0);
+  std::vector<int> columnIndices;
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    for (int j = i; j < NUMBER_OF_PARTICLES; ++j)
+    {
+      if ((j == i)
+          || (DistanceSquared(coordinates, i, j) < LJ_CUTOFF * LJ_CUTOFF))
+        columnIndices.push_back(j);
+    }
+    rowOffsets.push_back(static_cast<int>(columnIndices.size()));
+  }
+  int const numberOfBlocks = static_cast<int>(columnIndices.size());
+  std::vector<double> blocks(9 * numberOfBlocks);
+
+  KIM::ComputeArguments * computeArguments;
+  if (model->ComputeArgumentsCreate(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+
+  KIM::SupportStatus supportStatus;
+  computeArguments->GetArgumentSupportStatus(
+      KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks, &supportStatus);
+  if (supportStatus != KIM::SUPPORT_STATUS::optional)
+    MY_ERROR("partialHessianBlocks is not supported");
+
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  double forces[DIM * NUMBER_OF_PARTICLES];
+  SimulatorData data;
+  data.coordinates = coordinates;
+  int error = computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                  &numberOfParticles)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                  particleSpeciesCodes)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                  particleContributing)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinates, coordinates)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForces, forces)
+              || computeArguments->SetCallbackPointer(
+                  KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+                  KIM::LANGUAGE_NAME::cpp,
+                  reinterpret_cast<KIM::Function *>(GetNeighborList),
+                  &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  // dense Hessian from central differences of the forces
+  int const numberOfCoordinates = DIM * NUMBER_OF_PARTICLES;
+  std::vector<double> dense(numberOfCoordinates * numberOfCoordinates);
+  for (int a = 0; a < numberOfCoordinates; ++a)
+  {
+    double forcesPlus[DIM * NUMBER_OF_PARTICLES];
+    double const saved = coordinates[a];
+    coordinates[a] = saved + STEP;
+    if (model->Compute(computeArguments)) MY_ERROR("Compute");
+    std::copy(forces, forces + numberOfCoordinates, forcesPlus);
+    coordinates[a] = saved - STEP;
+    if (model->Compute(computeArguments)) MY_ERROR("Compute");
+    coordinates[a] = saved;
+    for (int b = 0; b < numberOfCoordinates; ++b)
+    {
+      dense[a * numberOfCoordinates + b]
+          = -(forcesPlus[b] - forces[b]) / (2.0 * STEP);
+    }
+  }
+
+  // the sparse blocks; poison them, every block must be written
+  std::fill(blocks.begin(), blocks.end(), 1.0e300);
+  error = computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+              &(rowOffsets[0]))
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+              &(columnIndices[0]))
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks,
+              &(blocks[0]));
+  if (error) MY_ERROR("Unable to set the Hessian arguments");
+  if (model->Compute(computeArguments)) MY_ERROR("Compute");
+
+  // expand the upper blocks into a dense symmetric matrix
+  std::vector<double> sparse(numberOfCoordinates * numberOfCoordinates, 0.0);
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    for (int p = rowOffsets[i]; p < rowOffsets[i + 1]; ++p)
+    {
+      int const j = columnIndices[p];
+      for (int k = 0; k < DIM; ++k)
+      {
+        for (int l = 0; l < DIM; ++l)
+        {
+          double const value = blocks[9 * p + DIM * k + l];
+          sparse[(DIM * i + k) * numberOfCoordinates + DIM * j + l] = value;
+          sparse[(DIM * j + l) * numberOfCoordinates + DIM * i + k] = value;
+        }
+      }
+    }
+  }
+
+  double maximum = 0.0;
+  double maximumError = 0.0;
+  for (int a = 0; a < numberOfCoordinates * numberOfCoordinates; ++a)
+  {
+    maximum = std::max(maximum, std::fabs(dense[a]));
+    maximumError = std::max(maximumError, std::fabs(sparse[a] - dense[a]));
+  }
+  std::cout << "blocks " << numberOfBlocks << " of "
+            << NUMBER_OF_PARTICLES * (NUMBER_OF_PARTICLES + 1) / 2
+            << std::endl;
+  std::cout << std::scientific << std::setprecision(3)
+            << "max |H|                " << maximum << std::endl
+            << "max |H_sparse - H_fd|  " << maximumError << std::endl;
+  if (!(maximumError <= TOLERANCE * maximum))
+    MY_ERROR("Sparse Hessian does not match finite differences");
+
+  // a pattern without a needed block is an error
+  std::vector<int> rowOffsetsMissing(rowOffsets);
+  std::vector<int> columnIndicesMissing(columnIndices);
+  columnIndicesMissing.erase(columnIndicesMissing.begin() + 1);
+  for (int i = 1; i <= NUMBER_OF_PARTICLES; ++i) --rowOffsetsMissing[i];
+  error = computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+              &(rowOffsetsMissing[0]))
+          || computeArguments->SetArgumentPointer(
+              KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+              &(columnIndicesMissing[0]));
+  if (error) MY_ERROR("Unable to set the Hessian arguments");
+  if (!model->Compute(computeArguments))
+    MY_ERROR("Compute accepted a pattern without a needed block");
+  std::cout << "missing block reported" << std::endl;
+
+  if (model->ComputeArgumentsDestroy(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  KIM::Model::Destroy(&model);
+
+  return 0;
+}
@@ -0,0 +1,254 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DIM 3
+#define NUMBER_OF_PARTICLES 4
+#define MODEL_NAME "LennardJones612_UniversalShifted__MO_959249795837_003"
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+// a slightly distorted Ar tetrahedron
+double const coordinates[NUMBER_OF_PARTICLES][DIM] = {{0.0, 0.0, 0.0},
+                                                       {3.8, 0.1, 0.0},
+                                                       {1.9, 3.3, -0.1},
+                                                       {1.8, 1.1, 3.2}};
+
+struct SimulatorData
+{
+  std::vector<int> neighbors;
+};
+
+// full neighbor list of all other particles; they are all within the
+// influence distance
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const /* cutoffs */,
+                    int const /* neighborListIndex */,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+
+  data->neighbors.clear();
+  for (int j = 0; j < NUMBER_OF_PARTICLES; ++j)
+  {
+    if (j != particleNumber) data->neighbors.push_back(j);
+  }
+  *numberOfNeighbors = static_cast<int>(data->neighbors.size());
+  *neighborsOfParticle = &(data->neighbors[0]);
+  return false;
+}
+
+double Energy(KIM::Model * const model)
+{
+  int speciesIsSupported;
+  int speciesCode;
+  if (model->GetSpeciesSupportAndCode(
+          KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode)
+      || (!speciesIsSupported))
+    MY_ERROR("Species Ar not supported");
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  int particleContributing[NUMBER_OF_PARTICLES];
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    particleSpeciesCodes[i] = speciesCode;
+    particleContributing[i] = 1;
+  }
+
+  KIM::ComputeArguments * computeArguments;
+  if (model->ComputeArgumentsCreate(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  double energy;
+  SimulatorData data;
+  int error = computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                  &numberOfParticles)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                  particleSpeciesCodes)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                  particleContributing)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinates,
+                  &(coordinates[0][0]))
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energy)
+              || computeArguments->SetCallbackPointer(
+                  KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+                  KIM::LANGUAGE_NAME::cpp,
+                  reinterpret_cast<KIM::Function *>(GetNeighborList),
+                  &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  if (model->Compute(computeArguments)) MY_ERROR("Compute");
+
+  if (model->ComputeArgumentsDestroy(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  return energy;
+}
+
+// Index of a parameter, and the offset of its elements in the parameter
+// vector (which holds the double parameters in order)
+void FindParameter(KIM::Model * const model,
+                   std::string const & name,
+                   int * const parameterIndex,
+                   int * const extent,
+                   int * const vectorOffset)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  *vectorOffset = 0;
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    std::string const * parameterName;
+    if (model->GetParameterMetadata(
+            i, &dataType, extent, &parameterName, NULL))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName == name)
+    {
+      *parameterIndex = i;
+      return;
+    }
+    if (dataType == KIM::DATA_TYPE::Double) *vectorOffset += *extent;
+  }
+  MY_ERROR("Unable to find parameter " + name);
+}
+
+void CheckEnergy(char const * const label,
+                 double const energy,
+                 double const expected)
+{
+  std::cout << std::setw(40) << std::left << label << std::setprecision(12)
+            << energy << " (expected " << expected << ")" << std::endl;
+  if (std::fabs(energy - expected) > 1e-12 * std::fabs(expected))
+    MY_ERROR(std::string("Wrong energy after ") + label);
+}
+}  // namespace
+
+
+int main()
+{
+  KIM::Model * model;
+  int requestedUnitsAccepted;
+  if (KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                         KIM::LENGTH_UNIT::A,
+                         KIM::ENERGY_UNIT::eV,
+                         KIM::CHARGE_UNIT::unused,
+                         KIM::TEMPERATURE_UNIT::unused,
+                         KIM::TIME_UNIT::unused,
+                         MODEL_NAME,
+                         &requestedUnitsAccepted,
+                         &model))
+    MY_ERROR("KIM::Model::Create()");
+
+  double const energy = Energy(model);
+
+  int epsilonsIndex;
+  int extent;
+  int vectorOffset;
+  FindParameter(model, "epsilons", &epsilonsIndex, &extent, &vectorOffset);
+  std::vector<double> epsilons(extent);
+  if (model->GetParameterArray(epsilonsIndex, 0, extent, &(epsilons[0])))
+    MY_ERROR("GetParameterArray");
+
+  // every element changed through the parameter vector (a bulk set)
+  int vectorSize;
+  model->GetParameterVectorSize(&vectorSize);
+  std::vector<double> vector(vectorSize);
+  if (model->GetParameterVector(vectorSize, &(vector[0])))
+    MY_ERROR("GetParameterVector");
+  for (int i = 0; i < extent; ++i) vector[vectorOffset + i] *= 2.0;
+  if (!model->SetParameterVector(vectorSize - 1, &(vector[0])))
+    MY_ERROR("SetParameterVector accepted a wrong size");
+  if (model->SetParameterVector(vectorSize, &(vector[0])))
+    MY_ERROR("SetParameterVector");
+  if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+  CheckEnergy("SetParameterVector", Energy(model), 2.0 * energy);
+
+  // every element changed through one array set
+  if (model->SetParameterArray(epsilonsIndex, 0, extent, &(epsilons[0]))
+      || model->ClearThenRefresh())
+    MY_ERROR("SetParameterArray");
+  CheckEnergy("SetParameterArray (whole array)", Energy(model), energy);
+
+  // every element changed one at a time, twice
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (int i = 0; i < extent; ++i)
+    {
+      if (model->SetParameter(epsilonsIndex, i, 3.0 * epsilons[i]))
+        MY_ERROR("SetParameter");
+    }
+  }
+  if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+  CheckEnergy("SetParameter (every element)", Energy(model), 3.0 * energy);
+
+  // two elements at a time changed through array sets
+  if (model->SetParameterArray(epsilonsIndex, 0, extent, &(epsilons[0]))
+      || model->ClearThenRefresh())
+    MY_ERROR("SetParameterArray");
+  std::vector<double> scaled(extent);
+  for (int i = 0; i < extent; ++i) scaled[i] = 4.0 * epsilons[i];
+  for (int i = 0; i < extent; i += 2)
+  {
+    int const count = (i + 2 <= extent) ? 2 : 1;
+    if (model->SetParameterArray(epsilonsIndex, i, count, &(scaled[i])))
+      MY_ERROR("SetParameterArray");
+    if ((i % 1000) == 0)
+    {  // refresh part way through, so that each refresh sees a partial set
+      if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+    }
+  }
+  if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+  CheckEnergy("SetParameterArray (pairs)", Energy(model), 4.0 * energy);
+
+  KIM::Model::Destroy(&model);
+  return 0;
+}
@@ -0,0 +1,295 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define DIM 3
+#define CELLS 3  // fcc unit cells along each direction
+#define NUMBER_OF_PARTICLES (4 * CELLS * CELLS * CELLS)
+#define NUMBER_OF_NONCONTRIBUTING 10
+#define LATTICE_CONSTANT 5.26
+#define LJ_CUTOFF 7.0
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+struct SimulatorData
+{
+  double const * coordinates;
+  std::vector<int> neighbors;
+};
+
+// full neighbor list of all particles within the requested cutoff
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const cutoffs,
+                    int const neighborListIndex,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+  double const cutoffSquared
+      = cutoffs[neighborListIndex] * cutoffs[neighborListIndex];
+  double const * const xi = &(data->coordinates[DIM * particleNumber]);
+
+  data->neighbors.clear();
+  for (int j = 0; j < NUMBER_OF_PARTICLES; ++j)
+  {
+    if (j == particleNumber) continue;
+    double r2 = 0.0;
+    for (int k = 0; k < DIM; ++k)
+    {
+      double const dx = data->coordinates[DIM * j + k] - xi[k];
+      r2 += dx * dx;
+    }
+    if (r2 <= cutoffSquared) data->neighbors.push_back(j);
+  }
+  *numberOfNeighbors = static_cast<int>(data->neighbors.size());
+  *neighborsOfParticle = (*numberOfNeighbors > 0) ? &(data->neighbors[0]) : 0;
+  return false;
+}
+
+// Set every element of a double parameter to value
+void SetParameter(KIM::Model * const model,
+                  std::string const & name,
+                  double const value)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    int extent;
+    std::string const * parameterName;
+    if (model->GetParameterMetadata(
+            i, &dataType, &extent, &parameterName, NULL))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName != name) continue;
+
+    for (int j = 0; j < extent; ++j)
+    {
+      if (model->SetParameter(i, j, value))
+        MY_ERROR("Unable to set parameter " + name);
+    }
+    if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+    return;
+  }
+  MY_ERROR("Unable to find parameter " + name);
+}
+
+// Check the particle costs reported by a model against the number of pair
+// evaluations within the cutoff.  A model walking a full list charges each
+// evaluation to the contributing particle; one walking an effective half
+// list charges half of it to each contributing particle of the pair.
+void CheckModel(std::string const & modelName,
+                bool const halfList,
+                double const * const cutoff,
+                double const * const coordinates,
+                int const * const particleContributing)
+{
+  KIM::Model * model;
+  int requestedUnitsAccepted;
+  if (KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                         KIM::LENGTH_UNIT::A,
+                         KIM::ENERGY_UNIT::eV,
+                         KIM::CHARGE_UNIT::unused,
+                         KIM::TEMPERATURE_UNIT::unused,
+                         KIM::TIME_UNIT::unused,
+                         modelName,
+                         &requestedUnitsAccepted,
+                         &model))
+    MY_ERROR("KIM::Model::Create()");
+
+  double modelCutoff;
+  if (cutoff != NULL)
+  {
+    SetParameter(model, "cutoffs", *cutoff);
+    modelCutoff = *cutoff;
+  }
+  else
+  {
+    model->GetInfluenceDistance(&modelCutoff);
+  }
+
+  int speciesIsSupported;
+  int speciesCode;
+  if (model->GetSpeciesSupportAndCode(
+          KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode)
+      || (!speciesIsSupported))
+    MY_ERROR("Species Ar not supported");
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+    particleSpeciesCodes[i] = speciesCode;
+
+  KIM::ComputeArguments * computeArguments;
+  if (model->ComputeArgumentsCreate(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+
+  KIM::SupportStatus supportStatus;
+  computeArguments->GetArgumentSupportStatus(
+      KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost, &supportStatus);
+  if (supportStatus != KIM::SUPPORT_STATUS::optional)
+    MY_ERROR(modelName + " does not support partialParticleCost");
+
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  double energy;
+  double particleCost[NUMBER_OF_PARTICLES];
+  SimulatorData data;
+  data.coordinates = coordinates;
+  int error = computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                  &numberOfParticles)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                  particleSpeciesCodes)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                  particleContributing)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinates, coordinates)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energy)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost,
+                  particleCost)
+              || computeArguments->SetCallbackPointer(
+                  KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+                  KIM::LANGUAGE_NAME::cpp,
+                  reinterpret_cast<KIM::Function *>(GetNeighborList),
+                  &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  // poison the output, every element must be written
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i) particleCost[i] = -1.0;
+  if (model->Compute(computeArguments)) MY_ERROR("Compute");
+
+  double totalCost = 0.0;
+  double expectedTotal = 0.0;
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    double expected = 0.0;
+    for (int j = 0; (j < NUMBER_OF_PARTICLES) && particleContributing[i];
+         ++j)
+    {
+      if (j == i) continue;
+      double r2 = 0.0;
+      for (int k = 0; k < DIM; ++k)
+      {
+        double const dx = coordinates[DIM * j + k] - coordinates[DIM * i + k];
+        r2 += dx * dx;
+      }
+      if (r2 >= modelCutoff * modelCutoff) continue;
+      expected += (halfList && particleContributing[j]) ? 0.5 : 1.0;
+    }
+    if (particleCost[i] != expected)
+    {
+      std::cout << "particle " << i << ": cost " << particleCost[i]
+                << ", expected " << expected << std::endl;
+      MY_ERROR(modelName + " reports a wrong particle cost");
+    }
+    totalCost += particleCost[i];
+    expectedTotal += expected;
+  }
+
+  std::cout << std::setw(56) << std::left << modelName << "total cost "
+            << std::fixed << std::setprecision(1) << totalCost
+            << " (expected " << expectedTotal << ")" << std::endl;
+
+  if (model->ComputeArgumentsDestroy(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  KIM::Model::Destroy(&model);
+}
+}  // namespace
+
+
+int main()
+{
+  int particleContributing[NUMBER_OF_PARTICLES];
+  double coordinates[DIM * NUMBER_OF_PARTICLES];
+
+  // perturbed fcc block; the last few particles are padding
+  double const basis[4][DIM]
+      = {{0.0, 0.0, 0.0}, {0.5, 0.5, 0.0}, {0.5, 0.0, 0.5}, {0.0, 0.5, 0.5}};
+  unsigned int seed = 12345;
+  int n = 0;
+  for (int i = 0; i < CELLS; ++i)
+  {
+    for (int j = 0; j < CELLS; ++j)
+    {
+      for (int k = 0; k < CELLS; ++k)
+      {
+        for (int b = 0; b < 4; ++b)
+        {
+          int const cell[DIM] = {i, j, k};
+          for (int d = 0; d < DIM; ++d)
+          {
+            seed = 1103515245u * seed + 12345u;
+            double const jitter = 0.1 * ((seed >> 16) % 1000) / 1000.0 - 0.05;
+            coordinates[DIM * n + d]
+                = LATTICE_CONSTANT * (cell[d] + basis[b][d] + jitter);
+          }
+          particleContributing[n]
+              = (n < NUMBER_OF_PARTICLES - NUMBER_OF_NONCONTRIBUTING);
+          ++n;
+        }
+      }
+    }
+  }
+
+  // the LennardJones612 driver evaluates each pair once
+  double const ljCutoff = LJ_CUTOFF;
+  CheckModel("LennardJones612_UniversalShifted__MO_959249795837_003",
+             true,
+             &ljCutoff,
+             coordinates,
+             particleContributing);
+  // ex_model_driver_P_Morse walks a full list; its cutoff is its influence
+  // distance
+  CheckModel("ex_model_Ar_P_Morse",
+             false,
+             NULL,
+             coordinates,
+             particleContributing);
+
+  return 0;
+}
@@ -0,0 +1,333 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+#include "KIM_SimulatorHeaders.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#define DIM 3
+#define NUMBER_OF_PARTICLES 4
+#define NUMBER_OF_PROCESSES 4
+#define EPSILON_SCALE 2.0
+#define MODEL_NAME "LennardJones612_UniversalShifted__MO_959249795837_003"
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+// a slightly distorted Ar tetrahedron
+double const coordinates[NUMBER_OF_PARTICLES][DIM] = {{0.0, 0.0, 0.0},
+                                                       {3.8, 0.1, 0.0},
+                                                       {1.9, 3.3, -0.1},
+                                                       {1.8, 1.1, 3.2}};
+
+struct SimulatorData
+{
+  std::vector<int> neighbors;
+};
+
+// full neighbor list of all other particles; they are all within the
+// influence distance
+int GetNeighborList(void * const dataObject,
+                    int const /* numberOfNeighborLists */,
+                    double const * const /* cutoffs */,
+                    int const /* neighborListIndex */,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  SimulatorData * const data = static_cast<SimulatorData *>(dataObject);
+
+  data->neighbors.clear();
+  for (int j = 0; j < NUMBER_OF_PARTICLES; ++j)
+  {
+    if (j != particleNumber) data->neighbors.push_back(j);
+  }
+  *numberOfNeighbors = static_cast<int>(data->neighbors.size());
+  *neighborsOfParticle = &(data->neighbors[0]);
+  return false;
+}
+
+KIM::Model * CreateModel()
+{
+  KIM::Model * model;
+  int requestedUnitsAccepted;
+  if (KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                         KIM::LENGTH_UNIT::A,
+                         KIM::ENERGY_UNIT::eV,
+                         KIM::CHARGE_UNIT::unused,
+                         KIM::TEMPERATURE_UNIT::unused,
+                         KIM::TIME_UNIT::unused,
+                         MODEL_NAME,
+                         &requestedUnitsAccepted,
+                         &model))
+    MY_ERROR("KIM::Model::Create()");
+  return model;
+}
+
+double Energy(KIM::Model * const model)
+{
+  int speciesIsSupported;
+  int speciesCode;
+  if (model->GetSpeciesSupportAndCode(
+          KIM::SPECIES_NAME::Ar, &speciesIsSupported, &speciesCode)
+      || (!speciesIsSupported))
+    MY_ERROR("Species Ar not supported");
+  int particleSpeciesCodes[NUMBER_OF_PARTICLES];
+  int particleContributing[NUMBER_OF_PARTICLES];
+  for (int i = 0; i < NUMBER_OF_PARTICLES; ++i)
+  {
+    particleSpeciesCodes[i] = speciesCode;
+    particleContributing[i] = 1;
+  }
+
+  KIM::ComputeArguments * computeArguments;
+  if (model->ComputeArgumentsCreate(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsCreate()");
+
+  int numberOfParticles = NUMBER_OF_PARTICLES;
+  double energy;
+  SimulatorData data;
+  int error = computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                  &numberOfParticles)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                  particleSpeciesCodes)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                  particleContributing)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::coordinates, &(coordinates[0][0]))
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energy)
+              || computeArguments->SetCallbackPointer(
+                  KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+                  KIM::LANGUAGE_NAME::cpp,
+                  reinterpret_cast<KIM::Function *>(GetNeighborList),
+                  &data);
+  if (error) MY_ERROR("Unable to set compute arguments");
+
+  if (model->Compute(computeArguments)) MY_ERROR("Compute");
+
+  if (model->ComputeArgumentsDestroy(&computeArguments))
+    MY_ERROR("Model::ComputeArgumentsDestroy()");
+  return energy;
+}
+
+// Scale every epsilon; the driver has to stop using the shared tables
+void ScaleEpsilons(KIM::Model * const model)
+{
+  int numberOfParameters;
+  model->GetNumberOfParameters(&numberOfParameters);
+  for (int i = 0; i < numberOfParameters; ++i)
+  {
+    KIM::DataType dataType;
+    int extent;
+    std::string const * parameterName;
+    if (model->GetParameterMetadata(
+            i, &dataType, &extent, &parameterName, NULL))
+      MY_ERROR("GetParameterMetadata");
+    if (*parameterName != "epsilons") continue;
+
+    for (int j = 0; j < extent; ++j)
+    {
+      double epsilon;
+      if (model->GetParameter(i, j, &epsilon)
+          || model->SetParameter(i, j, EPSILON_SCALE * epsilon))
+        MY_ERROR("Unable to scale epsilons");
+    }
+    if (model->ClearThenRefresh()) MY_ERROR("ClearThenRefresh");
+    return;
+  }
+  MY_ERROR("Unable to find parameter epsilons");
+}
+
+// Number of KIM API shared-memory segments on the node
+int NumberOfSegments()
+{
+  int count = 0;
+  DIR * const directory = opendir("/dev/shm");
+  if (directory == NULL) MY_ERROR("Unable to read /dev/shm");
+  for (struct dirent * entry = readdir(directory); entry != NULL;
+       entry = readdir(directory))
+  {
+    if (std::strncmp(entry->d_name, "kim-", 4) == 0) ++count;
+  }
+  closedir(directory);
+  return count;
+}
+
+// Whether a process maps a KIM API shared-memory segment
+bool MapsSegment(pid_t const processID)
+{
+  std::ostringstream mapsName;
+  mapsName << "/proc/" << processID << "/maps";
+  std::ifstream maps(mapsName.str().c_str());
+  std::string line;
+  while (std::getline(maps, line))
+  {
+    if (line.find("/dev/shm/kim-") != std::string::npos) return true;
+  }
+  return false;
+}
+
+void WriteEnergy(int const fd, double const energy)
+{
+  if (write(fd, &energy, sizeof(energy)) != sizeof(energy))
+    MY_ERROR("Unable to write to the parent");
+}
+
+double ReadEnergy(int const fd)
+{
+  double energy;
+  if (read(fd, &energy, sizeof(energy)) != sizeof(energy))
+    MY_ERROR("Unable to read from a child");
+  return energy;
+}
+
+// Create the Model, report its energy, wait for the parent, then change the
+// parameters and report the energy again
+void RunChild(int const toParent, int const fromParent)
+{
+  KIM::Model * model = CreateModel();
+  WriteEnergy(toParent, Energy(model));
+
+  char go;
+  if (read(fromParent, &go, 1) != 1) MY_ERROR("Unable to read the parent");
+  ScaleEpsilons(model);
+  WriteEnergy(toParent, Energy(model));
+
+  KIM::Model::Destroy(&model);
+}
+
+void CheckEnergy(char const * const label,
+                 double const energy,
+                 double const expected)
+{
+  std::cout << std::setw(24) << std::left << label << std::setprecision(12)
+            << energy << " (expected " << expected << ")" << std::endl;
+  if (std::fabs(energy - expected) > 1e-12 * std::fabs(expected))
+    MY_ERROR(std::string("Wrong ") + label);
+}
+}  // namespace
+
+
+int main()
+{
+  // reference energies from private memory
+  setenv("KIM_API_SHARED_MEMORY", "0", 1);
+  KIM::Model * model = CreateModel();
+  double const energy = Energy(model);
+  ScaleEpsilons(model);
+  double const scaledEnergy = Energy(model);
+  KIM::Model::Destroy(&model);
+  if (std::fabs(scaledEnergy - EPSILON_SCALE * energy)
+      > 1e-12 * std::fabs(scaledEnergy))
+    MY_ERROR("Epsilons do not scale the energy");
+
+  // the same Model in several processes, sharing its pair tables
+  setenv("KIM_API_SHARED_MEMORY", "1", 1);
+  int const numberOfSegments = NumberOfSegments();
+  pid_t processIDs[NUMBER_OF_PROCESSES];
+  int toParent[NUMBER_OF_PROCESSES][2];
+  int fromParent[NUMBER_OF_PROCESSES][2];
+  std::cout.flush();
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+  {
+    if (pipe(toParent[p]) || pipe(fromParent[p])) MY_ERROR("pipe()");
+    processIDs[p] = fork();
+    if (processIDs[p] < 0) MY_ERROR("fork()");
+    if (processIDs[p] == 0)
+    {
+      close(toParent[p][0]);
+      close(fromParent[p][1]);
+      RunChild(toParent[p][1], fromParent[p][0]);
+      exit(0);
+    }
+    // so that a failed child reads as end of file
+    close(toParent[p][1]);
+    close(fromParent[p][0]);
+  }
+
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+    CheckEnergy("energy", ReadEnergy(toParent[p][0]), energy);
+
+  // all Models exist now; they map one segment
+  if (NumberOfSegments() != numberOfSegments + 1)
+    MY_ERROR("The processes do not share one segment");
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+  {
+    if (!MapsSegment(processIDs[p]))
+      MY_ERROR("A process does not map the segment");
+  }
+  std::cout << NUMBER_OF_PROCESSES << " processes share one segment"
+            << std::endl;
+
+  // each process changes its own parameters; the segment is read-only
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+  {
+    char const go = 'g';
+    if (write(fromParent[p][1], &go, 1) != 1) MY_ERROR("Unable to write");
+  }
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+    CheckEnergy("scaled energy", ReadEnergy(toParent[p][0]), scaledEnergy);
+
+  for (int p = 0; p < NUMBER_OF_PROCESSES; ++p)
+  {
+    int status;
+    if ((waitpid(processIDs[p], &status, 0) != processIDs[p])
+        || (!WIFEXITED(status)) || (WEXITSTATUS(status) != 0))
+      MY_ERROR("A process failed");
+  }
+
+  // the last process to destroy its Model removes the segment
+  if (NumberOfSegments() != numberOfSegments)
+    MY_ERROR("The segment was not removed");
+  std::cout << "segment removed" << std::endl;
+
+  return 0;
+}
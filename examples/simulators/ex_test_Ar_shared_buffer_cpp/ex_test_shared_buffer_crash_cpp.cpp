@@ -0,0 +1,208 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+// Drives the library's SharedBuffer class directly to check that processes
+// which crash while holding a segment do not break the other users.
+
+#include "KIM_Hash.hpp"
+#include "KIM_SharedBuffer.hpp"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define NUMBER_OF_BYTES 65536
+#define MAXIMUM_TAKEOVER_SECONDS 5.0
+
+#define MY_ERROR(message)                                                \
+  {                                                                      \
+    std::cout << "* Error : \"" << message << "\" : " << __LINE__ << ":" \
+              << __FILE__ << std::endl;                                  \
+    exit(1);                                                             \
+  }
+
+namespace
+{
+std::string key;
+
+// The segment file of key, named as in KIM_SharedBuffer.cpp
+std::string SegmentFile()
+{
+  std::ostringstream input;
+  input << getuid() << ":" << key;
+  KIM::Fnv1aHash hash;
+  hash.Add(input.str());
+  return "/dev/shm/kim-" + hash.Digest();
+}
+
+bool SegmentExists()
+{
+  struct stat status;
+  return stat(SegmentFile().c_str(), &status) == 0;
+}
+
+double Seconds()
+{
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return now.tv_sec + 1.0e-6 * now.tv_usec;
+}
+
+unsigned char Pattern(int const i) { return static_cast<unsigned char>(i); }
+
+// Create the buffer in a child, optionally fill and publish it, tell the
+// parent and wait to be killed
+pid_t StartChild(bool const publish)
+{
+  int toParent[2];
+  if (pipe(toParent)) MY_ERROR("pipe()");
+  std::cout.flush();
+  pid_t const processID = fork();
+  if (processID < 0) MY_ERROR("fork()");
+  if (processID == 0)
+  {
+    close(toParent[0]);
+    KIM::SharedBuffer * buffer;
+    if (KIM::SharedBuffer::Create(key, NUMBER_OF_BYTES, &buffer)
+        || (!buffer->IsOwner()) || (!buffer->IsShared()))
+      _exit(1);
+    unsigned char * const data = static_cast<unsigned char *>(buffer->Data());
+    for (int i = 0; i < NUMBER_OF_BYTES / 2; ++i) data[i] = Pattern(i);
+    if (publish)
+    {
+      for (int i = NUMBER_OF_BYTES / 2; i < NUMBER_OF_BYTES; ++i)
+        data[i] = Pattern(i);
+      if (buffer->Publish()) _exit(1);
+    }
+    char const ready = 'r';
+    if (write(toParent[1], &ready, 1) != 1) _exit(1);
+    while (true) pause();
+  }
+
+  close(toParent[1]);
+  char ready;
+  if (read(toParent[0], &ready, 1) != 1) MY_ERROR("The child failed");
+  close(toParent[0]);
+  return processID;
+}
+
+void KillChild(pid_t const processID)
+{
+  int status;
+  if (kill(processID, SIGKILL) || (waitpid(processID, &status, 0) != processID)
+      || (!WIFSIGNALED(status)))
+    MY_ERROR("Unable to kill the child");
+}
+
+void CheckContents(KIM::SharedBuffer const * const buffer)
+{
+  unsigned char const * const data
+      = static_cast<unsigned char const *>(buffer->Data());
+  for (int i = 0; i < NUMBER_OF_BYTES; ++i)
+  {
+    if (data[i] != Pattern(i)) MY_ERROR("Wrong contents");
+  }
+}
+}  // namespace
+
+
+int main()
+{
+  setenv("KIM_API_SHARED_MEMORY", "1", 1);
+  std::ostringstream keyStream;
+  keyStream << "ex_test_shared_buffer_crash_cpp " << getpid();
+  key = keyStream.str();
+
+  // the owner dies before it publishes; the next creator takes over the key
+  // without waiting for the timeout
+  pid_t const ownerID = StartChild(false);
+  KillChild(ownerID);
+  if (!SegmentExists()) MY_ERROR("The owner did not create a segment");
+  double const start = Seconds();
+  KIM::SharedBuffer * buffer;
+  if (KIM::SharedBuffer::Create(key, NUMBER_OF_BYTES, &buffer))
+    MY_ERROR("SharedBuffer::Create()");
+  double const takeover = Seconds() - start;
+  if ((!buffer->IsOwner()) || (!buffer->IsShared()))
+    MY_ERROR("The dead owner's segment was not taken over");
+  if (takeover > MAXIMUM_TAKEOVER_SECONDS)
+    MY_ERROR("Taking over the segment took too long");
+  std::cout << "dead owner's segment taken over" << std::endl;
+  unsigned char * const data = static_cast<unsigned char *>(buffer->Data());
+  for (int i = 0; i < NUMBER_OF_BYTES; ++i) data[i] = Pattern(i);
+  if (buffer->Publish()) MY_ERROR("SharedBuffer::Publish()");
+
+  // a user that crashes does not remove the segment of the others
+  std::cout.flush();
+  pid_t const userID = fork();
+  if (userID < 0) MY_ERROR("fork()");
+  if (userID == 0)
+  {
+    KIM::SharedBuffer * userBuffer;
+    if (KIM::SharedBuffer::Create(key, NUMBER_OF_BYTES, &userBuffer)
+        || userBuffer->IsOwner() || (!userBuffer->IsShared()))
+      _exit(1);
+    CheckContents(userBuffer);
+    _exit(0);
+  }
+  int status;
+  if ((waitpid(userID, &status, 0) != userID) || (!WIFEXITED(status))
+      || (WEXITSTATUS(status) != 0))
+    MY_ERROR("The user process failed");
+  if (!SegmentExists()) MY_ERROR("The segment was removed while in use");
+
+  // the last user removes the segment
+  KIM::SharedBuffer::Destroy(&buffer);
+  if (SegmentExists()) MY_ERROR("The segment was not removed");
+  std::cout << "segment removed by its last user" << std::endl;
+
+  // a published segment whose processes all crashed is reused and then
+  // removed by its next user
+  pid_t const publisherID = StartChild(true);
+  KillChild(publisherID);
+  if (!SegmentExists()) MY_ERROR("The publisher did not create a segment");
+  if (KIM::SharedBuffer::Create(key, NUMBER_OF_BYTES, &buffer))
+    MY_ERROR("SharedBuffer::Create()");
+  if (buffer->IsOwner() || (!buffer->IsShared()))
+    MY_ERROR("The published segment was not reused");
+  CheckContents(buffer);
+  KIM::SharedBuffer::Destroy(&buffer);
+  if (SegmentExists()) MY_ERROR("The abandoned segment was not removed");
+  std::cout << "abandoned segment reused and removed" << std::endl;
+
+  return 0;
+}
@@ -48,6 +48,7 @@ module kim_collections_module
     kim_collections_create, &
     kim_collections_destroy, &
     kim_get_item_type, &
+    kim_prefetch, &
     kim_get_item_library_file_name_and_collection, &
     kim_cache_list_of_item_metadata_files, &
     kim_get_item_metadata_file_length, &
@@ -108,6 +109,15 @@ module kim_collections_module
     module procedure kim_collections_get_item_type
   end interface kim_get_item_type
 
+  !> \brief \copybrief KIM::Collections::Prefetch
+  !!
+  !! \sa KIM::Collections::Prefetch, KIM_Collections_Prefetch
+  !!
+  !! \since 2.5
+  interface kim_prefetch
+    module procedure kim_collections_prefetch
+  end interface kim_prefetch
+
   !> \brief \copybrief KIM::Collections::GetItemLibraryFileNameAndCollection
   !!
   !! \sa KIM::Collections::GetItemLibraryFileNameAndCollection,
@@ -430,6 +440,34 @@ contains
     ierr = get_item_type(collections, trim(item_name)//c_null_char, item_type)
   end subroutine kim_collections_get_item_type
 
+  !> \brief \copybrief KIM::Collections::Prefetch
+  !!
+  !! \sa KIM::Collections::Prefetch, KIM_Collections_Prefetch
+  !!
+  !! \since 2.5
+  recursive subroutine kim_collections_prefetch(collections_handle, &
+                                                item_name, ierr)
+    use kim_interoperable_types_module, only: kim_collections_type
+    implicit none
+    interface
+      integer(c_int) recursive function prefetch(collections, item_name) &
+        bind(c, name="KIM_Collections_Prefetch")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_collections_type
+        implicit none
+        type(kim_collections_type), intent(in) :: collections
+        character(c_char), intent(in) :: item_name(*)
+      end function prefetch
+    end interface
+    type(kim_collections_handle_type), intent(in) :: collections_handle
+    character(len=*, kind=c_char), intent(in) :: item_name
+    integer(c_int), intent(out) :: ierr
+    type(kim_collections_type), pointer :: collections
+
+    call c_f_pointer(collections_handle%p, collections)
+    ierr = prefetch(collections, trim(item_name)//c_null_char)
+  end subroutine kim_collections_prefetch
+
   !> \brief \copybrief KIM::Collections::GetItemLibraryFileNameAndCollection
   !!
   !! \sa KIM::Collections::GetItemLibraryFileNameAndCollection,
@@ -50,6 +50,18 @@ module kim_compute_argument_name_module
     KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_PARTICLE_ENERGY, &
     KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_VIRIAL, &
     KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_PARTICLE_VIRIAL, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_PARTICLE_COST, &
+    KIM_COMPUTE_ARGUMENT_NAME_HESSIAN_BLOCK_ROW_OFFSETS, &
+    KIM_COMPUTE_ARGUMENT_NAME_HESSIAN_BLOCK_COLUMN_INDICES, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_HESSIAN_BLOCKS, &
+    KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_FLOAT, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_FLOAT, &
+    KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_X, &
+    KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_Y, &
+    KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_Z, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_X, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_Y, &
+    KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_Z, &
     ! Routines
     kim_known, &
     operator(.eq.), &
@@ -165,6 +177,126 @@ module kim_compute_argument_name_module
     bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialParticleVirial") &
     :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_PARTICLE_VIRIAL
 
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialParticleCost,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialParticleCost") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_PARTICLE_COST
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::hessianBlockRowOffsets,
+  !! KIM_COMPUTE_ARGUMENT_NAME_hessianBlockRowOffsets
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_hessianBlockRowOffsets") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_HESSIAN_BLOCK_ROW_OFFSETS
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::hessianBlockColumnIndices,
+  !! KIM_COMPUTE_ARGUMENT_NAME_hessianBlockColumnIndices
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_hessianBlockColumnIndices") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_HESSIAN_BLOCK_COLUMN_INDICES
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialHessianBlocks,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialHessianBlocks
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialHessianBlocks") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_HESSIAN_BLOCKS
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesFloat,
+  !! KIM_COMPUTE_ARGUMENT_NAME_coordinatesFloat
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_coordinatesFloat") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_FLOAT
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesFloat,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialForcesFloat
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialForcesFloat") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_FLOAT
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesX
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesX,
+  !! KIM_COMPUTE_ARGUMENT_NAME_coordinatesX
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_coordinatesX") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_X
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesY
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesY,
+  !! KIM_COMPUTE_ARGUMENT_NAME_coordinatesY
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_coordinatesY") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_Y
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::coordinatesZ,
+  !! KIM_COMPUTE_ARGUMENT_NAME_coordinatesZ
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_coordinatesZ") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_COORDINATES_Z
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesX
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesX,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialForcesX
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialForcesX") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_X
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesY
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesY,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialForcesY
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialForcesY") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_Y
+
+  !> \brief \copybrief KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ
+  !!
+  !! \sa KIM::COMPUTE_ARGUMENT_NAME::partialForcesZ,
+  !! KIM_COMPUTE_ARGUMENT_NAME_partialForcesZ
+  !!
+  !! \since 2.5
+  type(kim_compute_argument_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_ARGUMENT_NAME_partialForcesZ") &
+    :: KIM_COMPUTE_ARGUMENT_NAME_PARTIAL_FORCES_Z
+
   !> \brief \copybrief KIM::ComputeArgumentName::Known
   !!
   !! \sa KIM::ComputeArgumentName::Known, KIM_ComputeArgumentName_Known
@@ -110,7 +110,8 @@ module kim_compute_arguments_module
   !!
   !! \sa KIM::ComputeArguments::SetArgumentPointer,
   !! KIM_ComputeArguments_SetArgumentPointerInteger,
-  !! KIM_ComputeArguments_SetArgumentPointerDouble
+  !! KIM_ComputeArguments_SetArgumentPointerDouble,
+  !! KIM_ComputeArguments_SetArgumentPointerFloat
   !!
   !! \since 2.0
   interface kim_set_argument_pointer
@@ -120,6 +121,9 @@ module kim_compute_arguments_module
     module procedure kim_compute_arguments_set_argument_pointer_double0
     module procedure kim_compute_arguments_set_argument_pointer_double1
     module procedure kim_compute_arguments_set_argument_pointer_double2
+    module procedure kim_compute_arguments_set_argument_pointer_float0
+    module procedure kim_compute_arguments_set_argument_pointer_float1
+    module procedure kim_compute_arguments_set_argument_pointer_float2
   end interface kim_set_argument_pointer
 
   !> \brief \copybrief KIM::ComputeArguments::SetCallbackPointer
@@ -622,6 +626,161 @@ contains
     end subroutine set
   end subroutine kim_compute_arguments_set_argument_pointer_double2
 
+  !> \brief \copybrief KIM::ComputeArguments::SetArgumentPointer
+  !!
+  !! \sa KIM::ComputeArguments::SetArgumentPointer,
+  !! KIM_ComputeArguments_SetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine kim_compute_arguments_set_argument_pointer_float0( &
+    compute_arguments_handle, compute_argument_name, float0, ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_argument_pointer_float( &
+        compute_arguments, compute_argument_name, ptr) &
+        bind(c, name="KIM_ComputeArguments_SetArgumentPointerFloat")
+        use, intrinsic :: iso_c_binding
+        use kim_compute_argument_name_module, only: &
+          kim_compute_argument_name_type
+        use kim_interoperable_types_module, only: kim_compute_arguments_type
+        implicit none
+        type(kim_compute_arguments_type), intent(in) :: compute_arguments
+        type(kim_compute_argument_name_type), intent(in), value :: &
+          compute_argument_name
+        type(c_ptr), intent(in), value :: ptr
+      end function set_argument_pointer_float
+    end interface
+    type(kim_compute_arguments_handle_type), intent(in) :: &
+      compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    real(c_float), intent(in), target :: float0
+    integer(c_int), intent(out) :: ierr
+    type(kim_compute_arguments_type), pointer :: compute_arguments
+
+    call c_f_pointer(compute_arguments_handle%p, compute_arguments)
+    ierr = set_argument_pointer_float(compute_arguments, &
+                                      compute_argument_name, c_loc(float0))
+  end subroutine kim_compute_arguments_set_argument_pointer_float0
+
+  !> \brief \copybrief KIM::ComputeArguments::SetArgumentPointer
+  !!
+  !! \sa KIM::ComputeArguments::SetArgumentPointer,
+  !! KIM_ComputeArguments_SetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine kim_compute_arguments_set_argument_pointer_float1( &
+    compute_arguments_handle, compute_argument_name, float1, ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_compute_arguments_type
+    implicit none
+    type(kim_compute_arguments_handle_type), intent(in) :: &
+      compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    real(c_float), intent(in), target :: float1(:)
+    integer(c_int), intent(out) :: ierr
+    type(kim_compute_arguments_type), pointer :: compute_arguments
+
+    call c_f_pointer(compute_arguments_handle%p, compute_arguments)
+    call set(compute_arguments, compute_argument_name, &
+             size(float1, 1, c_int), float1, ierr)
+    return
+
+  contains
+    recursive subroutine set(compute_arguments, compute_argument_name, &
+                             extent1, float1, ierr)
+      use kim_compute_argument_name_module, only: &
+        kim_compute_argument_name_type
+      use kim_interoperable_types_module, only: kim_compute_arguments_type
+      implicit none
+      interface
+        integer(c_int) recursive function set_argument_pointer_float( &
+          compute_arguments, compute_argument_name, ptr) &
+          bind(c, name="KIM_ComputeArguments_SetArgumentPointerFloat")
+          use, intrinsic :: iso_c_binding
+          use kim_compute_argument_name_module, only: &
+            kim_compute_argument_name_type
+          use kim_interoperable_types_module, only: kim_compute_arguments_type
+          implicit none
+          type(kim_compute_arguments_type), intent(in) :: compute_arguments
+          type(kim_compute_argument_name_type), intent(in), value :: &
+            compute_argument_name
+          type(c_ptr), intent(in), value :: ptr
+        end function set_argument_pointer_float
+      end interface
+      type(kim_compute_arguments_type), intent(in) :: compute_arguments
+      type(kim_compute_argument_name_type), intent(in) :: &
+        compute_argument_name
+      integer(c_int), intent(in) :: extent1
+      real(c_float), intent(in), target :: float1(extent1)
+      integer(c_int), intent(out) :: ierr
+
+      ierr = set_argument_pointer_float(compute_arguments, &
+                                        compute_argument_name, c_loc(float1))
+    end subroutine set
+  end subroutine kim_compute_arguments_set_argument_pointer_float1
+
+  !> \brief \copybrief KIM::ComputeArguments::SetArgumentPointer
+  !!
+  !! \sa KIM::ComputeArguments::SetArgumentPointer,
+  !! KIM_ComputeArguments_SetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine kim_compute_arguments_set_argument_pointer_float2( &
+    compute_arguments_handle, compute_argument_name, float2, ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_compute_arguments_type
+    implicit none
+    type(kim_compute_arguments_handle_type), intent(in) :: &
+      compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    real(c_float), intent(in), target :: float2(:, :)
+    integer(c_int), intent(out) :: ierr
+    type(kim_compute_arguments_type), pointer :: compute_arguments
+
+    call c_f_pointer(compute_arguments_handle%p, compute_arguments)
+    call set(compute_arguments, compute_argument_name, &
+             size(float2, 1, c_int), size(float2, 2, c_int), float2, ierr)
+    return
+
+  contains
+    recursive subroutine set(compute_arguments, compute_argument_name, &
+                             extent1, extent2, float2, ierr)
+      use kim_compute_argument_name_module, only: &
+        kim_compute_argument_name_type
+      implicit none
+      interface
+        integer(c_int) recursive function set_argument_pointer_float( &
+          compute_arguments, compute_argument_name, ptr) &
+          bind(c, name="KIM_ComputeArguments_SetArgumentPointerFloat")
+          use, intrinsic :: iso_c_binding
+          use kim_compute_argument_name_module, only: &
+            kim_compute_argument_name_type
+          use kim_interoperable_types_module, only: kim_compute_arguments_type
+          implicit none
+          type(kim_compute_arguments_type), intent(in) :: compute_arguments
+          type(kim_compute_argument_name_type), intent(in), value :: &
+            compute_argument_name
+          type(c_ptr), intent(in), value :: ptr
+        end function set_argument_pointer_float
+      end interface
+      type(kim_compute_arguments_type), intent(in) :: compute_arguments
+      type(kim_compute_argument_name_type), intent(in) :: &
+        compute_argument_name
+      integer(c_int), intent(in) :: extent1
+      integer(c_int), intent(in) :: extent2
+      real(c_float), intent(in), target :: float2(extent1, extent2)
+      integer(c_int), intent(out) :: ierr
+
+      ierr = set_argument_pointer_float(compute_arguments, &
+                                        compute_argument_name, c_loc(float2))
+    end subroutine set
+  end subroutine kim_compute_arguments_set_argument_pointer_float2
+
   !> \brief \copybrief KIM::ComputeArguments::SetCallbackPointer
   !!
   !! \sa KIM::ComputeArguments::SetCallbackPointer,
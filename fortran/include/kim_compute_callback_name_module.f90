@@ -44,6 +44,10 @@ module kim_compute_callback_name_module
     KIM_COMPUTE_CALLBACK_NAME_GET_NEIGHBOR_LIST, &
     KIM_COMPUTE_CALLBACK_NAME_PROCESS_DEDR_TERM, &
     KIM_COMPUTE_CALLBACK_NAME_PROCESS_D2EDR2_TERM, &
+    KIM_COMPUTE_CALLBACK_NAME_GET_NEIGHBOR_LIST_WITH_DISPLACEMENTS, &
+    KIM_COMPUTE_CALLBACK_NAME_GET_NESTED_NEIGHBOR_LISTS, &
+    KIM_COMPUTE_CALLBACK_NAME_PROCESS_DEDR_TERM_BATCH, &
+    KIM_COMPUTE_CALLBACK_NAME_PROCESS_D2EDR2_TERM_BATCH, &
     ! Routines
     kim_known, &
     operator(.eq.), &
@@ -98,6 +102,47 @@ module kim_compute_callback_name_module
     bind(c, name="KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2Term") &
     :: KIM_COMPUTE_CALLBACK_NAME_PROCESS_D2EDR2_TERM
 
+  !> \brief \copybrief <!--
+  !! -->KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements
+  !!
+  !! \sa KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements,
+  !! KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements
+  !!
+  !! \since 2.5
+  type(kim_compute_callback_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_CALLBACK_NAME_GetNeighborListWithDisplacements") &
+    :: KIM_COMPUTE_CALLBACK_NAME_GET_NEIGHBOR_LIST_WITH_DISPLACEMENTS
+
+  !> \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists
+  !!
+  !! \sa KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists,
+  !! KIM_COMPUTE_CALLBACK_NAME_GetNestedNeighborLists
+  !!
+  !! \since 2.5
+  type(kim_compute_callback_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_CALLBACK_NAME_GetNestedNeighborLists") &
+    :: KIM_COMPUTE_CALLBACK_NAME_GET_NESTED_NEIGHBOR_LISTS
+
+  !> \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch
+  !!
+  !! \sa KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch,
+  !! KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTermBatch
+  !!
+  !! \since 2.5
+  type(kim_compute_callback_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_CALLBACK_NAME_ProcessDEDrTermBatch") &
+    :: KIM_COMPUTE_CALLBACK_NAME_PROCESS_DEDR_TERM_BATCH
+
+  !> \brief \copybrief KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch
+  !!
+  !! \sa KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch,
+  !! KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2TermBatch
+  !!
+  !! \since 2.5
+  type(kim_compute_callback_name_type), protected, save, &
+    bind(c, name="KIM_COMPUTE_CALLBACK_NAME_ProcessD2EDr2TermBatch") &
+    :: KIM_COMPUTE_CALLBACK_NAME_PROCESS_D2EDR2_TERM_BATCH
+
   !> \brief \copybrief KIM::ComputeCallbackName::Known
   !!
   !! \sa KIM::ComputeCallbackName::Known, KIM_ComputeCallbackName_Known
@@ -43,6 +43,7 @@ module kim_data_type_module
     ! Constants
     KIM_DATA_TYPE_INTEGER, &
     KIM_DATA_TYPE_DOUBLE, &
+    KIM_DATA_TYPE_FLOAT, &
     ! Routines
     kim_known, &
     operator(.eq.), &
@@ -84,6 +85,15 @@ module kim_data_type_module
     bind(c, name="KIM_DATA_TYPE_Double") &
     :: KIM_DATA_TYPE_DOUBLE
 
+  !> \brief \copybrief KIM::DATA_TYPE::Float
+  !!
+  !! \sa KIM::DATA_TYPE::Float, KIM_DATA_TYPE_Float
+  !!
+  !! \since 2.5
+  type(kim_data_type_type), protected, save, &
+    bind(c, name="KIM_DATA_TYPE_Float") &
+    :: KIM_DATA_TYPE_FLOAT
+
   !> \brief \copybrief KIM::DataType::Known
   !!
   !! \sa KIM::DataType::Known, KIM_DataType_Known
@@ -48,6 +48,7 @@ module kim_model_compute_arguments_create_module
     operator(.ne.), &
     kim_set_argument_support_status, &
     kim_set_callback_support_status, &
+    kim_set_neighbor_numbering_translation, &
     kim_set_model_buffer_pointer, &
     kim_log_entry, &
     kim_to_string
@@ -108,6 +109,18 @@ module kim_model_compute_arguments_create_module
       kim_model_compute_arguments_create_set_callback_support_status
   end interface kim_set_callback_support_status
 
+  !> \brief \copybrief KIM::ModelComputeArgumentsCreate::<!--
+  !! -->SetNeighborNumberingTranslation
+  !!
+  !! \sa KIM::ModelComputeArgumentsCreate::SetNeighborNumberingTranslation,
+  !! KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation
+  !!
+  !! \since 2.5
+  interface kim_set_neighbor_numbering_translation
+    module procedure &
+      kim_model_compute_arguments_create_set_neighbor_translation
+  end interface kim_set_neighbor_numbering_translation
+
   !> \brief \copybrief KIM::ModelComputeArgumentsCreate::SetModelBufferPointer
   !!
   !! \sa KIM::ModelComputeArgumentsCreate::SetModelBufferPointer,
@@ -271,6 +284,45 @@ contains
                                        compute_callback_name, support_status)
   end subroutine kim_model_compute_arguments_create_set_callback_support_status
 
+  !> \brief \copybrief KIM::ModelComputeArgumentsCreate::<!--
+  !! -->SetNeighborNumberingTranslation
+  !!
+  !! \sa KIM::ModelComputeArgumentsCreate::SetNeighborNumberingTranslation,
+  !! KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_create_set_neighbor_translation( &
+    model_commpute_arguments_create_handle, translate_neighbor_numbering)
+    use kim_interoperable_types_module, only: &
+      kim_model_compute_arguments_create_type
+    implicit none
+    interface
+      recursive subroutine set_neighbor_numbering_translation( &
+        model_commpute_arguments_create, translate_neighbor_numbering) &
+        bind(c, &
+        name="KIM_ModelComputeArgumentsCreate_SetNeighborNumberingTranslation")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_create_type
+        implicit none
+        type(kim_model_compute_arguments_create_type), intent(in) :: &
+          model_commpute_arguments_create
+        integer(c_int), intent(in), value :: translate_neighbor_numbering
+      end subroutine set_neighbor_numbering_translation
+    end interface
+    type(kim_model_compute_arguments_create_handle_type), intent(in) :: &
+      model_commpute_arguments_create_handle
+    integer(c_int), intent(in) :: translate_neighbor_numbering
+    type(kim_model_compute_arguments_create_type), pointer :: &
+      model_commpute_arguments_create
+
+    call c_f_pointer(model_commpute_arguments_create_handle%p, &
+                     model_commpute_arguments_create)
+    call set_neighbor_numbering_translation(model_commpute_arguments_create, &
+                                            translate_neighbor_numbering)
+  end subroutine kim_model_compute_arguments_create_set_neighbor_translation
+
   !> \brief \copybrief KIM::ModelComputeArgumentsCreate::SetModelBufferPointer
   !!
   !! \sa KIM::ModelComputeArgumentsCreate::SetModelBufferPointer,
@@ -46,8 +46,13 @@ module kim_model_compute_arguments_module
     operator(.eq.), &
     operator(.ne.), &
     kim_get_neighbor_list, &
+    kim_get_neighbor_list_with_displacements, &
+    kim_get_neighbor_lists, &
+    kim_get_neighbor_numbering_offset, &
     kim_process_dedr_term, &
     kim_process_d2edr2_term, &
+    kim_process_dedr_term_batch, &
+    kim_process_d2edr2_term_batch, &
     kim_get_argument_pointer, &
     kim_is_callback_present, &
     kim_set_model_buffer_pointer, &
@@ -96,6 +101,37 @@ module kim_model_compute_arguments_module
     module procedure kim_model_compute_arguments_get_neighbor_list
   end interface kim_get_neighbor_list
 
+  !> \brief \copybrief <!--
+  !! -->KIM::ModelComputeArguments::GetNeighborListWithDisplacements
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborListWithDisplacements,
+  !! KIM_ModelComputeArguments_GetNeighborListWithDisplacements
+  !!
+  !! \since 2.5
+  interface kim_get_neighbor_list_with_displacements
+    module procedure kim_model_compute_arguments_get_neighbor_list_displacements
+  end interface kim_get_neighbor_list_with_displacements
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetNeighborLists
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborLists,
+  !! KIM_ModelComputeArguments_GetNeighborLists
+  !!
+  !! \since 2.5
+  interface kim_get_neighbor_lists
+    module procedure kim_model_compute_arguments_get_neighbor_lists
+  end interface kim_get_neighbor_lists
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetNeighborNumberingOffset
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborNumberingOffset,
+  !! KIM_ModelComputeArguments_GetNeighborNumberingOffset
+  !!
+  !! \since 2.5
+  interface kim_get_neighbor_numbering_offset
+    module procedure kim_model_compute_arguments_get_neighbor_numbering_offset
+  end interface kim_get_neighbor_numbering_offset
+
   !> \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTerm
   !!
   !! \sa KIM::ModelComputeArguments::ProcessDEDrTerm,
@@ -116,11 +152,32 @@ module kim_model_compute_arguments_module
     module procedure kim_model_compute_arguments_process_d2edr2_term
   end interface kim_process_d2edr2_term
 
+  !> \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTermBatch
+  !!
+  !! \sa KIM::ModelComputeArguments::ProcessDEDrTermBatch,
+  !! KIM_ModelComputeArguments_ProcessDEDrTermBatch
+  !!
+  !! \since 2.5
+  interface kim_process_dedr_term_batch
+    module procedure kim_model_compute_arguments_process_dedr_term_batch
+  end interface kim_process_dedr_term_batch
+
+  !> \brief \copybrief KIM::ModelComputeArguments::ProcessD2EDr2TermBatch
+  !!
+  !! \sa KIM::ModelComputeArguments::ProcessD2EDr2TermBatch,
+  !! KIM_ModelComputeArguments_ProcessD2EDr2TermBatch
+  !!
+  !! \since 2.5
+  interface kim_process_d2edr2_term_batch
+    module procedure kim_model_compute_arguments_process_d2edr2_term_batch
+  end interface kim_process_d2edr2_term_batch
+
   !> \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
   !!
   !! \sa KIM::ModelComputeArguments::GetArgumentPointer,
   !! KIM_ModelComputeArguments_GetArgumentPointerInteger,
-  !! KIM_ModelComputeArguments_GetArgumentPointerDouble
+  !! KIM_ModelComputeArguments_GetArgumentPointerDouble,
+  !! KIM_ModelComputeArguments_GetArgumentPointerFloat
   !!
   !! \since 2.0
   interface kim_get_argument_pointer
@@ -130,6 +187,9 @@ module kim_model_compute_arguments_module
     module procedure kim_model_compute_arguments_get_argument_pointer_double0
     module procedure kim_model_compute_arguments_get_argument_pointer_double1
     module procedure kim_model_compute_arguments_get_argument_pointer_double2
+    module procedure kim_model_compute_arguments_get_argument_pointer_float0
+    module procedure kim_model_compute_arguments_get_argument_pointer_float1
+    module procedure kim_model_compute_arguments_get_argument_pointer_float2
   end interface kim_get_argument_pointer
 
   !> \brief \copybrief KIM::ModelComputeArguments::IsCallbackPresent
@@ -289,6 +349,213 @@ contains
     end if
   end subroutine kim_model_compute_arguments_get_neighbor_list
 
+  !> \brief \copybrief <!--
+  !! -->KIM::ModelComputeArguments::GetNeighborListWithDisplacements
+  !!
+  !! A Fortran PM may provide a
+  !! KIM::COMPUTE_CALLBACK_NAME::GetNeighborListWithDisplacements routine.  The
+  !! interface for this is given here (see also
+  !! KIM::GetNeighborListWithDisplacementsFunction, \ref
+  !! KIM_GetNeighborListWithDisplacementsFunction).
+  !!
+  !! \code{.f90}
+  !! interface
+  !!   recursive subroutine get_neighbor_list_with_displacements( &
+  !!     data_object, number_of_neighbor_lists, cutoffs, neighbor_list_index, &
+  !!     particle_number, number_of_neighbors, neighbors_of_particle, &
+  !!     displacements_of_neighbors, squared_distances_of_neighbors, ierr) &
+  !!     bind(c)
+  !!     use, intrinsic :: iso_c_binding
+  !!     implicit none
+  !!     type(c_ptr), intent(in), value :: data_object
+  !!     integer(c_int), intent(in), value :: number_of_neighbor_lists
+  !!     real(c_double), intent(in) :: cutoffs(*)
+  !!     integer(c_int), intent(in), value :: neighbor_list_index
+  !!     integer(c_int), intent(in), value :: particle_number
+  !!     integer(c_int), intent(out) :: number_of_neighbors
+  !!     type(c_ptr), intent(out) :: neighbors_of_particle
+  !!     type(c_ptr), intent(out) :: displacements_of_neighbors
+  !!     type(c_ptr), intent(out) :: squared_distances_of_neighbors
+  !!     integer(c_int), intent(out) :: ierr
+  !!   end subroutine get_neighbor_list_with_displacements
+  !! end interface
+  !! \endcode
+  !!
+  !! On return \c displacements_of_neighbors has shape
+  !! \c [3, number_of_neighbors] and \c squared_distances_of_neighbors is
+  !! disassociated if the Simulator does not provide squared distances.
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborListWithDisplacements,
+  !! KIM_ModelComputeArguments_GetNeighborListWithDisplacements
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_get_neighbor_list_displacements( &
+    model_compute_arguments_handle, neighbor_list_index, particle_number, &
+    number_of_neighbors, neighbors_of_particle, displacements_of_neighbors, &
+    squared_distances_of_neighbors, ierr)
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_neighbor_list_with_displacements( &
+        model_compute_arguments, neighbor_list_index, particle_number, &
+        number_of_neighbors, neighbors_of_particle, &
+        displacements_of_neighbors, squared_distances_of_neighbors) &
+        bind(c, &
+        name="KIM_ModelComputeArguments_GetNeighborListWithDisplacements")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        integer(c_int), intent(in), value :: neighbor_list_index
+        integer(c_int), intent(in), value :: particle_number
+        integer(c_int), intent(out) :: number_of_neighbors
+        type(c_ptr), intent(out) :: neighbors_of_particle
+        type(c_ptr), intent(out) :: displacements_of_neighbors
+        type(c_ptr), intent(out) :: squared_distances_of_neighbors
+      end function get_neighbor_list_with_displacements
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(in) :: neighbor_list_index
+    integer(c_int), intent(in) :: particle_number
+    integer(c_int), intent(out) :: number_of_neighbors
+    integer(c_int), intent(out), pointer :: neighbors_of_particle(:)
+    real(c_double), intent(out), pointer :: displacements_of_neighbors(:, :)
+    real(c_double), intent(out), pointer :: squared_distances_of_neighbors(:)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    type(c_ptr) p, dx_p, r2_p
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = get_neighbor_list_with_displacements( &
+           model_compute_arguments, neighbor_list_index - 1, &
+           particle_number, number_of_neighbors, p, dx_p, r2_p)
+    if (c_associated(p)) then
+      call c_f_pointer(p, neighbors_of_particle, [number_of_neighbors])
+    else
+      nullify (neighbors_of_particle)
+    end if
+    if (c_associated(dx_p)) then
+      call c_f_pointer(dx_p, displacements_of_neighbors, &
+                       [3, number_of_neighbors])
+    else
+      nullify (displacements_of_neighbors)
+    end if
+    if (c_associated(r2_p)) then
+      call c_f_pointer(r2_p, squared_distances_of_neighbors, &
+                       [number_of_neighbors])
+    else
+      nullify (squared_distances_of_neighbors)
+    end if
+  end subroutine kim_model_compute_arguments_get_neighbor_list_displacements
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetNeighborLists
+  !!
+  !! A Fortran PM may provide a
+  !! KIM::COMPUTE_CALLBACK_NAME::GetNestedNeighborLists routine.  The
+  !! interface for this is given here (see also
+  !! KIM::GetNestedNeighborListsFunction, \ref
+  !! KIM_GetNestedNeighborListsFunction).
+  !!
+  !! \code{.f90}
+  !! interface
+  !!   recursive subroutine get_nested_neighbor_lists(data_object, &
+  !!     number_of_neighbor_lists, cutoffs, particle_number, &
+  !!     number_of_neighbors, neighbors_of_particle, ierr) bind(c)
+  !!     use, intrinsic :: iso_c_binding
+  !!     implicit none
+  !!     type(c_ptr), intent(in), value :: data_object
+  !!     integer(c_int), intent(in), value :: number_of_neighbor_lists
+  !!     real(c_double), intent(in) :: cutoffs(*)
+  !!     integer(c_int), intent(in), value :: particle_number
+  !!     integer(c_int), intent(out) :: &
+  !!       number_of_neighbors(number_of_neighbor_lists)
+  !!     type(c_ptr), intent(out) :: neighbors_of_particle
+  !!     integer(c_int), intent(out) :: ierr
+  !!   end subroutine get_nested_neighbor_lists
+  !! end interface
+  !! \endcode
+  !!
+  !! On return, \c neighbors_of_particle(k) is a C pointer to the list
+  !! corresponding to the k-th cutoff, which may be accessed with
+  !! \c c_f_pointer(neighbors_of_particle(k), list, [number_of_neighbors(k)]).
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborLists,
+  !! KIM_ModelComputeArguments_GetNeighborLists
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_compute_arguments_get_neighbor_lists( &
+    model_compute_arguments_handle, particle_number, number_of_neighbors, &
+    neighbors_of_particle, ierr)
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_neighbor_lists( &
+        model_compute_arguments, particle_number, number_of_neighbors, &
+        neighbors_of_particle) &
+        bind(c, name="KIM_ModelComputeArguments_GetNeighborLists")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        integer(c_int), intent(in), value :: particle_number
+        integer(c_int), intent(out) :: number_of_neighbors(*)
+        type(c_ptr), intent(out) :: neighbors_of_particle(*)
+      end function get_neighbor_lists
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(in) :: particle_number
+    integer(c_int), intent(out) :: number_of_neighbors(:)
+    type(c_ptr), intent(out) :: neighbors_of_particle(:)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = get_neighbor_lists(model_compute_arguments, particle_number, &
+                              number_of_neighbors, neighbors_of_particle)
+  end subroutine kim_model_compute_arguments_get_neighbor_lists
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetNeighborNumberingOffset
+  !!
+  !! \sa KIM::ModelComputeArguments::GetNeighborNumberingOffset,
+  !! KIM_ModelComputeArguments_GetNeighborNumberingOffset
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_get_neighbor_numbering_offset( &
+    model_compute_arguments_handle, neighbor_numbering_offset)
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      recursive subroutine get_neighbor_numbering_offset( &
+        model_compute_arguments, neighbor_numbering_offset) &
+        bind(c, name="KIM_ModelComputeArguments_GetNeighborNumberingOffset")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        integer(c_int), intent(out) :: neighbor_numbering_offset
+      end subroutine get_neighbor_numbering_offset
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(out) :: neighbor_numbering_offset
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    call get_neighbor_numbering_offset(model_compute_arguments, &
+                                       neighbor_numbering_offset)
+  end subroutine kim_model_compute_arguments_get_neighbor_numbering_offset
+
   !> \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTerm
   !!
   !! A Fortran PM may provide a KIM::MODEL_ROUTINE_NAME::ProcessDEDrTerm
@@ -414,6 +681,142 @@ contains
                                de, r(1), dx(1, 1), i(1), j(1))
   end subroutine kim_model_compute_arguments_process_d2edr2_term
 
+  !> \brief \copybrief KIM::ModelComputeArguments::ProcessDEDrTermBatch
+  !!
+  !! A Fortran PM may provide a
+  !! KIM::COMPUTE_CALLBACK_NAME::ProcessDEDrTermBatch routine.  The interface
+  !! for this is given here (see also KIM::ProcessDEDrTermBatchFunction, \ref
+  !! KIM_ProcessDEDrTermBatchFunction).
+  !!
+  !! \code{.f90}
+  !! interface
+  !!   recursive subroutine process_dedr_term_batch(data_object, &
+  !!     number_of_terms, de, r, dx, i, j, ierr) bind(c)
+  !!     use, intrinsic :: iso_c_binding
+  !!     implicit none
+  !!     type(c_ptr), intent(in), value :: data_object
+  !!     integer(c_int), intent(in), value :: number_of_terms
+  !!     real(c_double), intent(in) :: de(number_of_terms)
+  !!     real(c_double), intent(in) :: r(number_of_terms)
+  !!     real(c_double), intent(in) :: dx(3, number_of_terms)
+  !!     integer(c_int), intent(in) :: i(number_of_terms)
+  !!     integer(c_int), intent(in) :: j(number_of_terms)
+  !!     integer(c_int), intent(out) :: ierr
+  !!   end subroutine process_dedr_term_batch
+  !! end interface
+  !! \endcode
+  !!
+  !! \sa KIM::ModelComputeArguments::ProcessDEDrTermBatch,
+  !! KIM_ModelComputeArguments_ProcessDEDrTermBatch
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_compute_arguments_process_dedr_term_batch( &
+    model_compute_arguments_handle, number_of_terms, de, r, dx, i, j, ierr)
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function process_dedr_term_batch( &
+        model_compute_arguments, number_of_terms, de, r, dx, i, j) &
+        bind(c, name="KIM_ModelComputeArguments_ProcessDEDrTermBatch")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        integer(c_int), intent(in), value :: number_of_terms
+        real(c_double), intent(in) :: de
+        real(c_double), intent(in) :: r
+        real(c_double), intent(in) :: dx
+        integer(c_int), intent(in) :: i
+        integer(c_int), intent(in) :: j
+      end function process_dedr_term_batch
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(in) :: number_of_terms
+    real(c_double), intent(in) :: de(:)
+    real(c_double), intent(in) :: r(:)
+    real(c_double), intent(in) :: dx(:, :)
+    integer(c_int), intent(in) :: i(:)
+    integer(c_int), intent(in) :: j(:)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = process_dedr_term_batch(model_compute_arguments, number_of_terms, &
+                                   de(1), r(1), dx(1, 1), i(1), j(1))
+  end subroutine kim_model_compute_arguments_process_dedr_term_batch
+
+  !> \brief \copybrief KIM::ModelComputeArguments::ProcessD2EDr2TermBatch
+  !!
+  !! A Fortran PM may provide a
+  !! KIM::COMPUTE_CALLBACK_NAME::ProcessD2EDr2TermBatch routine.  The
+  !! interface for this is given here (see also
+  !! KIM::ProcessD2EDr2TermBatchFunction, \ref
+  !! KIM_ProcessD2EDr2TermBatchFunction).
+  !!
+  !! \code{.f90}
+  !! interface
+  !!   recursive subroutine process_d2edr2_term_batch(data_object, &
+  !!     number_of_terms, de, r, dx, i, j, ierr) bind(c)
+  !!     use, intrinsic :: iso_c_binding
+  !!     implicit none
+  !!     type(c_ptr), intent(in), value :: data_object
+  !!     integer(c_int), intent(in), value :: number_of_terms
+  !!     real(c_double), intent(in) :: de(number_of_terms)
+  !!     real(c_double), intent(in) :: r(2, number_of_terms)
+  !!     real(c_double), intent(in) :: dx(3, 2, number_of_terms)
+  !!     integer(c_int), intent(in) :: i(2, number_of_terms)
+  !!     integer(c_int), intent(in) :: j(2, number_of_terms)
+  !!     integer(c_int), intent(out) :: ierr
+  !!   end subroutine process_d2edr2_term_batch
+  !! end interface
+  !! \endcode
+  !!
+  !! \sa KIM::ModelComputeArguments::ProcessD2EDr2TermBatch,
+  !! KIM_ModelComputeArguments_ProcessD2EDr2TermBatch
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_compute_arguments_process_d2edr2_term_batch( &
+    model_compute_arguments_handle, number_of_terms, de, r, dx, i, j, ierr)
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function process_d2edr2_term_batch( &
+        model_compute_arguments, number_of_terms, de, r, dx, i, j) &
+        bind(c, name="KIM_ModelComputeArguments_ProcessD2EDr2TermBatch")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        integer(c_int), intent(in), value :: number_of_terms
+        real(c_double), intent(in) :: de
+        real(c_double), intent(in) :: r
+        real(c_double), intent(in) :: dx
+        integer(c_int), intent(in) :: i
+        integer(c_int), intent(in) :: j
+      end function process_d2edr2_term_batch
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    integer(c_int), intent(in) :: number_of_terms
+    real(c_double), intent(in) :: de(:)
+    real(c_double), intent(in) :: r(:, :)
+    real(c_double), intent(in) :: dx(:, :, :)
+    integer(c_int), intent(in) :: i(:, :)
+    integer(c_int), intent(in) :: j(:, :)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = process_d2edr2_term_batch(model_compute_arguments, &
+                                     number_of_terms, de(1), r(1, 1), &
+                                     dx(1, 1, 1), i(1, 1), j(1, 1))
+  end subroutine kim_model_compute_arguments_process_d2edr2_term_batch
+
   !> \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
   !!
   !! \sa KIM::ModelComputeArguments::GetArgumentPointer,
@@ -715,6 +1118,158 @@ contains
     end if
   end subroutine kim_model_compute_arguments_get_argument_pointer_double2
 
+  !> \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
+  !!
+  !! \sa KIM::ModelComputeArguments::GetArgumentPointer,
+  !! KIM_ModelComputeArguments_GetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_get_argument_pointer_float0( &
+    model_compute_arguments_handle, compute_argument_name, float0, ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_argument_pointer_float( &
+        model_compute_arguments, compute_argument_name, ptr) &
+        bind(c, name="KIM_ModelComputeArguments_GetArgumentPointerFloat")
+        use, intrinsic :: iso_c_binding
+        use kim_compute_argument_name_module, only: &
+          kim_compute_argument_name_type
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        type(kim_compute_argument_name_type), intent(in), value :: &
+          compute_argument_name
+        type(c_ptr), intent(out) :: ptr
+      end function get_argument_pointer_float
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    real(c_float), intent(out), pointer :: float0
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    type(c_ptr) p
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = get_argument_pointer_float(model_compute_arguments, &
+                                      compute_argument_name, p)
+    if (c_associated(p)) then
+      call c_f_pointer(p, float0)
+    else
+      nullify (float0)
+    end if
+  end subroutine kim_model_compute_arguments_get_argument_pointer_float0
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
+  !!
+  !! \sa KIM::ModelComputeArguments::GetArgumentPointer,
+  !! KIM_ModelComputeArguments_GetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_get_argument_pointer_float1( &
+    model_compute_arguments_handle, compute_argument_name, extent1, float1, &
+    ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_argument_pointer_float( &
+        model_compute_arguments, compute_argument_name, ptr) &
+        bind(c, name="KIM_ModelComputeArguments_GetArgumentPointerFloat")
+        use, intrinsic :: iso_c_binding
+        use kim_compute_argument_name_module, only: &
+          kim_compute_argument_name_type
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        type(kim_compute_argument_name_type), intent(in), value :: &
+          compute_argument_name
+        type(c_ptr), intent(out) :: ptr
+      end function get_argument_pointer_float
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    integer(c_int), intent(in) :: extent1
+    real(c_float), intent(out), pointer :: float1(:)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    type(c_ptr) p
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = get_argument_pointer_float(model_compute_arguments, &
+                                      compute_argument_name, p)
+    if (c_associated(p)) then
+      call c_f_pointer(p, float1, [extent1])
+    else
+      nullify (float1)
+    end if
+  end subroutine kim_model_compute_arguments_get_argument_pointer_float1
+
+  !> \brief \copybrief KIM::ModelComputeArguments::GetArgumentPointer
+  !!
+  !! \sa KIM::ModelComputeArguments::GetArgumentPointer,
+  !! KIM_ModelComputeArguments_GetArgumentPointerFloat
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_compute_arguments_get_argument_pointer_float2( &
+    model_compute_arguments_handle, compute_argument_name, extent1, extent2, &
+    float2, ierr)
+    use kim_compute_argument_name_module, only: kim_compute_argument_name_type
+    use kim_interoperable_types_module, only: kim_model_compute_arguments_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_argument_pointer_float( &
+        model_compute_arguments, compute_argument_name, ptr) &
+        bind(c, name="KIM_ModelComputeArguments_GetArgumentPointerFloat")
+        use, intrinsic :: iso_c_binding
+        use kim_compute_argument_name_module, only: &
+          kim_compute_argument_name_type
+        use kim_interoperable_types_module, only: &
+          kim_model_compute_arguments_type
+        implicit none
+        type(kim_model_compute_arguments_type), intent(in) :: &
+          model_compute_arguments
+        type(kim_compute_argument_name_type), intent(in), value :: &
+          compute_argument_name
+        type(c_ptr), intent(out) :: ptr
+      end function get_argument_pointer_float
+    end interface
+    type(kim_model_compute_arguments_handle_type), intent(in) :: &
+      model_compute_arguments_handle
+    type(kim_compute_argument_name_type), intent(in) :: &
+      compute_argument_name
+    integer(c_int), intent(in) :: extent1
+    integer(c_int), intent(in) :: extent2
+    real(c_float), intent(out), pointer :: float2(:, :)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_compute_arguments_type), pointer :: model_compute_arguments
+
+    type(c_ptr) p
+
+    call c_f_pointer(model_compute_arguments_handle%p, model_compute_arguments)
+    ierr = get_argument_pointer_float(model_compute_arguments, &
+                                      compute_argument_name, p)
+    if (c_associated(p)) then
+      call c_f_pointer(p, float2, [extent1, extent2])
+    else
+      nullify (float2)
+    end if
+  end subroutine kim_model_compute_arguments_get_argument_pointer_float2
+
   !> \brief \copybrief KIM::ModelComputeArguments::IsCallbackPresent
   !!
   !! \sa KIM::ModelComputeArguments::IsCallbackPresent,
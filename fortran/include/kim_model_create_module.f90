@@ -48,6 +48,7 @@ module kim_model_create_module
     kim_set_model_numbering, &
     kim_set_influence_distance_pointer, &
     kim_set_neighbor_list_pointers, &
+    kim_set_species_pair_cutoffs_pointer, &
     kim_set_routine_pointer, &
     kim_set_species_code, &
     kim_set_parameter_pointer, &
@@ -115,6 +116,16 @@ module kim_model_create_module
     module procedure kim_model_create_set_neighbor_list_pointers
   end interface kim_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelCreate::SetSpeciesPairCutoffsPointer
+  !!
+  !! \sa KIM::ModelCreate::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelCreate_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  interface kim_set_species_pair_cutoffs_pointer
+    module procedure kim_model_create_set_species_pair_cutoffs_pointer
+  end interface kim_set_species_pair_cutoffs_pointer
+
   !> \brief \copybrief KIM::ModelCreate::SetRoutinePointer
   !!
   !! \sa KIM::ModelCreate::SetRoutinePointer, KIM_ModelCreate_SetRoutinePointer
@@ -319,6 +330,47 @@ contains
       c_loc(model_will_not_request_neighbors_of_noncontributing_particles))
   end subroutine kim_model_create_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelCreate::SetSpeciesPairCutoffsPointer
+  !!
+  !! The Fortran array \c species_pair_cutoffs(k, j, i) holds the cutoff for
+  !! neighbor list \c i and (one-based) species codes \c j and \c k.
+  !!
+  !! \sa KIM::ModelCreate::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelCreate_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_create_set_species_pair_cutoffs_pointer( &
+    model_create_handle, number_of_species_codes, species_pair_cutoffs, &
+    ierr)
+    use kim_interoperable_types_module, only: kim_model_create_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_species_pair_cutoffs_pointer( &
+        model_create, number_of_species_codes, species_pair_cutoffs_ptr) &
+        bind(c, name="KIM_ModelCreate_SetSpeciesPairCutoffsPointer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_create_type
+        implicit none
+        type(kim_model_create_type), intent(in) :: &
+          model_create
+        integer(c_int), intent(in), value :: number_of_species_codes
+        type(c_ptr), intent(in), value :: species_pair_cutoffs_ptr
+      end function set_species_pair_cutoffs_pointer
+    end interface
+    type(kim_model_create_handle_type), intent(in) &
+      :: model_create_handle
+    integer(c_int), intent(in) :: number_of_species_codes
+    real(c_double), intent(in), target :: &
+      species_pair_cutoffs(number_of_species_codes, number_of_species_codes, *)
+    integer(c_int), intent(out) :: ierr
+
+    type(kim_model_create_type), pointer :: model_create
+
+    call c_f_pointer(model_create_handle%p, model_create)
+    ierr = set_species_pair_cutoffs_pointer( &
+      model_create, number_of_species_codes, c_loc(species_pair_cutoffs))
+  end subroutine kim_model_create_set_species_pair_cutoffs_pointer
+
   !> \brief \copybrief KIM::ModelCreate::SetRoutinePointer
   !!
   !! \sa KIM::ModelCreate::SetRoutinePointer, KIM_ModelCreate_SetRoutinePointer
@@ -52,10 +52,13 @@ module kim_model_driver_create_module
     kim_set_model_numbering, &
     kim_set_influence_distance_pointer, &
     kim_set_neighbor_list_pointers, &
+    kim_set_species_pair_cutoffs_pointer, &
     kim_set_routine_pointer, &
     kim_set_species_code, &
     kim_set_parameter_pointer, &
     kim_set_model_buffer_pointer, &
+    kim_declare_shared_buffer, &
+    kim_set_shared_buffer_initialized, &
     kim_set_units, &
     kim_convert_unit, &
     kim_log_entry, &
@@ -163,6 +166,16 @@ module kim_model_driver_create_module
     module procedure kim_model_driver_create_set_neighbor_list_pointers
   end interface kim_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer
+  !!
+  !! \sa KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  interface kim_set_species_pair_cutoffs_pointer
+    module procedure kim_model_driver_create_set_species_pair_cutoffs_pointer
+  end interface kim_set_species_pair_cutoffs_pointer
+
   !> \brief \copybrief KIM::ModelDriverCreate::SetRoutinePointer
   !!
   !! \sa KIM::ModelDriverCreate::SetRoutinePointer,
@@ -205,6 +218,26 @@ module kim_model_driver_create_module
     module procedure kim_model_driver_create_set_model_buffer_pointer
   end interface kim_set_model_buffer_pointer
 
+  !> \brief \copybrief KIM::ModelDriverCreate::DeclareSharedBuffer
+  !!
+  !! \sa KIM::ModelDriverCreate::DeclareSharedBuffer,
+  !! KIM_ModelDriverCreate_DeclareSharedBuffer
+  !!
+  !! \since 2.5
+  interface kim_declare_shared_buffer
+    module procedure kim_model_driver_create_declare_shared_buffer
+  end interface kim_declare_shared_buffer
+
+  !> \brief \copybrief KIM::ModelDriverCreate::SetSharedBufferInitialized
+  !!
+  !! \sa KIM::ModelDriverCreate::SetSharedBufferInitialized,
+  !! KIM_ModelDriverCreate_SetSharedBufferInitialized
+  !!
+  !! \since 2.5
+  interface kim_set_shared_buffer_initialized
+    module procedure kim_model_driver_create_set_shared_buffer_initialized
+  end interface kim_set_shared_buffer_initialized
+
   !> \brief \copybrief KIM::ModelDriverCreate::SetUnits
   !!
   !! \sa KIM::ModelDriverCreate::SetUnits, KIM_ModelDriverCreate_SetUnits
@@ -525,6 +558,49 @@ contains
       c_loc(model_will_not_request_neighbors_of_noncontributing_particles))
   end subroutine kim_model_driver_create_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer
+  !!
+  !! The Fortran array \c species_pair_cutoffs(k, j, i) holds the cutoff for
+  !! neighbor list \c i and (one-based) species codes \c j and \c k.
+  !!
+  !! \sa KIM::ModelDriverCreate::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_driver_create_set_species_pair_cutoffs_pointer( &
+    model_driver_create_handle, number_of_species_codes, species_pair_cutoffs, &
+    ierr)
+    use kim_interoperable_types_module, only: kim_model_driver_create_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_species_pair_cutoffs_pointer( &
+        model_driver_create, number_of_species_codes, &
+        species_pair_cutoffs_ptr) &
+        bind(c, name="KIM_ModelDriverCreate_SetSpeciesPairCutoffsPointer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_driver_create_type
+        implicit none
+        type(kim_model_driver_create_type), intent(in) :: &
+          model_driver_create
+        integer(c_int), intent(in), value :: number_of_species_codes
+        type(c_ptr), intent(in), value :: species_pair_cutoffs_ptr
+      end function set_species_pair_cutoffs_pointer
+    end interface
+    type(kim_model_driver_create_handle_type), intent(in) &
+      :: model_driver_create_handle
+    integer(c_int), intent(in) :: number_of_species_codes
+    real(c_double), intent(in), target :: &
+      species_pair_cutoffs(number_of_species_codes, number_of_species_codes, *)
+    integer(c_int), intent(out) :: ierr
+
+    type(kim_model_driver_create_type), pointer :: model_driver_create
+
+    call c_f_pointer(model_driver_create_handle%p, model_driver_create)
+    ierr = set_species_pair_cutoffs_pointer( &
+      model_driver_create, number_of_species_codes, c_loc(species_pair_cutoffs))
+  end subroutine kim_model_driver_create_set_species_pair_cutoffs_pointer
+
   !> \brief \copybrief KIM::ModelDriverCreate::SetRoutinePointer
   !!
   !! \sa KIM::ModelDriverCreate::SetRoutinePointer,
@@ -756,6 +832,80 @@ contains
     call set_model_buffer_pointer(model_driver_create, ptr)
   end subroutine kim_model_driver_create_set_model_buffer_pointer
 
+  !> \brief \copybrief KIM::ModelDriverCreate::DeclareSharedBuffer
+  !!
+  !! \sa KIM::ModelDriverCreate::DeclareSharedBuffer,
+  !! KIM_ModelDriverCreate_DeclareSharedBuffer
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_driver_create_declare_shared_buffer( &
+    model_driver_create_handle, buffer_name, number_of_bytes, buffer, &
+    must_initialize, ierr)
+    use kim_interoperable_types_module, only: kim_model_driver_create_type
+    implicit none
+    interface
+      integer(c_int) recursive function declare_shared_buffer( &
+        model_driver_create, buffer_name, number_of_bytes, buffer, &
+        must_initialize) &
+        bind(c, name="KIM_ModelDriverCreate_DeclareSharedBuffer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_driver_create_type
+        implicit none
+        type(kim_model_driver_create_type), intent(in) &
+          :: model_driver_create
+        character(c_char), intent(in) :: buffer_name(*)
+        integer(c_long), intent(in), value :: number_of_bytes
+        type(c_ptr), intent(out) :: buffer
+        integer(c_int), intent(out) :: must_initialize
+      end function declare_shared_buffer
+    end interface
+    type(kim_model_driver_create_handle_type), intent(in) &
+      :: model_driver_create_handle
+    character(len=*, kind=c_char), intent(in) :: buffer_name
+    integer(c_long), intent(in) :: number_of_bytes
+    type(c_ptr), intent(out) :: buffer
+    integer(c_int), intent(out) :: must_initialize
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_driver_create_type), pointer :: model_driver_create
+
+    call c_f_pointer(model_driver_create_handle%p, model_driver_create)
+    ierr = declare_shared_buffer(model_driver_create, &
+                                 trim(buffer_name)//c_null_char, &
+                                 number_of_bytes, buffer, must_initialize)
+  end subroutine kim_model_driver_create_declare_shared_buffer
+
+  !> \brief \copybrief KIM::ModelDriverCreate::SetSharedBufferInitialized
+  !!
+  !! \sa KIM::ModelDriverCreate::SetSharedBufferInitialized,
+  !! KIM_ModelDriverCreate_SetSharedBufferInitialized
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_driver_create_set_shared_buffer_initialized( &
+    model_driver_create_handle, buffer, ierr)
+    use kim_interoperable_types_module, only: kim_model_driver_create_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_shared_buffer_initialized( &
+        model_driver_create, buffer) &
+        bind(c, name="KIM_ModelDriverCreate_SetSharedBufferInitialized")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_driver_create_type
+        implicit none
+        type(kim_model_driver_create_type), intent(in) &
+          :: model_driver_create
+        type(c_ptr), intent(in), value :: buffer
+      end function set_shared_buffer_initialized
+    end interface
+    type(kim_model_driver_create_handle_type), intent(in) &
+      :: model_driver_create_handle
+    type(c_ptr), intent(in) :: buffer
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_driver_create_type), pointer :: model_driver_create
+
+    call c_f_pointer(model_driver_create_handle%p, model_driver_create)
+    ierr = set_shared_buffer_initialized(model_driver_create, buffer)
+  end subroutine kim_model_driver_create_set_shared_buffer_initialized
+
   !> \brief \copybrief KIM::ModelDriverCreate::SetUnits
   !!
   !! \sa KIM::ModelDriverCreate::SetUnits, KIM_ModelDriverCreate_SetUnits
@@ -46,23 +46,35 @@ module kim_model_module
     operator(.eq.), &
     operator(.ne.), &
     kim_model_create, &
+    kim_model_create_from_library_path, &
     kim_model_destroy, &
     kim_is_routine_present, &
     kim_get_influence_distance, &
     kim_get_number_of_neighbor_lists, &
     kim_get_neighbor_list_values, &
+    kim_get_species_pair_cutoffs_extent, &
+    kim_get_species_pair_cutoffs_values, &
     kim_get_units, &
     kim_compute_arguments_create, &
     kim_compute_arguments_destroy, &
     kim_compute, &
+    kim_compute_ensemble, &
     kim_extension, &
     kim_clear_then_refresh, &
     kim_write_parameterized_model, &
+    kim_set_statistics_enabled, &
+    kim_get_statistics, &
+    kim_reset_statistics, &
     kim_get_species_support_and_code, &
     kim_get_number_of_parameters, &
     kim_get_parameter_metadata, &
     kim_get_parameter, &
     kim_set_parameter, &
+    kim_get_parameter_array, &
+    kim_set_parameter_array, &
+    kim_get_parameter_vector_size, &
+    kim_get_parameter_vector, &
+    kim_set_parameter_vector, &
     kim_set_simulator_buffer_pointer, &
     kim_get_simulator_buffer_pointer, &
     kim_to_string, &
@@ -135,6 +147,27 @@ module kim_model_module
     module procedure kim_model_get_neighbor_list_values
   end interface kim_get_neighbor_list_values
 
+  !> \brief Get Model's number of species codes used to index the species
+  !! pair cutoffs.
+  !!
+  !! \sa KIM::Model::GetSpeciesPairCutoffsPointer,
+  !! KIM_Model_GetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  interface kim_get_species_pair_cutoffs_extent
+    module procedure kim_model_get_species_pair_cutoffs_extent
+  end interface kim_get_species_pair_cutoffs_extent
+
+  !> \brief Get Model's species pair cutoffs values
+  !!
+  !! \sa KIM::Model::GetSpeciesPairCutoffsPointer,
+  !! KIM_Model_GetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  interface kim_get_species_pair_cutoffs_values
+    module procedure kim_model_get_species_pair_cutoffs_values
+  end interface kim_get_species_pair_cutoffs_values
+
   !> \brief \copybrief KIM::Model::GetUnits
   !!
   !! \sa KIM::Model::GetUnits, KIM_Model_GetUnits
@@ -171,6 +204,15 @@ module kim_model_module
     module procedure kim_model_compute
   end interface kim_compute
 
+  !> \brief \copybrief KIM::Model::ComputeEnsemble
+  !!
+  !! \sa KIM::Model::ComputeEnsemble, KIM_Model_ComputeEnsemble
+  !!
+  !! \since 2.5
+  interface kim_compute_ensemble
+    module procedure kim_model_compute_ensemble
+  end interface kim_compute_ensemble
+
   !> \brief \copybrief KIM::Model::Extension
   !!
   !! \sa KIM::Model::Extension, KIM_Model_Extension
@@ -198,6 +240,33 @@ module kim_model_module
     module procedure kim_model_write_parameterized_model
   end interface kim_write_parameterized_model
 
+  !> \brief \copybrief KIM::Model::SetStatisticsEnabled
+  !!
+  !! \sa KIM::Model::SetStatisticsEnabled, KIM_Model_SetStatisticsEnabled
+  !!
+  !! \since 2.5
+  interface kim_set_statistics_enabled
+    module procedure kim_model_set_statistics_enabled
+  end interface kim_set_statistics_enabled
+
+  !> \brief \copybrief KIM::Model::GetStatistics
+  !!
+  !! \sa KIM::Model::GetStatistics, KIM_Model_GetStatistics
+  !!
+  !! \since 2.5
+  interface kim_get_statistics
+    module procedure kim_model_get_statistics
+  end interface kim_get_statistics
+
+  !> \brief \copybrief KIM::Model::ResetStatistics
+  !!
+  !! \sa KIM::Model::ResetStatistics, KIM_Model_ResetStatistics
+  !!
+  !! \since 2.5
+  interface kim_reset_statistics
+    module procedure kim_model_reset_statistics
+  end interface kim_reset_statistics
+
   !> \brief \copybrief KIM::Model::GetSpeciesSupportAndCode
   !!
   !! \sa KIM::Model::GetSpeciesSupportAndCode,
@@ -248,6 +317,55 @@ module kim_model_module
     module procedure kim_model_set_parameter_double
   end interface kim_set_parameter
 
+  !> \brief \copybrief KIM::Model::GetParameterArray
+  !!
+  !! \sa KIM::Model::GetParameterArray, KIM_Model_GetParameterArrayInteger,
+  !! KIM_Model_GetParameterArrayDouble
+  !!
+  !! \since 2.5
+  interface kim_get_parameter_array
+    module procedure kim_model_get_parameter_array_integer
+    module procedure kim_model_get_parameter_array_double
+  end interface kim_get_parameter_array
+
+  !> \brief \copybrief KIM::Model::SetParameterArray
+  !!
+  !! \sa KIM::Model::SetParameterArray, KIM_Model_SetParameterArrayInteger,
+  !! KIM_Model_SetParameterArrayDouble
+  !!
+  !! \since 2.5
+  interface kim_set_parameter_array
+    module procedure kim_model_set_parameter_array_integer
+    module procedure kim_model_set_parameter_array_double
+  end interface kim_set_parameter_array
+
+  !> \brief \copybrief KIM::Model::GetParameterVectorSize
+  !!
+  !! \sa KIM::Model::GetParameterVectorSize, KIM_Model_GetParameterVectorSize
+  !!
+  !! \since 2.5
+  interface kim_get_parameter_vector_size
+    module procedure kim_model_get_parameter_vector_size
+  end interface kim_get_parameter_vector_size
+
+  !> \brief \copybrief KIM::Model::GetParameterVector
+  !!
+  !! \sa KIM::Model::GetParameterVector, KIM_Model_GetParameterVector
+  !!
+  !! \since 2.5
+  interface kim_get_parameter_vector
+    module procedure kim_model_get_parameter_vector
+  end interface kim_get_parameter_vector
+
+  !> \brief \copybrief KIM::Model::SetParameterVector
+  !!
+  !! \sa KIM::Model::SetParameterVector, KIM_Model_SetParameterVector
+  !!
+  !! \since 2.5
+  interface kim_set_parameter_vector
+    module procedure kim_model_set_parameter_vector
+  end interface kim_set_parameter_vector
+
   !> \brief \copybrief KIM::Model::SetSimulatorBufferPointer
   !!
   !! \sa KIM::Model::SetSimulatorBufferPointer,
@@ -446,6 +564,86 @@ contains
     model_handle%p = pmodel
   end subroutine kim_model_create
 
+  !> \brief \copybrief KIM::Model::CreateFromLibraryPath
+  !!
+  !! If \c driver_library_path is not present the Model Driver of a
+  !! parameterized model is found in the collections.
+  !!
+  !! \sa KIM::Model::CreateFromLibraryPath, KIM_Model_CreateFromLibraryPath
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_create_from_library_path( &
+    numbering, requested_length_unit, requested_energy_unit, &
+    requested_charge_unit, requested_temperature_unit, requested_time_unit, &
+    model_library_path, requested_units_accepted, model_handle, ierr, &
+    driver_library_path)
+    use kim_numbering_module, only: kim_numbering_type
+    use kim_unit_system_module, only: kim_length_unit_type, &
+                                      kim_energy_unit_type, &
+                                      kim_charge_unit_type, &
+                                      kim_temperature_unit_type, &
+                                      kim_time_unit_type
+    implicit none
+    interface
+      integer(c_int) recursive function create_from_library_path( &
+        numbering, requested_length_unit, requested_energy_unit, &
+        requested_charge_unit, requested_temperature_unit, &
+        requested_time_unit, model_library_path, driver_library_path, &
+        requested_units_accepted, model) &
+        bind(c, name="KIM_Model_CreateFromLibraryPath")
+        use, intrinsic :: iso_c_binding
+        use kim_numbering_module, only: kim_numbering_type
+        use kim_unit_system_module, only: kim_length_unit_type, &
+                                          kim_energy_unit_type, &
+                                          kim_charge_unit_type, &
+                                          kim_temperature_unit_type, &
+                                          kim_time_unit_type
+        implicit none
+        type(kim_numbering_type), intent(in), value :: numbering
+        type(kim_length_unit_type), intent(in), value :: requested_length_unit
+        type(kim_energy_unit_type), intent(in), value :: requested_energy_unit
+        type(kim_charge_unit_type), intent(in), value :: requested_charge_unit
+        type(kim_temperature_unit_type), intent(in), value :: &
+          requested_temperature_unit
+        type(kim_time_unit_type), intent(in), value :: requested_time_unit
+        character(c_char), intent(in) :: model_library_path(*)
+        character(c_char), intent(in) :: driver_library_path(*)
+        integer(c_int), intent(out) :: requested_units_accepted
+        type(c_ptr), intent(out) :: model
+      end function create_from_library_path
+    end interface
+    type(kim_numbering_type), intent(in) :: numbering
+    type(kim_length_unit_type), intent(in) :: requested_length_unit
+    type(kim_energy_unit_type), intent(in) :: requested_energy_unit
+    type(kim_charge_unit_type), intent(in) :: requested_charge_unit
+    type(kim_temperature_unit_type), intent(in) :: &
+      requested_temperature_unit
+    type(kim_time_unit_type), intent(in) :: requested_time_unit
+    character(len=*, kind=c_char), intent(in) :: model_library_path
+    integer(c_int), intent(out) :: requested_units_accepted
+    type(kim_model_handle_type), intent(out) :: model_handle
+    integer(c_int), intent(out) :: ierr
+    character(len=*, kind=c_char), intent(in), optional :: driver_library_path
+
+    type(c_ptr) :: pmodel
+
+    if (present(driver_library_path)) then
+      ierr = create_from_library_path( &
+             numbering, requested_length_unit, requested_energy_unit, &
+             requested_charge_unit, requested_temperature_unit, &
+             requested_time_unit, trim(model_library_path)//c_null_char, &
+             trim(driver_library_path)//c_null_char, &
+             requested_units_accepted, pmodel)
+    else
+      ierr = create_from_library_path( &
+             numbering, requested_length_unit, requested_energy_unit, &
+             requested_charge_unit, requested_temperature_unit, &
+             requested_time_unit, trim(model_library_path)//c_null_char, &
+             c_null_char, requested_units_accepted, pmodel)
+    end if
+    model_handle%p = pmodel
+  end subroutine kim_model_create_from_library_path
+
   !> \brief \copybrief KIM::Model::Destroy
   !!
   !! A Fortran PM must provide a KIM::MODEL_ROUTINE_NAME::Destroy routine.  The
@@ -660,6 +858,118 @@ contains
     end if
   end subroutine kim_model_get_neighbor_list_values
 
+  !> \brief Get Model's number of species codes used to index the species
+  !! pair cutoffs.
+  !!
+  !! A value of zero indicates that the Model does not provide species pair
+  !! cutoffs.
+  !!
+  !! \sa KIM::Model::GetSpeciesPairCutoffsPointer,
+  !! KIM_Model_GetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_species_pair_cutoffs_extent( &
+    model_handle, number_of_species_codes)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine get_species_pair_cutoffs_pointer( &
+        model, number_of_species_codes, species_pair_cutoffs_ptr) &
+        bind(c, name="KIM_Model_GetSpeciesPairCutoffsPointer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(out) :: number_of_species_codes
+        type(c_ptr), intent(out) :: species_pair_cutoffs_ptr
+      end subroutine get_species_pair_cutoffs_pointer
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(out) :: number_of_species_codes
+    type(kim_model_type), pointer :: model
+
+    type(c_ptr) species_pair_cutoffs_ptr
+
+    call c_f_pointer(model_handle%p, model)
+    call get_species_pair_cutoffs_pointer(model, number_of_species_codes, &
+                                          species_pair_cutoffs_ptr)
+  end subroutine kim_model_get_species_pair_cutoffs_extent
+
+  !> \brief Get Model's species pair cutoffs values
+  !!
+  !! On return \c species_pair_cutoffs(k, j, i) holds the cutoff for neighbor
+  !! list \c i and (one-based) species codes \c j and \c k.
+  !!
+  !! \sa KIM::Model::GetSpeciesPairCutoffsPointer,
+  !! KIM_Model_GetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_species_pair_cutoffs_values( &
+    model_handle, species_pair_cutoffs, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine get_neighbor_list_pointers( &
+        model, number_of_neighbor_lists, cutoffs_ptr, &
+        model_will_not_request_neighbors_of_noncontributing__ptr) &
+        bind(c, name="KIM_Model_GetNeighborListPointers")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(out) :: number_of_neighbor_lists
+        type(c_ptr), intent(out) :: cutoffs_ptr
+        type(c_ptr), intent(out) :: &
+          model_will_not_request_neighbors_of_noncontributing__ptr
+      end subroutine get_neighbor_list_pointers
+
+      recursive subroutine get_species_pair_cutoffs_pointer( &
+        model, number_of_species_codes, species_pair_cutoffs_ptr) &
+        bind(c, name="KIM_Model_GetSpeciesPairCutoffsPointer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(out) :: number_of_species_codes
+        type(c_ptr), intent(out) :: species_pair_cutoffs_ptr
+      end subroutine get_species_pair_cutoffs_pointer
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    real(c_double), intent(out) :: species_pair_cutoffs(:, :, :)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    integer(c_int) number_of_neighbor_lists
+    integer(c_int) number_of_species_codes
+    real(c_double), pointer :: species_pair_cutoffs_fpointer(:, :, :)
+    type(c_ptr) cutoffs_ptr, hint_ptr
+    type(c_ptr) species_pair_cutoffs_ptr
+
+    call c_f_pointer(model_handle%p, model)
+    call get_neighbor_list_pointers(model, number_of_neighbor_lists, &
+                                    cutoffs_ptr, hint_ptr)
+    call get_species_pair_cutoffs_pointer(model, number_of_species_codes, &
+                                          species_pair_cutoffs_ptr)
+    if (.not. c_associated(species_pair_cutoffs_ptr)) then
+      ierr = 1
+    else if ((size(species_pair_cutoffs, 1) < number_of_species_codes) &
+             .or. (size(species_pair_cutoffs, 2) < number_of_species_codes) &
+             .or. (size(species_pair_cutoffs, 3) &
+                   < number_of_neighbor_lists)) then
+      ierr = 1
+    else
+      ierr = 0
+      call c_f_pointer(species_pair_cutoffs_ptr, &
+                       species_pair_cutoffs_fpointer, &
+                       [number_of_species_codes, number_of_species_codes, &
+                        number_of_neighbor_lists])
+      species_pair_cutoffs(1:number_of_species_codes, &
+                           1:number_of_species_codes, &
+                           1:number_of_neighbor_lists) = &
+        species_pair_cutoffs_fpointer
+    end if
+  end subroutine kim_model_get_species_pair_cutoffs_values
+
   !> \brief \copybrief KIM::Model::GetUnits
   !!
   !! \sa KIM::Model::GetUnits, KIM_Model_GetUnits
@@ -878,6 +1188,50 @@ contains
     ierr = compute(model, compute_arguments)
   end subroutine kim_model_compute
 
+  !> \brief \copybrief KIM::Model::ComputeEnsemble
+  !!
+  !! The number of members is the size of \c model_handles, which must equal
+  !! the size of \c compute_arguments_handles.
+  !!
+  !! \sa KIM::Model::ComputeEnsemble, KIM_Model_ComputeEnsemble
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_compute_ensemble( &
+    model_handles, compute_arguments_handles, ierr)
+    use kim_compute_arguments_module, only: kim_compute_arguments_handle_type
+    implicit none
+    interface
+      integer(c_int) recursive function compute_ensemble( &
+        number_of_members, models, compute_arguments) &
+        bind(c, name="KIM_Model_ComputeEnsemble")
+        use, intrinsic :: iso_c_binding
+        implicit none
+        integer(c_int), intent(in), value :: number_of_members
+        type(c_ptr), intent(in) :: models(*)
+        type(c_ptr), intent(in) :: compute_arguments(*)
+      end function compute_ensemble
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handles(:)
+    type(kim_compute_arguments_handle_type), intent(in) :: &
+      compute_arguments_handles(:)
+    integer(c_int), intent(out) :: ierr
+    type(c_ptr) :: models(size(model_handles))
+    type(c_ptr) :: compute_arguments(size(model_handles))
+    integer(c_int) :: i
+
+    if (size(compute_arguments_handles) /= size(model_handles)) then
+      ierr = 1
+      return
+    end if
+
+    do i = 1, size(model_handles)
+      models(i) = model_handles(i)%p
+      compute_arguments(i) = compute_arguments_handles(i)%p
+    end do
+    ierr = compute_ensemble(int(size(model_handles), c_int), models, &
+                            compute_arguments)
+  end subroutine kim_model_compute_ensemble
+
   !> \brief \copybrief KIM::Model::Extension
   !!
   !! A Fortran PM may provide a KIM::MODEL_ROUTINE_NAME::Extension routine.
@@ -1023,6 +1377,103 @@ contains
                                      trim(model_name)//c_null_char)
   end subroutine kim_model_write_parameterized_model
 
+  !> \brief \copybrief KIM::Model::SetStatisticsEnabled
+  !!
+  !! \sa KIM::Model::SetStatisticsEnabled, KIM_Model_SetStatisticsEnabled
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_set_statistics_enabled(model_handle, enabled)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine set_statistics_enabled(model, enabled) &
+        bind(c, name="KIM_Model_SetStatisticsEnabled")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: enabled
+      end subroutine set_statistics_enabled
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: enabled
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    call set_statistics_enabled(model, enabled)
+  end subroutine kim_model_set_statistics_enabled
+
+  !> \brief \copybrief KIM::Model::GetStatistics
+  !!
+  !! \sa KIM::Model::GetStatistics, KIM_Model_GetStatistics
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_statistics( &
+    model_handle, compute_calls, compute_time, neighbor_list_calls, &
+    neighbor_list_time, neighbors_served, process_term_calls, &
+    process_term_time)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine get_statistics( &
+        model, compute_calls, compute_time, neighbor_list_calls, &
+        neighbor_list_time, neighbors_served, process_term_calls, &
+        process_term_time) &
+        bind(c, name="KIM_Model_GetStatistics")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_long), intent(out) :: compute_calls
+        real(c_double), intent(out) :: compute_time
+        integer(c_long), intent(out) :: neighbor_list_calls
+        real(c_double), intent(out) :: neighbor_list_time
+        integer(c_long), intent(out) :: neighbors_served
+        integer(c_long), intent(out) :: process_term_calls
+        real(c_double), intent(out) :: process_term_time
+      end subroutine get_statistics
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_long), intent(out) :: compute_calls
+    real(c_double), intent(out) :: compute_time
+    integer(c_long), intent(out) :: neighbor_list_calls
+    real(c_double), intent(out) :: neighbor_list_time
+    integer(c_long), intent(out) :: neighbors_served
+    integer(c_long), intent(out) :: process_term_calls
+    real(c_double), intent(out) :: process_term_time
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    call get_statistics(model, compute_calls, compute_time, &
+                        neighbor_list_calls, neighbor_list_time, &
+                        neighbors_served, process_term_calls, &
+                        process_term_time)
+  end subroutine kim_model_get_statistics
+
+  !> \brief \copybrief KIM::Model::ResetStatistics
+  !!
+  !! \sa KIM::Model::ResetStatistics, KIM_Model_ResetStatistics
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_reset_statistics(model_handle)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine reset_statistics(model) &
+        bind(c, name="KIM_Model_ResetStatistics")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+      end subroutine reset_statistics
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    call reset_statistics(model)
+  end subroutine kim_model_reset_statistics
+
   !> \brief \copybrief KIM::Model::GetSpeciesSupportAndCode
   !!
   !! \sa KIM::Model::GetSpeciesSupportAndCode,
@@ -1269,6 +1720,252 @@ contains
                                 parameter_value)
   end subroutine kim_model_set_parameter_double
 
+  !> \brief \copybrief KIM::Model::GetParameterArray
+  !!
+  !! The range starts at the (one-based) \c array_index.
+  !!
+  !! \sa KIM::Model::GetParameterArray, KIM_Model_GetParameterArrayInteger
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_parameter_array_integer( &
+    model_handle, parameter_index, array_index, count, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_parameter_array_integer( &
+        model, parameter_index, offset, count, parameter_values) &
+        bind(c, name="KIM_Model_GetParameterArrayInteger")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(in), value :: offset
+        integer(c_int), intent(in), value :: count
+        integer(c_int), intent(out) :: parameter_values(*)
+      end function get_parameter_array_integer
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(in) :: array_index
+    integer(c_int), intent(in) :: count
+    integer(c_int), intent(out) :: parameter_values(count)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = get_parameter_array_integer( &
+           model, parameter_index - 1, array_index - 1, count, &
+           parameter_values)
+  end subroutine kim_model_get_parameter_array_integer
+
+  !> \brief \copybrief KIM::Model::GetParameterArray
+  !!
+  !! The range starts at the (one-based) \c array_index.
+  !!
+  !! \sa KIM::Model::GetParameterArray, KIM_Model_GetParameterArrayDouble
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_parameter_array_double( &
+    model_handle, parameter_index, array_index, count, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_parameter_array_double( &
+        model, parameter_index, offset, count, parameter_values) &
+        bind(c, name="KIM_Model_GetParameterArrayDouble")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(in), value :: offset
+        integer(c_int), intent(in), value :: count
+        real(c_double), intent(out) :: parameter_values(*)
+      end function get_parameter_array_double
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(in) :: array_index
+    integer(c_int), intent(in) :: count
+    real(c_double), intent(out) :: parameter_values(count)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = get_parameter_array_double( &
+           model, parameter_index - 1, array_index - 1, count, &
+           parameter_values)
+  end subroutine kim_model_get_parameter_array_double
+
+  !> \brief \copybrief KIM::Model::SetParameterArray
+  !!
+  !! The range starts at the (one-based) \c array_index.
+  !!
+  !! \sa KIM::Model::SetParameterArray, KIM_Model_SetParameterArrayInteger
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_set_parameter_array_integer( &
+    model_handle, parameter_index, array_index, count, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_parameter_array_integer( &
+        model, parameter_index, offset, count, parameter_values) &
+        bind(c, name="KIM_Model_SetParameterArrayInteger")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(in), value :: offset
+        integer(c_int), intent(in), value :: count
+        integer(c_int), intent(in) :: parameter_values(*)
+      end function set_parameter_array_integer
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(in) :: array_index
+    integer(c_int), intent(in) :: count
+    integer(c_int), intent(in) :: parameter_values(count)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = set_parameter_array_integer( &
+           model, parameter_index - 1, array_index - 1, count, &
+           parameter_values)
+  end subroutine kim_model_set_parameter_array_integer
+
+  !> \brief \copybrief KIM::Model::SetParameterArray
+  !!
+  !! The range starts at the (one-based) \c array_index.
+  !!
+  !! \sa KIM::Model::SetParameterArray, KIM_Model_SetParameterArrayDouble
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_set_parameter_array_double( &
+    model_handle, parameter_index, array_index, count, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_parameter_array_double( &
+        model, parameter_index, offset, count, parameter_values) &
+        bind(c, name="KIM_Model_SetParameterArrayDouble")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(in), value :: offset
+        integer(c_int), intent(in), value :: count
+        real(c_double), intent(in) :: parameter_values(*)
+      end function set_parameter_array_double
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(in) :: array_index
+    integer(c_int), intent(in) :: count
+    real(c_double), intent(in) :: parameter_values(count)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = set_parameter_array_double( &
+           model, parameter_index - 1, array_index - 1, count, &
+           parameter_values)
+  end subroutine kim_model_set_parameter_array_double
+
+  !> \brief \copybrief KIM::Model::GetParameterVectorSize
+  !!
+  !! \sa KIM::Model::GetParameterVectorSize, KIM_Model_GetParameterVectorSize
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_parameter_vector_size( &
+    model_handle, parameter_vector_size)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      recursive subroutine get_parameter_vector_size( &
+        model, parameter_vector_size) &
+        bind(c, name="KIM_Model_GetParameterVectorSize")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(out) :: parameter_vector_size
+      end subroutine get_parameter_vector_size
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(out) :: parameter_vector_size
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    call get_parameter_vector_size(model, parameter_vector_size)
+  end subroutine kim_model_get_parameter_vector_size
+
+  !> \brief \copybrief KIM::Model::GetParameterVector
+  !!
+  !! \sa KIM::Model::GetParameterVector, KIM_Model_GetParameterVector
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_get_parameter_vector( &
+    model_handle, parameter_vector_size, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_parameter_vector( &
+        model, parameter_vector_size, parameter_values) &
+        bind(c, name="KIM_Model_GetParameterVector")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_vector_size
+        real(c_double), intent(out) :: parameter_values(*)
+      end function get_parameter_vector
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_vector_size
+    real(c_double), intent(out) :: parameter_values(parameter_vector_size)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = get_parameter_vector(model, parameter_vector_size, parameter_values)
+  end subroutine kim_model_get_parameter_vector
+
+  !> \brief \copybrief KIM::Model::SetParameterVector
+  !!
+  !! \sa KIM::Model::SetParameterVector, KIM_Model_SetParameterVector
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_set_parameter_vector( &
+    model_handle, parameter_vector_size, parameter_values, ierr)
+    use kim_interoperable_types_module, only: kim_model_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_parameter_vector( &
+        model, parameter_vector_size, parameter_values) &
+        bind(c, name="KIM_Model_SetParameterVector")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_type
+        implicit none
+        type(kim_model_type), intent(in) :: model
+        integer(c_int), intent(in), value :: parameter_vector_size
+        real(c_double), intent(in) :: parameter_values(*)
+      end function set_parameter_vector
+    end interface
+    type(kim_model_handle_type), intent(in) :: model_handle
+    integer(c_int), intent(in) :: parameter_vector_size
+    real(c_double), intent(in) :: parameter_values(parameter_vector_size)
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_type), pointer :: model
+
+    call c_f_pointer(model_handle%p, model)
+    ierr = set_parameter_vector(model, parameter_vector_size, parameter_values)
+  end subroutine kim_model_set_parameter_vector
+
   !> \brief \copybrief KIM::Model::SetSimulatorBufferPointer
   !!
   !! \sa KIM::Model::SetSimulatorBufferPointer,
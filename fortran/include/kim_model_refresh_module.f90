@@ -47,6 +47,9 @@ module kim_model_refresh_module
     operator(.ne.), &
     kim_set_influence_distance_pointer, &
     kim_set_neighbor_list_pointers, &
+    kim_set_species_pair_cutoffs_pointer, &
+    kim_get_number_of_changed_parameter_elements, &
+    kim_get_changed_parameter_element, &
     kim_get_model_buffer_pointer, &
     kim_log_entry, &
     kim_to_string
@@ -100,6 +103,37 @@ module kim_model_refresh_module
     module procedure kim_model_refresh_set_neighbor_list_pointers
   end interface kim_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelRefresh::SetSpeciesPairCutoffsPointer
+  !!
+  !! \sa KIM::ModelRefresh::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelRefresh_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  interface kim_set_species_pair_cutoffs_pointer
+    module procedure kim_model_refresh_set_species_pair_cutoffs_pointer
+  end interface kim_set_species_pair_cutoffs_pointer
+
+  !> \brief \copybrief KIM::ModelRefresh::GetNumberOfChangedParameterElements
+  !!
+  !! \sa KIM::ModelRefresh::GetNumberOfChangedParameterElements,
+  !! KIM_ModelRefresh_GetNumberOfChangedParameterElements
+  !!
+  !! \since 2.5
+  interface kim_get_number_of_changed_parameter_elements
+    module procedure &
+      kim_model_refresh_get_number_of_changed_parameter_elements
+  end interface kim_get_number_of_changed_parameter_elements
+
+  !> \brief \copybrief KIM::ModelRefresh::GetChangedParameterElement
+  !!
+  !! \sa KIM::ModelRefresh::GetChangedParameterElement,
+  !! KIM_ModelRefresh_GetChangedParameterElement
+  !!
+  !! \since 2.5
+  interface kim_get_changed_parameter_element
+    module procedure kim_model_refresh_get_changed_parameter_element
+  end interface kim_get_changed_parameter_element
+
   !> \brief \copybrief KIM::ModelRefresh::GetModelBufferPointer
   !!
   !! \sa KIM::ModelRefresh::GetModelBufferPointer,
@@ -227,6 +261,122 @@ contains
       c_loc(modelWillNotRequestNeighborsOfNoncontributingParticles))
   end subroutine kim_model_refresh_set_neighbor_list_pointers
 
+  !> \brief \copybrief KIM::ModelRefresh::SetSpeciesPairCutoffsPointer
+  !!
+  !! The Fortran array \c species_pair_cutoffs(k, j, i) holds the cutoff for
+  !! neighbor list \c i and (one-based) species codes \c j and \c k.
+  !!
+  !! \sa KIM::ModelRefresh::SetSpeciesPairCutoffsPointer,
+  !! KIM_ModelRefresh_SetSpeciesPairCutoffsPointer
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_refresh_set_species_pair_cutoffs_pointer( &
+    model_refresh_handle, number_of_species_codes, species_pair_cutoffs, &
+    ierr)
+    use kim_interoperable_types_module, only: kim_model_refresh_type
+    implicit none
+    interface
+      integer(c_int) recursive function set_species_pair_cutoffs_pointer( &
+        model_refresh, number_of_species_codes, species_pair_cutoffs_ptr) &
+        bind(c, name="KIM_ModelRefresh_SetSpeciesPairCutoffsPointer")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_refresh_type
+        implicit none
+        type(kim_model_refresh_type), intent(in) :: &
+          model_refresh
+        integer(c_int), intent(in), value :: number_of_species_codes
+        type(c_ptr), intent(in), value :: species_pair_cutoffs_ptr
+      end function set_species_pair_cutoffs_pointer
+    end interface
+    type(kim_model_refresh_handle_type), intent(in) &
+      :: model_refresh_handle
+    integer(c_int), intent(in) :: number_of_species_codes
+    real(c_double), intent(in), target :: &
+      species_pair_cutoffs(number_of_species_codes, number_of_species_codes, *)
+    integer(c_int), intent(out) :: ierr
+
+    type(kim_model_refresh_type), pointer :: model_refresh
+
+    call c_f_pointer(model_refresh_handle%p, model_refresh)
+    ierr = set_species_pair_cutoffs_pointer( &
+      model_refresh, number_of_species_codes, c_loc(species_pair_cutoffs))
+  end subroutine kim_model_refresh_set_species_pair_cutoffs_pointer
+
+  !> \brief \copybrief KIM::ModelRefresh::GetNumberOfChangedParameterElements
+  !!
+  !! \sa KIM::ModelRefresh::GetNumberOfChangedParameterElements,
+  !! KIM_ModelRefresh_GetNumberOfChangedParameterElements
+  !!
+  !! \since 2.5
+  recursive subroutine &
+    kim_model_refresh_get_number_of_changed_parameter_elements( &
+    model_refresh_handle, parameter_index, number_of_changed_elements, ierr)
+    use kim_interoperable_types_module, only: kim_model_refresh_type
+    implicit none
+    interface
+      integer(c_int) recursive function &
+        get_number_of_changed_parameter_elements( &
+        model_refresh, parameter_index, number_of_changed_elements) &
+        bind(c, name="KIM_ModelRefresh_GetNumberOfChangedParameterElements")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_refresh_type
+        implicit none
+        type(kim_model_refresh_type), intent(in) :: &
+          model_refresh
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(out) :: number_of_changed_elements
+      end function get_number_of_changed_parameter_elements
+    end interface
+    type(kim_model_refresh_handle_type), intent(in) :: model_refresh_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(out) :: number_of_changed_elements
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_refresh_type), pointer :: model_refresh
+
+    call c_f_pointer(model_refresh_handle%p, model_refresh)
+    ierr = get_number_of_changed_parameter_elements( &
+           model_refresh, parameter_index - 1, number_of_changed_elements)
+  end subroutine kim_model_refresh_get_number_of_changed_parameter_elements
+
+  !> \brief \copybrief KIM::ModelRefresh::GetChangedParameterElement
+  !!
+  !! The parameter, changed element, and array indices are one-based.
+  !!
+  !! \sa KIM::ModelRefresh::GetChangedParameterElement,
+  !! KIM_ModelRefresh_GetChangedParameterElement
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_refresh_get_changed_parameter_element( &
+    model_refresh_handle, parameter_index, index, array_index, ierr)
+    use kim_interoperable_types_module, only: kim_model_refresh_type
+    implicit none
+    interface
+      integer(c_int) recursive function get_changed_parameter_element( &
+        model_refresh, parameter_index, index, array_index) &
+        bind(c, name="KIM_ModelRefresh_GetChangedParameterElement")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_model_refresh_type
+        implicit none
+        type(kim_model_refresh_type), intent(in) :: &
+          model_refresh
+        integer(c_int), intent(in), value :: parameter_index
+        integer(c_int), intent(in), value :: index
+        integer(c_int), intent(out) :: array_index
+      end function get_changed_parameter_element
+    end interface
+    type(kim_model_refresh_handle_type), intent(in) :: model_refresh_handle
+    integer(c_int), intent(in) :: parameter_index
+    integer(c_int), intent(in) :: index
+    integer(c_int), intent(out) :: array_index
+    integer(c_int), intent(out) :: ierr
+    type(kim_model_refresh_type), pointer :: model_refresh
+
+    call c_f_pointer(model_refresh_handle%p, model_refresh)
+    ierr = get_changed_parameter_element(model_refresh, parameter_index - 1, &
+                                         index - 1, array_index)
+    if (ierr == 0) array_index = array_index + 1
+  end subroutine kim_model_refresh_get_changed_parameter_element
+
   !> \brief \copybrief KIM::ModelRefresh::GetModelBufferPointer
   !!
   !! \sa KIM::ModelRefresh::GetModelBufferPointer,
@@ -0,0 +1,275 @@
+!
+! KIM-API: An API for interatomic models
+! Copyright (c) 2013--2022, Regents of the University of Minnesota.
+! All rights reserved.
+!
+! Contributors:
+!    Ryan S. Elliott
+!
+! SPDX-License-Identifier: LGPL-2.1-or-later
+!
+! This library is free software; you can redistribute it and/or
+! modify it under the terms of the GNU Lesser General Public
+! License as published by the Free Software Foundation; either
+! version 2.1 of the License, or (at your option) any later version.
+!
+! This library is distributed in the hope that it will be useful,
+! but WITHOUT ANY WARRANTY; without even the implied warranty of
+! MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+! Lesser General Public License for more details.
+!
+! You should have received a copy of the GNU Lesser General Public License
+! along with this library; if not, write to the Free Software Foundation,
+! Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+!
+
+!
+! Release: This file is part of the kim-api-2.4.1 package.
+!
+
+
+!> \brief \copybrief KIM::PendingModel
+!!
+!! \sa KIM::PendingModel, KIM_PendingModel
+!!
+!! \since 2.5
+module kim_pending_model_module
+  use, intrinsic :: iso_c_binding
+  implicit none
+  private
+
+  public &
+    ! Derived types
+    kim_pending_model_handle_type, &
+    ! Constants
+    KIM_PENDING_MODEL_NULL_HANDLE, &
+    ! Routines
+    operator(.eq.), &
+    operator(.ne.), &
+    kim_model_create_async, &
+    kim_pending_model_destroy, &
+    kim_is_complete, &
+    kim_wait
+
+  !> \brief \copybrief KIM::PendingModel
+  !!
+  !! \sa KIM::PendingModel, KIM_PendingModel
+  !!
+  !! \since 2.5
+  type, bind(c) :: kim_pending_model_handle_type
+    type(c_ptr) :: p = c_null_ptr
+  end type kim_pending_model_handle_type
+
+  !> \brief NULL handle for use in comparisons.
+  !!
+  !! \since 2.5
+  type(kim_pending_model_handle_type), protected, save &
+    :: KIM_PENDING_MODEL_NULL_HANDLE
+
+  !> \brief Compares kim_pending_model_handle_type's for equality.
+  !!
+  !! \since 2.5
+  interface operator(.eq.)
+    module procedure kim_pending_model_handle_equal
+  end interface operator(.eq.)
+
+  !> \brief Compares kim_pending_model_handle_type's for inequality.
+  !!
+  !! \since 2.5
+  interface operator(.ne.)
+    module procedure kim_pending_model_handle_not_equal
+  end interface operator(.ne.)
+
+  !> \brief \copybrief KIM::PendingModel::IsComplete
+  !!
+  !! \sa KIM::PendingModel::IsComplete, KIM_PendingModel_IsComplete
+  !!
+  !! \since 2.5
+  interface kim_is_complete
+    module procedure kim_pending_model_is_complete
+  end interface kim_is_complete
+
+  !> \brief \copybrief KIM::PendingModel::Wait
+  !!
+  !! \sa KIM::PendingModel::Wait, KIM_PendingModel_Wait
+  !!
+  !! \since 2.5
+  interface kim_wait
+    module procedure kim_pending_model_wait
+  end interface kim_wait
+
+contains
+  !> \brief Compares kim_pending_model_handle_type's for equality.
+  !!
+  !! \since 2.5
+  logical recursive function kim_pending_model_handle_equal(lhs, rhs)
+    implicit none
+    type(kim_pending_model_handle_type), intent(in) :: lhs
+    type(kim_pending_model_handle_type), intent(in) :: rhs
+
+    if ((.not. c_associated(lhs%p)) .and. (.not. c_associated(rhs%p))) then
+      kim_pending_model_handle_equal = .true.
+    else
+      kim_pending_model_handle_equal = c_associated(lhs%p, rhs%p)
+    end if
+  end function kim_pending_model_handle_equal
+
+  !> \brief Compares kim_pending_model_handle_type's for inequality.
+  !!
+  !! \since 2.5
+  logical recursive function kim_pending_model_handle_not_equal(lhs, rhs)
+    implicit none
+    type(kim_pending_model_handle_type), intent(in) :: lhs
+    type(kim_pending_model_handle_type), intent(in) :: rhs
+
+    kim_pending_model_handle_not_equal = .not. (lhs == rhs)
+  end function kim_pending_model_handle_not_equal
+
+  !> \brief \copybrief KIM::Model::CreateAsync
+  !!
+  !! \sa KIM::Model::CreateAsync, KIM_Model_CreateAsync
+  !!
+  !! \since 2.5
+  recursive subroutine kim_model_create_async( &
+    numbering, requested_length_unit, requested_energy_unit, &
+    requested_charge_unit, requested_temperature_unit, requested_time_unit, &
+    model_name, pending_model_handle, ierr)
+    use kim_numbering_module, only: kim_numbering_type
+    use kim_unit_system_module, only: kim_length_unit_type, &
+                                      kim_energy_unit_type, &
+                                      kim_charge_unit_type, &
+                                      kim_temperature_unit_type, &
+                                      kim_time_unit_type
+    implicit none
+    interface
+      integer(c_int) recursive function create_async( &
+        numbering, requested_length_unit, requested_energy_unit, &
+        requested_charge_unit, requested_temperature_unit, &
+        requested_time_unit, model_name, pending_model) &
+        bind(c, name="KIM_Model_CreateAsync")
+        use, intrinsic :: iso_c_binding
+        use kim_numbering_module, only: kim_numbering_type
+        use kim_unit_system_module, only: kim_length_unit_type, &
+                                          kim_energy_unit_type, &
+                                          kim_charge_unit_type, &
+                                          kim_temperature_unit_type, &
+                                          kim_time_unit_type
+        implicit none
+        type(kim_numbering_type), intent(in), value :: numbering
+        type(kim_length_unit_type), intent(in), value :: requested_length_unit
+        type(kim_energy_unit_type), intent(in), value :: requested_energy_unit
+        type(kim_charge_unit_type), intent(in), value :: requested_charge_unit
+        type(kim_temperature_unit_type), intent(in), value :: &
+          requested_temperature_unit
+        type(kim_time_unit_type), intent(in), value :: requested_time_unit
+        character(c_char), intent(in) :: model_name(*)
+        type(c_ptr), intent(out) :: pending_model
+      end function create_async
+    end interface
+    type(kim_numbering_type), intent(in) :: numbering
+    type(kim_length_unit_type), intent(in) :: requested_length_unit
+    type(kim_energy_unit_type), intent(in) :: requested_energy_unit
+    type(kim_charge_unit_type), intent(in) :: requested_charge_unit
+    type(kim_temperature_unit_type), intent(in) :: &
+      requested_temperature_unit
+    type(kim_time_unit_type), intent(in) :: requested_time_unit
+    character(len=*, kind=c_char), intent(in) :: model_name
+    type(kim_pending_model_handle_type), intent(out) :: pending_model_handle
+    integer(c_int), intent(out) :: ierr
+
+    type(c_ptr) :: ppending_model
+
+    ierr = create_async(numbering, requested_length_unit, &
+                        requested_energy_unit, requested_charge_unit, &
+                        requested_temperature_unit, requested_time_unit, &
+                        trim(model_name)//c_null_char, ppending_model)
+    pending_model_handle%p = ppending_model
+  end subroutine kim_model_create_async
+
+  !> \brief \copybrief KIM::PendingModel::Destroy
+  !!
+  !! \sa KIM::PendingModel::Destroy, KIM_PendingModel_Destroy
+  !!
+  !! \since 2.5
+  recursive subroutine kim_pending_model_destroy(pending_model_handle)
+    implicit none
+    interface
+      recursive subroutine destroy(pending_model) &
+        bind(c, name="KIM_PendingModel_Destroy")
+        use, intrinsic :: iso_c_binding
+        implicit none
+        type(c_ptr), intent(inout) :: pending_model
+      end subroutine destroy
+    end interface
+    type(kim_pending_model_handle_type), intent(inout) :: pending_model_handle
+
+    type(c_ptr) :: ppending_model
+    ppending_model = pending_model_handle%p
+    call destroy(ppending_model)
+    pending_model_handle%p = c_null_ptr
+  end subroutine kim_pending_model_destroy
+
+  !> \brief \copybrief KIM::PendingModel::IsComplete
+  !!
+  !! \sa KIM::PendingModel::IsComplete, KIM_PendingModel_IsComplete
+  !!
+  !! \since 2.5
+  recursive subroutine kim_pending_model_is_complete(pending_model_handle, &
+                                                     is_complete)
+    use kim_interoperable_types_module, only: kim_pending_model_type
+    implicit none
+    interface
+      recursive subroutine pending_model_is_complete( &
+        pending_model, is_complete) &
+        bind(c, name="KIM_PendingModel_IsComplete")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_pending_model_type
+        implicit none
+        type(kim_pending_model_type), intent(in) :: pending_model
+        integer(c_int), intent(out) :: is_complete
+      end subroutine pending_model_is_complete
+    end interface
+    type(kim_pending_model_handle_type), intent(in) :: pending_model_handle
+    integer(c_int), intent(out) :: is_complete
+    type(kim_pending_model_type), pointer :: pending_model
+
+    call c_f_pointer(pending_model_handle%p, pending_model)
+    call pending_model_is_complete(pending_model, is_complete)
+  end subroutine kim_pending_model_is_complete
+
+  !> \brief \copybrief KIM::PendingModel::Wait
+  !!
+  !! \sa KIM::PendingModel::Wait, KIM_PendingModel_Wait
+  !!
+  !! \since 2.5
+  recursive subroutine kim_pending_model_wait(pending_model_handle, &
+                                              requested_units_accepted, &
+                                              model_handle, ierr)
+    use kim_interoperable_types_module, only: kim_pending_model_type
+    use kim_model_module, only: kim_model_handle_type
+    implicit none
+    interface
+      integer(c_int) recursive function pending_model_wait( &
+        pending_model, requested_units_accepted, model) &
+        bind(c, name="KIM_PendingModel_Wait")
+        use, intrinsic :: iso_c_binding
+        use kim_interoperable_types_module, only: kim_pending_model_type
+        implicit none
+        type(kim_pending_model_type), intent(in) :: pending_model
+        integer(c_int), intent(out) :: requested_units_accepted
+        type(c_ptr), intent(out) :: model
+      end function pending_model_wait
+    end interface
+    type(kim_pending_model_handle_type), intent(in) :: pending_model_handle
+    integer(c_int), intent(out) :: requested_units_accepted
+    type(kim_model_handle_type), intent(out) :: model_handle
+    integer(c_int), intent(out) :: ierr
+    type(kim_pending_model_type), pointer :: pending_model
+
+    type(c_ptr) :: pmodel
+
+    call c_f_pointer(pending_model_handle%p, pending_model)
+    ierr = pending_model_wait(pending_model, requested_units_accepted, pmodel)
+    model_handle%p = pmodel
+  end subroutine kim_pending_model_wait
+end module kim_pending_model_module
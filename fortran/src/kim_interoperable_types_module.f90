@@ -48,6 +48,7 @@ module kim_interoperable_types_module
     kim_model_type, &
     kim_model_refresh_type, &
     kim_model_write_parameterized_model_type, &
+    kim_pending_model_type, &
     kim_simulator_model_type
 
   type, bind(c) :: kim_collections_type
@@ -120,6 +121,11 @@ module kim_interoperable_types_module
     type(c_ptr) :: p
   end type kim_model_write_parameterized_model_type
 
+  type, bind(c) :: kim_pending_model_type
+    private
+    type(c_ptr) :: p
+  end type kim_pending_model_type
+
   type, bind(c) :: kim_simulator_model_type
     private
     type(c_ptr) :: p
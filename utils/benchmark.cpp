@@ -0,0 +1,1042 @@
+//
+// KIM-API: An API for interatomic models
+// Copyright (c) 2013--2022, Regents of the University of Minnesota.
+// All rights reserved.
+//
+// Contributors:
+//    Ryan S. Elliott
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+//
+
+//
+// Release: This file is part of the kim-api-2.4.1 package.
+//
+
+
+#include "KIM_ModelStatistics.hpp"
+#include "KIM_SimulatorHeaders.hpp"
+#include "KIM_Version.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#define DIM 3
+
+namespace
+{
+// value of quantities that were not measured
+double const notMeasured = std::numeric_limits<double>::quiet_NaN();
+
+bool IsMeasured(double const value) { return value == value; }
+
+//
+// Command line settings
+//
+struct Settings
+{
+  std::string modelName;
+  std::string modelLibraryPath;  // bypasses the collections when given
+  std::string driverLibraryPath;
+  std::string configuration;
+  std::vector<int> sizes;
+  std::vector<std::string> species;
+  double nearestNeighborDistance;  // <= 0.0 selects a default
+  int steps;
+  int refreshes;
+  unsigned int seed;
+  bool json;
+  bool statistics;
+  bool async;
+};
+
+//
+// Timing results for one configuration size
+//
+struct SizeResult
+{
+  int numberOfParticles;
+  double neighborListSeconds;
+  double averageNumberOfNeighbors;
+  double energyNsPerAtomStep;
+  double forcesNsPerAtomStep;
+  double virialNsPerAtomStep;
+  double peakMemoryKiB;
+  double callbackPercent;  // time inside simulator callbacks
+};
+
+//
+// Full neighbor lists, one per model cutoff, in compressed row format
+//
+struct NeighborLists
+{
+  int numberOfParticles;
+  std::vector<std::vector<int> > offsets;
+  std::vector<std::vector<int> > neighbors;
+};
+
+void usage(std::string name)
+{
+  size_t beg = name.find_last_of("/\\");
+  if (beg != std::string::npos) name = name.substr(beg + 1, std::string::npos);
+
+  // Follows docopt.org format
+  std::cerr << "Usage:\n"
+            << "  " << name << " "
+            << "[options] <portable-model-name>\n"
+            << "  " << name << " "
+            << "[options] --model-library <path>\n"
+            << "  " << name << " "
+            << "--version\n"
+            << "\n"
+            << "Options:\n"
+            << "  --configuration <fcc|bcc|hcp|liquid|cluster>  "
+            << "[default: fcc]\n"
+            << "  --sizes <n1,n2,...>              "
+            << "Numbers of particles [default: 256,2048,16384]\n"
+            << "  --model-library <path>           "
+            << "Create the model from its shared library file\n"
+            << "  --driver-library <path>          "
+            << "Shared library file of the model's driver\n"
+            << "  --species <s1,s2,...>            "
+            << "Species to use [default: first supported species]\n"
+            << "  --nearest-neighbor-distance <d>  "
+            << "[default: 0.45 * model influence distance]\n"
+            << "  --steps <n>                      "
+            << "Timed computes per measurement [default: 10]\n"
+            << "  --refreshes <n>                  "
+            << "Timed ClearThenRefresh calls [default: 10]\n"
+            << "  --seed <n>                       "
+            << "Seed for liquid configurations [default: 1]\n"
+            << "  --statistics                     "
+            << "Report time spent in simulator callbacks\n"
+            << "  --async                          "
+            << "Create the model with Model::CreateAsync\n"
+            << "  --json                           "
+            << "Write results as JSON\n";
+  // note: this interface is likely to change in future kim-api releases
+}
+
+double PeakMemoryKiB()
+{
+#if defined(_WIN32)
+  return notMeasured;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage)) return notMeasured;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024.0;  // bytes on macOS
+#else
+  return static_cast<double>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+std::vector<std::string> SplitList(std::string const & list)
+{
+  std::vector<std::string> items;
+  std::stringstream ss(list);
+  std::string item;
+  while (std::getline(ss, item, ','))
+  {
+    if (item != "") items.push_back(item);
+  }
+  return items;
+}
+
+int ParseArguments(int argc, char * argv[], Settings * const settings)
+{
+  settings->configuration = "fcc";
+  settings->sizes.clear();
+  settings->nearestNeighborDistance = 0.0;
+  settings->steps = 10;
+  settings->refreshes = 10;
+  settings->seed = 1;
+  settings->json = false;
+  settings->statistics = false;
+  settings->async = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const arg(argv[i]);
+    bool const hasValue = (i + 1 < argc);
+
+    if (arg == "--json") { settings->json = true; }
+    else if (arg == "--statistics") { settings->statistics = true; }
+    else if (arg == "--async") { settings->async = true; }
+    else if ((arg == "--configuration") && hasValue)
+    {
+      settings->configuration = argv[++i];
+    }
+    else if ((arg == "--sizes") && hasValue)
+    {
+      std::vector<std::string> const items = SplitList(argv[++i]);
+      for (size_t j = 0; j < items.size(); ++j)
+        settings->sizes.push_back(std::atoi(items[j].c_str()));
+    }
+    else if ((arg == "--species") && hasValue)
+    {
+      settings->species = SplitList(argv[++i]);
+    }
+    else if ((arg == "--nearest-neighbor-distance") && hasValue)
+    {
+      settings->nearestNeighborDistance = std::atof(argv[++i]);
+    }
+    else if ((arg == "--steps") && hasValue)
+    {
+      settings->steps = std::atoi(argv[++i]);
+    }
+    else if ((arg == "--refreshes") && hasValue)
+    {
+      settings->refreshes = std::atoi(argv[++i]);
+    }
+    else if ((arg == "--seed") && hasValue)
+    {
+      settings->seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+    }
+    else if ((arg == "--model-library") && hasValue)
+    {
+      settings->modelLibraryPath = argv[++i];
+    }
+    else if ((arg == "--driver-library") && hasValue)
+    {
+      settings->driverLibraryPath = argv[++i];
+    }
+    else if ((arg.size() > 1) && (arg[0] == '-')) { return true; }
+    else if (settings->modelName == "") { settings->modelName = arg; }
+    else { return true; }
+  }
+
+  if (settings->sizes.empty())
+  {
+    settings->sizes.push_back(256);
+    settings->sizes.push_back(2048);
+    settings->sizes.push_back(16384);
+  }
+  for (size_t i = 0; i < settings->sizes.size(); ++i)
+  {
+    if (settings->sizes[i] < 1) return true;
+  }
+
+  if ((settings->configuration != "fcc") && (settings->configuration != "bcc")
+      && (settings->configuration != "hcp")
+      && (settings->configuration != "liquid")
+      && (settings->configuration != "cluster"))
+    return true;
+
+  if ((settings->modelName != "") && (settings->modelLibraryPath != ""))
+    return true;
+  if (settings->async && (settings->modelLibraryPath != "")) return true;
+  if (settings->modelName == "")
+    settings->modelName = settings->modelLibraryPath;
+
+  return ((settings->modelName == "") || (settings->steps < 1)
+          || (settings->refreshes < 0));
+}
+
+//
+// Configuration generation
+//
+// All configurations are free-standing (no periodic images).  The first
+// numberOfParticles sites of a block of unit cells are used for crystals.
+//
+void LatticeBasis(std::string const & lattice,
+                  double const nearestNeighborDistance,
+                  double * const cell,
+                  std::vector<double> * const basis)
+{
+  basis->clear();
+  if (lattice == "bcc")
+  {
+    double const a = 2.0 * nearestNeighborDistance / std::sqrt(3.0);
+    cell[0] = cell[1] = cell[2] = a;
+    double const b[] = {0.0, 0.0, 0.0, 0.5, 0.5, 0.5};
+    basis->assign(b, b + 6);
+  }
+  else if (lattice == "hcp")
+  {
+    // orthohexagonal cell
+    double const a = nearestNeighborDistance;
+    cell[0] = a;
+    cell[1] = std::sqrt(3.0) * a;
+    cell[2] = std::sqrt(8.0 / 3.0) * a;
+    double const b[] = {0.0,
+                        0.0,
+                        0.0,
+                        0.5,
+                        0.5,
+                        0.0,
+                        0.5,
+                        1.0 / 6.0,
+                        0.5,
+                        0.0,
+                        2.0 / 3.0,
+                        0.5};
+    basis->assign(b, b + 12);
+  }
+  else  // fcc
+  {
+    double const a = std::sqrt(2.0) * nearestNeighborDistance;
+    cell[0] = cell[1] = cell[2] = a;
+    double const b[]
+        = {0.0, 0.0, 0.0, 0.5, 0.5, 0.0, 0.5, 0.0, 0.5, 0.0, 0.5, 0.5};
+    basis->assign(b, b + 12);
+  }
+
+  for (size_t i = 0; i < basis->size(); ++i) (*basis)[i] *= cell[i % DIM];
+}
+
+void LatticeBlock(std::string const & lattice,
+                  double const nearestNeighborDistance,
+                  int const minimumNumberOfParticles,
+                  std::vector<double> * const coordinates)
+{
+  double cell[DIM];
+  std::vector<double> basis;
+  LatticeBasis(lattice, nearestNeighborDistance, cell, &basis);
+  int const numberOfBasisSites = static_cast<int>(basis.size()) / DIM;
+
+  int cellsPerSide = 1;
+  while (cellsPerSide * cellsPerSide * cellsPerSide * numberOfBasisSites
+         < minimumNumberOfParticles)
+    ++cellsPerSide;
+
+  coordinates->clear();
+  for (int i = 0; i < cellsPerSide; ++i)
+  {
+    for (int j = 0; j < cellsPerSide; ++j)
+    {
+      for (int k = 0; k < cellsPerSide; ++k)
+      {
+        for (int b = 0; b < numberOfBasisSites; ++b)
+        {
+          coordinates->push_back(i * cell[0] + basis[DIM * b + 0]);
+          coordinates->push_back(j * cell[1] + basis[DIM * b + 1]);
+          coordinates->push_back(k * cell[2] + basis[DIM * b + 2]);
+        }
+      }
+    }
+  }
+}
+
+void CreateConfiguration(std::string const & configuration,
+                         double const nearestNeighborDistance,
+                         int const numberOfParticles,
+                         unsigned int const seed,
+                         std::vector<double> * const coordinates)
+{
+  if (configuration == "cluster")
+  {
+    // the numberOfParticles fcc sites closest to the center of a larger block
+    std::vector<double> block;
+    LatticeBlock("fcc", nearestNeighborDistance, 2 * numberOfParticles, &block);
+    int const numberOfSites = static_cast<int>(block.size()) / DIM;
+    double center[DIM] = {0.0, 0.0, 0.0};
+    for (int i = 0; i < numberOfSites; ++i)
+    {
+      for (int k = 0; k < DIM; ++k) center[k] += block[DIM * i + k];
+    }
+    for (int k = 0; k < DIM; ++k) center[k] /= numberOfSites;
+
+    std::vector<std::pair<double, int> > order(numberOfSites);
+    for (int i = 0; i < numberOfSites; ++i)
+    {
+      double rsq = 0.0;
+      for (int k = 0; k < DIM; ++k)
+      {
+        double const dx = block[DIM * i + k] - center[k];
+        rsq += dx * dx;
+      }
+      order[i] = std::make_pair(rsq, i);
+    }
+    std::sort(order.begin(), order.end());
+
+    coordinates->resize(DIM * numberOfParticles);
+    for (int i = 0; i < numberOfParticles; ++i)
+    {
+      for (int k = 0; k < DIM; ++k)
+        (*coordinates)[DIM * i + k] = block[DIM * order[i].second + k];
+    }
+  }
+  else if (configuration == "liquid")
+  {
+    // fcc sites, each displaced randomly by up to 0.15 of the nearest
+    // neighbor distance in every direction, in random order
+    LatticeBlock(
+        "fcc", nearestNeighborDistance, numberOfParticles, coordinates);
+    coordinates->resize(DIM * numberOfParticles);
+    std::srand(seed);
+    for (int i = 0; i < DIM * numberOfParticles; ++i)
+    {
+      double const random = static_cast<double>(std::rand()) / RAND_MAX;
+      (*coordinates)[i] += 0.3 * nearestNeighborDistance * (random - 0.5);
+    }
+    for (int i = numberOfParticles - 1; i > 0; --i)
+    {
+      int const j = std::rand() % (i + 1);
+      for (int k = 0; k < DIM; ++k)
+        std::swap((*coordinates)[DIM * i + k], (*coordinates)[DIM * j + k]);
+    }
+  }
+  else
+  {
+    LatticeBlock(
+        configuration, nearestNeighborDistance, numberOfParticles, coordinates);
+    coordinates->resize(DIM * numberOfParticles);
+  }
+}
+
+//
+// Cell list neighbor list construction
+//
+void BuildNeighborLists(std::vector<double> const & coordinates,
+                        int const numberOfNeighborLists,
+                        double const * const cutoffs,
+                        NeighborLists * const nl)
+{
+  int const numberOfParticles = static_cast<int>(coordinates.size()) / DIM;
+  double maxCutoff = 0.0;
+  for (int l = 0; l < numberOfNeighborLists; ++l)
+    maxCutoff = std::max(maxCutoff, cutoffs[l]);
+
+  // bin the particles into cells no smaller than the largest cutoff
+  double lower[DIM];
+  double upper[DIM];
+  for (int k = 0; k < DIM; ++k) lower[k] = upper[k] = coordinates[k];
+  for (int i = 0; i < numberOfParticles; ++i)
+  {
+    for (int k = 0; k < DIM; ++k)
+    {
+      lower[k] = std::min(lower[k], coordinates[DIM * i + k]);
+      upper[k] = std::max(upper[k], coordinates[DIM * i + k]);
+    }
+  }
+  int cellsPerDim[DIM];
+  double cellSize[DIM];
+  for (int k = 0; k < DIM; ++k)
+  {
+    double const extent = upper[k] - lower[k];
+    cellsPerDim[k] = (maxCutoff > 0.0)
+                         ? std::max(1, static_cast<int>(extent / maxCutoff))
+                         : 1;
+    cellsPerDim[k] = std::min(cellsPerDim[k], 1024);
+    cellSize[k] = (extent > 0.0) ? extent / cellsPerDim[k] : 1.0;
+  }
+  int const numberOfCells = cellsPerDim[0] * cellsPerDim[1] * cellsPerDim[2];
+
+  std::vector<int> particleCell(numberOfParticles);
+  std::vector<int> cellStart(numberOfCells + 1, 0);
+  for (int i = 0; i < numberOfParticles; ++i)
+  {
+    int c[DIM];
+    for (int k = 0; k < DIM; ++k)
+    {
+      c[k] = static_cast<int>((coordinates[DIM * i + k] - lower[k])
+                              / cellSize[k]);
+      c[k] = std::max(0, std::min(c[k], cellsPerDim[k] - 1));
+    }
+    particleCell[i] = (c[0] * cellsPerDim[1] + c[1]) * cellsPerDim[2] + c[2];
+    ++cellStart[particleCell[i] + 1];
+  }
+  for (int c = 0; c < numberOfCells; ++c) cellStart[c + 1] += cellStart[c];
+  std::vector<int> cellParticles(numberOfParticles);
+  std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+  for (int i = 0; i < numberOfParticles; ++i)
+    cellParticles[fill[particleCell[i]]++] = i;
+
+  nl->numberOfParticles = numberOfParticles;
+  nl->offsets.assign(numberOfNeighborLists, std::vector<int>(1, 0));
+  nl->neighbors.assign(numberOfNeighborLists, std::vector<int>());
+  std::vector<double> cutoffsSq(numberOfNeighborLists);
+  for (int l = 0; l < numberOfNeighborLists; ++l)
+  {
+    cutoffsSq[l] = cutoffs[l] * cutoffs[l];
+    nl->offsets[l].reserve(numberOfParticles + 1);
+  }
+
+  for (int i = 0; i < numberOfParticles; ++i)
+  {
+    int const ci = particleCell[i];
+    int const c0 = ci / (cellsPerDim[1] * cellsPerDim[2]);
+    int const c1 = (ci / cellsPerDim[2]) % cellsPerDim[1];
+    int const c2 = ci % cellsPerDim[2];
+    for (int d0 = std::max(0, c0 - 1);
+         d0 <= std::min(c0 + 1, cellsPerDim[0] - 1);
+         ++d0)
+    {
+      for (int d1 = std::max(0, c1 - 1);
+           d1 <= std::min(c1 + 1, cellsPerDim[1] - 1);
+           ++d1)
+      {
+        for (int d2 = std::max(0, c2 - 1);
+             d2 <= std::min(c2 + 1, cellsPerDim[2] - 1);
+             ++d2)
+        {
+          int const c = (d0 * cellsPerDim[1] + d1) * cellsPerDim[2] + d2;
+          for (int p = cellStart[c]; p < cellStart[c + 1]; ++p)
+          {
+            int const j = cellParticles[p];
+            if (j == i) continue;
+            double rsq = 0.0;
+            for (int k = 0; k < DIM; ++k)
+            {
+              double const dx
+                  = coordinates[DIM * j + k] - coordinates[DIM * i + k];
+              rsq += dx * dx;
+            }
+            for (int l = 0; l < numberOfNeighborLists; ++l)
+            {
+              if (rsq <= cutoffsSq[l]) nl->neighbors[l].push_back(j);
+            }
+          }
+        }
+      }
+    }
+    for (int l = 0; l < numberOfNeighborLists; ++l)
+      nl->offsets[l].push_back(static_cast<int>(nl->neighbors[l].size()));
+  }
+}
+
+int GetNeighborList(void * const dataObject,
+                    int const numberOfNeighborLists,
+                    double const * const cutoffs,
+                    int const neighborListIndex,
+                    int const particleNumber,
+                    int * const numberOfNeighbors,
+                    int const ** const neighborsOfParticle)
+{
+  (void) cutoffs;  // avoid unused parameter warning
+  NeighborLists const * const nl
+      = reinterpret_cast<NeighborLists const *>(dataObject);
+
+  if ((neighborListIndex < 0) || (neighborListIndex >= numberOfNeighborLists)
+      || (particleNumber < 0) || (particleNumber >= nl->numberOfParticles))
+    return true;
+
+  std::vector<int> const & offsets = nl->offsets[neighborListIndex];
+  *numberOfNeighbors = offsets[particleNumber + 1] - offsets[particleNumber];
+  *neighborsOfParticle
+      = (*numberOfNeighbors > 0)
+            ? &(nl->neighbors[neighborListIndex][offsets[particleNumber]])
+            : NULL;
+  return false;
+}
+
+//
+// Output helpers
+//
+std::string JsonString(std::string const & value)
+{
+  std::stringstream ss;
+  ss << "\"";
+  for (size_t i = 0; i < value.size(); ++i)
+  {
+    char const c = value[i];
+    if ((c == '"') || (c == '\\'))
+      ss << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      ss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+         << static_cast<int>(c) << std::dec << std::setfill(' ');
+    else
+      ss << c;
+  }
+  ss << "\"";
+  return ss.str();
+}
+
+std::string JsonNumber(double const value)
+{
+  std::stringstream ss;
+  if (!IsMeasured(value))
+    ss << "null";
+  else
+    ss << std::setprecision(6) << value;
+  return ss.str();
+}
+
+std::string TextNumber(double const value, int const precision)
+{
+  std::stringstream ss;
+  if (!IsMeasured(value))
+    ss << "-";
+  else
+    ss << std::fixed << std::setprecision(precision) << value;
+  return ss.str();
+}
+
+// least squares slope of log(time per step) against log(N)
+double ScalingExponent(std::vector<SizeResult> const & results,
+                       double SizeResult::*member)
+{
+  double sx = 0.0;
+  double sy = 0.0;
+  double sxx = 0.0;
+  double sxy = 0.0;
+  int n = 0;
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    if (!IsMeasured(results[i].*member)) continue;
+    double const particles = results[i].numberOfParticles;
+    double const x = std::log(particles);
+    double const y = std::log(results[i].*member * particles);
+    sx += x;
+    sy += y;
+    sxx += x * x;
+    sxy += x * y;
+    ++n;
+  }
+  double const denominator = n * sxx - sx * sx;
+  if ((n < 2) || (denominator <= 0.0)) return notMeasured;
+  return (n * sxy - sx * sy) / denominator;
+}
+
+// Time steps computes, after an untimed warm-up compute
+int TimeCompute(KIM::Model * const mdl,
+                KIM::ComputeArguments * const computeArguments,
+                int const steps,
+                int const numberOfParticles,
+                double * const nsPerAtomStep)
+{
+  int error = mdl->Compute(computeArguments);
+  double const computeStart = KIM::ModelStatistics::WallTime();
+  for (int step = 0; (!error) && (step < steps); ++step)
+    error = mdl->Compute(computeArguments);
+  double const computeSeconds = KIM::ModelStatistics::WallTime() - computeStart;
+  if (error) return true;
+
+  *nsPerAtomStep = 1.0e9 * computeSeconds
+                   / (static_cast<double>(numberOfParticles) * steps);
+  return false;
+}
+}  // namespace
+
+
+int main(int argc, char * argv[])
+{
+  if ((argc == 2) && (std::string(argv[1]) == "--version"))
+  {
+    std::cout << KIM_VERSION_STRING << std::endl;
+    return 0;
+  }
+
+  Settings settings;
+  if (ParseArguments(argc, argv, &settings))
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  // time model creation
+  KIM::Model * mdl = NULL;
+  int requestedUnitsAccepted = 0;
+  double const createStart = KIM::ModelStatistics::WallTime();
+  int error;
+  if (settings.modelLibraryPath != "")
+  {
+    error = KIM::Model::CreateFromLibraryPath(KIM::NUMBERING::zeroBased,
+                                              KIM::LENGTH_UNIT::A,
+                                              KIM::ENERGY_UNIT::eV,
+                                              KIM::CHARGE_UNIT::e,
+                                              KIM::TEMPERATURE_UNIT::K,
+                                              KIM::TIME_UNIT::ps,
+                                              settings.modelLibraryPath,
+                                              settings.driverLibraryPath,
+                                              &requestedUnitsAccepted,
+                                              &mdl);
+  }
+  else if (settings.async)
+  {
+    KIM::PendingModel * pendingModel = NULL;
+    error = KIM::Model::CreateAsync(KIM::NUMBERING::zeroBased,
+                                    KIM::LENGTH_UNIT::A,
+                                    KIM::ENERGY_UNIT::eV,
+                                    KIM::CHARGE_UNIT::e,
+                                    KIM::TEMPERATURE_UNIT::K,
+                                    KIM::TIME_UNIT::ps,
+                                    settings.modelName,
+                                    &pendingModel);
+    if (!error)
+    {
+      error = pendingModel->Wait(&requestedUnitsAccepted, &mdl);
+      KIM::PendingModel::Destroy(&pendingModel);
+    }
+  }
+  else
+  {
+    error = KIM::Model::Create(KIM::NUMBERING::zeroBased,
+                               KIM::LENGTH_UNIT::A,
+                               KIM::ENERGY_UNIT::eV,
+                               KIM::CHARGE_UNIT::e,
+                               KIM::TEMPERATURE_UNIT::K,
+                               KIM::TIME_UNIT::ps,
+                               settings.modelName,
+                               &requestedUnitsAccepted,
+                               &mdl);
+  }
+  double const createSeconds = KIM::ModelStatistics::WallTime() - createStart;
+  if (error)
+  {
+    std::cerr << "Error creating model object" << std::endl;
+    return 1;
+  }
+  mdl->SetStatisticsEnabled(settings.statistics);
+
+  // time ClearThenRefresh
+  double refreshSeconds = notMeasured;
+  int refreshPresent = 0;
+  int refreshRequired = 0;
+  mdl->IsRoutinePresent(
+      KIM::MODEL_ROUTINE_NAME::Refresh, &refreshPresent, &refreshRequired);
+  if (refreshPresent && (settings.refreshes > 0))
+  {
+    double const refreshStart = KIM::ModelStatistics::WallTime();
+    for (int i = 0; i < settings.refreshes; ++i)
+    {
+      if (mdl->ClearThenRefresh())
+      {
+        std::cerr << "Error in ClearThenRefresh" << std::endl;
+        KIM::Model::Destroy(&mdl);
+        return 1;
+      }
+    }
+    refreshSeconds = (KIM::ModelStatistics::WallTime() - refreshStart)
+                     / settings.refreshes;
+  }
+
+  // species; by default, the first supported species
+  bool const useFirstSupportedSpecies = settings.species.empty();
+  std::vector<std::string> speciesNames;
+  std::vector<int> speciesCodes;
+  if (useFirstSupportedSpecies)
+  {
+    int numberOfSpeciesNames = 0;
+    KIM::SPECIES_NAME::GetNumberOfSpeciesNames(&numberOfSpeciesNames);
+    for (int i = 0; i < numberOfSpeciesNames; ++i)
+    {
+      KIM::SpeciesName species;
+      KIM::SPECIES_NAME::GetSpeciesName(i, &species);
+      settings.species.push_back(species.ToString());
+    }
+  }
+  for (size_t i = 0; i < settings.species.size(); ++i)
+  {
+    KIM::SpeciesName const species(settings.species[i]);
+    int supported = 0;
+    int code = 0;
+    if ((!mdl->GetSpeciesSupportAndCode(species, &supported, &code))
+        && supported)
+    {
+      speciesNames.push_back(species.ToString());
+      speciesCodes.push_back(code);
+      if (useFirstSupportedSpecies) break;
+    }
+  }
+  if (speciesCodes.empty())
+  {
+    std::cerr << "Model supports none of the requested species" << std::endl;
+    KIM::Model::Destroy(&mdl);
+    return 1;
+  }
+
+  // neighbor list requirements
+  double influenceDistance = 0.0;
+  mdl->GetInfluenceDistance(&influenceDistance);
+  int numberOfNeighborLists = 0;
+  double const * cutoffs = NULL;
+  int const * modelWillNotRequestNeighborsOfNoncontributingParticles = NULL;
+  mdl->GetNeighborListPointers(
+      &numberOfNeighborLists,
+      &cutoffs,
+      &modelWillNotRequestNeighborsOfNoncontributingParticles);
+  double const nearestNeighborDistance
+      = (settings.nearestNeighborDistance > 0.0)
+            ? settings.nearestNeighborDistance
+            : ((influenceDistance > 0.0) ? 0.45 * influenceDistance : 1.0);
+
+  // compute arguments
+  KIM::ComputeArguments * computeArguments = NULL;
+  if (mdl->ComputeArgumentsCreate(&computeArguments))
+  {
+    std::cerr << "Error creating compute arguments object" << std::endl;
+    KIM::Model::Destroy(&mdl);
+    return 1;
+  }
+  KIM::SupportStatus energySupport;
+  KIM::SupportStatus forcesSupport;
+  KIM::SupportStatus virialSupport;
+  computeArguments->GetArgumentSupportStatus(
+      KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energySupport);
+  computeArguments->GetArgumentSupportStatus(
+      KIM::COMPUTE_ARGUMENT_NAME::partialForces, &forcesSupport);
+  computeArguments->GetArgumentSupportStatus(
+      KIM::COMPUTE_ARGUMENT_NAME::partialVirial, &virialSupport);
+  bool const energySupported
+      = (energySupport != KIM::SUPPORT_STATUS::notSupported);
+  bool const forcesSupported
+      = (forcesSupport != KIM::SUPPORT_STATUS::notSupported);
+  bool const virialSupported
+      = (virialSupport != KIM::SUPPORT_STATUS::notSupported);
+  // required arguments must be provided in every mode
+  bool const forcesRequired = (forcesSupport == KIM::SUPPORT_STATUS::required);
+  bool const virialRequired = (virialSupport == KIM::SUPPORT_STATUS::required);
+
+  NeighborLists nl;
+  error = computeArguments->SetCallbackPointer(
+      KIM::COMPUTE_CALLBACK_NAME::GetNeighborList,
+      KIM::LANGUAGE_NAME::cpp,
+      (KIM::Function *) &GetNeighborList,
+      &nl);
+  if (error)
+  {
+    std::cerr << "Error setting neighbor list callback" << std::endl;
+    mdl->ComputeArgumentsDestroy(&computeArguments);
+    KIM::Model::Destroy(&mdl);
+    return 1;
+  }
+
+  // run the measurements
+  std::vector<SizeResult> results;
+  for (size_t s = 0; s < settings.sizes.size(); ++s)
+  {
+    SizeResult result;
+    int numberOfParticles = settings.sizes[s];
+    result.numberOfParticles = numberOfParticles;
+
+    std::vector<double> coordinates;
+    CreateConfiguration(settings.configuration,
+                        nearestNeighborDistance,
+                        numberOfParticles,
+                        settings.seed,
+                        &coordinates);
+    std::vector<int> particleSpeciesCodes(numberOfParticles);
+    for (int i = 0; i < numberOfParticles; ++i)
+      particleSpeciesCodes[i] = speciesCodes[i % speciesCodes.size()];
+    std::vector<int> particleContributing(numberOfParticles, 1);
+    std::vector<double> forces(DIM * numberOfParticles);
+    double energy = 0.0;
+    double virial[6];
+
+    double const neighborStart = KIM::ModelStatistics::WallTime();
+    BuildNeighborLists(coordinates, numberOfNeighborLists, cutoffs, &nl);
+    result.neighborListSeconds
+        = KIM::ModelStatistics::WallTime() - neighborStart;
+    // report the size of the longest list
+    size_t numberOfPairs = 0;
+    for (int l = 0; l < numberOfNeighborLists; ++l)
+      numberOfPairs = std::max(numberOfPairs, nl.neighbors[l].size());
+    result.averageNumberOfNeighbors
+        = static_cast<double>(numberOfPairs) / numberOfParticles;
+    mdl->ResetStatistics();
+
+    error = computeArguments->SetArgumentPointer(
+                KIM::COMPUTE_ARGUMENT_NAME::numberOfParticles,
+                &numberOfParticles)
+            || computeArguments->SetArgumentPointer(
+                KIM::COMPUTE_ARGUMENT_NAME::particleSpeciesCodes,
+                &(particleSpeciesCodes[0]))
+            || computeArguments->SetArgumentPointer(
+                KIM::COMPUTE_ARGUMENT_NAME::particleContributing,
+                &(particleContributing[0]))
+            || computeArguments->SetArgumentPointer(
+                KIM::COMPUTE_ARGUMENT_NAME::coordinates, &(coordinates[0]));
+    if (error)
+    {
+      std::cerr << "Error setting compute argument pointers" << std::endl;
+      break;
+    }
+
+    // energy only, forces (with energy), and virial (with energy and forces);
+    // a mode that omits an argument the model requires still computes it
+    double * const nsPerAtomStep[3] = {&result.energyNsPerAtomStep,
+                                       &result.forcesNsPerAtomStep,
+                                       &result.virialNsPerAtomStep};
+    bool const supported[3] = {energySupported,
+                               energySupported && forcesSupported,
+                               energySupported && forcesSupported
+                                   && virialSupported};
+    for (int mode = 0; mode < 3; ++mode)
+    {
+      *nsPerAtomStep[mode] = notMeasured;
+      if (!supported[mode]) continue;
+
+      error = computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialEnergy, &energy)
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialForces,
+                  ((mode >= 1) || forcesRequired) ? &(forces[0])
+                                                  : static_cast<double *>(NULL))
+              || computeArguments->SetArgumentPointer(
+                  KIM::COMPUTE_ARGUMENT_NAME::partialVirial,
+                  ((mode >= 2) || virialRequired)
+                      ? virial
+                      : static_cast<double *>(NULL));
+      if (error)
+      {
+        std::cerr << "Error setting compute argument pointers" << std::endl;
+        break;
+      }
+
+      error = TimeCompute(mdl,
+                          computeArguments,
+                          settings.steps,
+                          numberOfParticles,
+                          nsPerAtomStep[mode]);
+      if (error)
+      {
+        std::cerr << "Error in model compute" << std::endl;
+        break;
+      }
+    }
+    if (error) break;
+
+    result.callbackPercent = notMeasured;
+    if (settings.statistics)
+    {
+      double computeTime;
+      double neighborListTime;
+      double processTermTime;
+      mdl->GetStatistics(NULL,
+                         &computeTime,
+                         NULL,
+                         &neighborListTime,
+                         NULL,
+                         NULL,
+                         &processTermTime);
+      if (computeTime > 0.0)
+        result.callbackPercent
+            = 100.0 * (neighborListTime + processTermTime) / computeTime;
+    }
+    result.peakMemoryKiB = PeakMemoryKiB();
+    results.push_back(result);
+  }
+
+  mdl->ComputeArgumentsDestroy(&computeArguments);
+  KIM::Model::Destroy(&mdl);
+  if (error) return 2;
+
+  double const energyScaling
+      = ScalingExponent(results, &SizeResult::energyNsPerAtomStep);
+  double const forcesScaling
+      = ScalingExponent(results, &SizeResult::forcesNsPerAtomStep);
+  double const virialScaling
+      = ScalingExponent(results, &SizeResult::virialNsPerAtomStep);
+
+  if (settings.json)
+  {
+    std::cout << std::setprecision(6);
+    std::cout << "{\n"
+              << "  \"model-name\": " << JsonString(settings.modelName) << ",\n"
+              << "  \"kim-api-version\": \"" << KIM_VERSION_STRING << "\",\n"
+              << "  \"configuration\": " << JsonString(settings.configuration)
+              << ",\n"
+              << "  \"species\": [";
+    for (size_t i = 0; i < speciesNames.size(); ++i)
+      std::cout << ((i > 0) ? ", " : "") << JsonString(speciesNames[i]);
+    std::cout << "],\n"
+              << "  \"nearest-neighbor-distance\": " << nearestNeighborDistance
+              << ",\n"
+              << "  \"influence-distance\": " << influenceDistance << ",\n"
+              << "  \"steps\": " << settings.steps << ",\n"
+              << "  \"create-seconds\": " << createSeconds << ",\n"
+              << "  \"clear-then-refresh-seconds\": "
+              << JsonNumber(refreshSeconds) << ",\n"
+              << "  \"scaling-exponent\": {"
+              << "\"energy\": " << JsonNumber(energyScaling) << ", "
+              << "\"forces\": " << JsonNumber(forcesScaling) << ", "
+              << "\"virial\": " << JsonNumber(virialScaling) << "},\n"
+              << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      SizeResult const & r = results[i];
+      std::cout << ((i > 0) ? "," : "") << "\n    {"
+                << "\"number-of-particles\": " << r.numberOfParticles << ", "
+                << "\"average-number-of-neighbors\": "
+                << r.averageNumberOfNeighbors << ", "
+                << "\"neighbor-list-seconds\": " << r.neighborListSeconds
+                << ", "
+                << "\"energy-ns-per-atom-step\": "
+                << JsonNumber(r.energyNsPerAtomStep) << ", "
+                << "\"forces-ns-per-atom-step\": "
+                << JsonNumber(r.forcesNsPerAtomStep) << ", "
+                << "\"virial-ns-per-atom-step\": "
+                << JsonNumber(r.virialNsPerAtomStep) << ", "
+                << "\"peak-memory-kib\": "
+                << JsonNumber(r.peakMemoryKiB) << ", "
+                << "\"callback-percent\": "
+                << JsonNumber(r.callbackPercent)
+                << "}";
+    }
+    std::cout << "\n  ]\n"
+              << "}" << std::endl;
+  }
+  else
+  {
+    std::cout << "Model:                      " << settings.modelName << "\n"
+              << "Configuration:              " << settings.configuration
+              << "\n"
+              << "Species:                   ";
+    for (size_t i = 0; i < speciesNames.size(); ++i)
+      std::cout << " " << speciesNames[i];
+    std::cout << "\n"
+              << "Nearest neighbor distance:  " << nearestNeighborDistance
+              << "\n"
+              << "Influence distance:         " << influenceDistance << "\n"
+              << "Create:                     " << std::fixed
+              << std::setprecision(3) << 1.0e3 * createSeconds << " ms\n"
+              << "ClearThenRefresh:           "
+              << TextNumber(1.0e6 * refreshSeconds, 3) << " us\n\n";
+
+    std::cout << std::setw(10) << "N" << std::setw(12) << "neighbors"
+              << std::setw(14) << "nlist (ms)" << std::setw(14) << "energy"
+              << std::setw(14) << "forces" << std::setw(14) << "virial"
+              << std::setw(16) << "peak mem (KiB)";
+    if (settings.statistics) std::cout << std::setw(14) << "callbacks %";
+    std::cout << "\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      SizeResult const & r = results[i];
+      std::cout << std::setw(10) << r.numberOfParticles << std::setw(12)
+                << TextNumber(r.averageNumberOfNeighbors, 1) << std::setw(14)
+                << TextNumber(1.0e3 * r.neighborListSeconds, 3)
+                << std::setw(14) << TextNumber(r.energyNsPerAtomStep, 1)
+                << std::setw(14) << TextNumber(r.forcesNsPerAtomStep, 1)
+                << std::setw(14) << TextNumber(r.virialNsPerAtomStep, 1)
+                << std::setw(16) << TextNumber(r.peakMemoryKiB, 0);
+      if (settings.statistics)
+        std::cout << std::setw(14) << TextNumber(r.callbackPercent, 1);
+      std::cout << "\n";
+    }
+    std::cout << "(compute times in ns/atom/step)\n\n"
+              << "Scaling exponent of time per step with N (1 is linear): "
+              << "energy " << TextNumber(energyScaling, 2) << ", forces "
+              << TextNumber(forcesScaling, 2) << ", virial "
+              << TextNumber(virialScaling, 2) << std::endl;
+  }
+
+  return 0;
+}
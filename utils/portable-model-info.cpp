@@ -156,8 +156,30 @@ int main(int argc, char * argv[])
   {
     edn << nonContrib[i] << " ";
   }
-  edn << "] "
-      << "} ";
+  edn << "] ";
+  int numberOfSpeciesCodes = 0;
+  double const * speciesPairCutoffs = NULL;
+  mdl->GetSpeciesPairCutoffsPointer(&numberOfSpeciesCodes, &speciesPairCutoffs);
+  if (speciesPairCutoffs != NULL)
+  {
+    edn << "\"species-pair-cutoffs\""
+        << " "
+        << "[ ";
+    for (int i = 0; i < numberOfNeighborLists; ++i)
+    {
+      edn << "[ ";
+      for (int j = 0; j < numberOfSpeciesCodes * numberOfSpeciesCodes; ++j)
+      {
+        edn << speciesPairCutoffs[i * numberOfSpeciesCodes
+                                      * numberOfSpeciesCodes
+                                  + j]
+            << " ";
+      }
+      edn << "] ";
+    }
+    edn << "] ";
+  }
+  edn << "} ";
 
   // Species support and code
   edn << "\"supported-species\""